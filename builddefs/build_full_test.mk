@@ -25,6 +25,7 @@ $(TEST_OUTPUT)_SRC := \
 	tests/test_common/test_driver.cpp \
 	tests/test_common/keyboard_report_util.cpp \
 	tests/test_common/mouse_report_util.cpp \
+	tests/test_common/test_bench.cpp \
 	tests/test_common/test_fixture.cpp \
 	tests/test_common/test_keymap_key.cpp \
 	tests/test_common/test_logger.cpp \
@@ -62,10 +62,16 @@ include $(BUILDDEFS_PATH)/common_features.mk
 include $(BUILDDEFS_PATH)/generic_features.mk
 include $(PLATFORM_PATH)/common.mk
 include $(TMK_PATH)/protocol.mk
+include $(DRIVER_PATH)/led/tests/rules.mk
 include $(QUANTUM_PATH)/debounce/tests/rules.mk
+include $(QUANTUM_PATH)/deferred_exec/tests/rules.mk
 include $(QUANTUM_PATH)/encoder/tests/rules.mk
+include $(QUANTUM_PATH)/led_power/tests/rules.mk
+include $(QUANTUM_PATH)/matrix/tests/rules.mk
 include $(QUANTUM_PATH)/os_detection/tests/rules.mk
+include $(QUANTUM_PATH)/rgb_matrix/tests/rules.mk
 include $(QUANTUM_PATH)/sequencer/tests/rules.mk
+include $(QUANTUM_PATH)/split_common/tests/rules.mk
 include $(QUANTUM_PATH)/wear_leveling/tests/rules.mk
 include $(QUANTUM_PATH)/logging/print.mk
 include $(PLATFORM_PATH)/test/rules.mk
@@ -369,66 +369,77 @@ ifeq ($(strip $(LED_MATRIX_ENABLE)), yes)
 
     ifeq ($(strip $(LED_MATRIX_DRIVER)), is31fl3729)
         I2C_DRIVER_REQUIRED = yes
+        PWM_DIRTY_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led/issi
         SRC += is31fl3729-mono.c
     endif
 
     ifeq ($(strip $(LED_MATRIX_DRIVER)), is31fl3731)
         I2C_DRIVER_REQUIRED = yes
+        PWM_DIRTY_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led/issi
         SRC += is31fl3731-mono.c
     endif
 
     ifeq ($(strip $(LED_MATRIX_DRIVER)), is31fl3733)
         I2C_DRIVER_REQUIRED = yes
+        PWM_DIRTY_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led/issi
         SRC += is31fl3733-mono.c
     endif
 
     ifeq ($(strip $(LED_MATRIX_DRIVER)), is31fl3736)
         I2C_DRIVER_REQUIRED = yes
+        PWM_DIRTY_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led/issi
         SRC += is31fl3736-mono.c
     endif
 
     ifeq ($(strip $(LED_MATRIX_DRIVER)), is31fl3737)
         I2C_DRIVER_REQUIRED = yes
+        PWM_DIRTY_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led/issi
         SRC += is31fl3737-mono.c
     endif
 
     ifeq ($(strip $(LED_MATRIX_DRIVER)), is31fl3741)
         I2C_DRIVER_REQUIRED = yes
+        PWM_DIRTY_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led/issi
         SRC += is31fl3741-mono.c
     endif
 
     ifeq ($(strip $(LED_MATRIX_DRIVER)), is31fl3742a)
         I2C_DRIVER_REQUIRED = yes
+        PWM_DIRTY_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led/issi
         SRC += is31fl3742a-mono.c
     endif
 
     ifeq ($(strip $(LED_MATRIX_DRIVER)), is31fl3743a)
         I2C_DRIVER_REQUIRED = yes
+        PWM_DIRTY_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led/issi
         SRC += is31fl3743a-mono.c
     endif
 
     ifeq ($(strip $(LED_MATRIX_DRIVER)), is31fl3745)
         I2C_DRIVER_REQUIRED = yes
+        PWM_DIRTY_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led/issi
         SRC += is31fl3745-mono.c
     endif
 
     ifeq ($(strip $(LED_MATRIX_DRIVER)), is31fl3746a)
         I2C_DRIVER_REQUIRED = yes
+        PWM_DIRTY_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led/issi
         SRC += is31fl3746a-mono.c
     endif
 
     ifeq ($(strip $(LED_MATRIX_DRIVER)), snled27351)
         I2C_DRIVER_REQUIRED = yes
+        PWM_DIRTY_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led
         SRC += snled27351-mono.c
     endif
@@ -495,66 +506,77 @@ ifeq ($(strip $(RGB_MATRIX_ENABLE)), yes)
 
     ifeq ($(strip $(RGB_MATRIX_DRIVER)), is31fl3729)
         I2C_DRIVER_REQUIRED = yes
+        PWM_DIRTY_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led/issi
         SRC += is31fl3729.c
     endif
 
     ifeq ($(strip $(RGB_MATRIX_DRIVER)), is31fl3731)
         I2C_DRIVER_REQUIRED = yes
+        PWM_DIRTY_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led/issi
         SRC += is31fl3731.c
     endif
 
     ifeq ($(strip $(RGB_MATRIX_DRIVER)), is31fl3733)
         I2C_DRIVER_REQUIRED = yes
+        PWM_DIRTY_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led/issi
         SRC += is31fl3733.c
     endif
 
     ifeq ($(strip $(RGB_MATRIX_DRIVER)), is31fl3736)
         I2C_DRIVER_REQUIRED = yes
+        PWM_DIRTY_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led/issi
         SRC += is31fl3736.c
     endif
 
     ifeq ($(strip $(RGB_MATRIX_DRIVER)), is31fl3737)
         I2C_DRIVER_REQUIRED = yes
+        PWM_DIRTY_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led/issi
         SRC += is31fl3737.c
     endif
 
     ifeq ($(strip $(RGB_MATRIX_DRIVER)), is31fl3741)
         I2C_DRIVER_REQUIRED = yes
+        PWM_DIRTY_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led/issi
         SRC += is31fl3741.c
     endif
 
     ifeq ($(strip $(RGB_MATRIX_DRIVER)), is31fl3742a)
         I2C_DRIVER_REQUIRED = yes
+        PWM_DIRTY_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led/issi
         SRC += is31fl3742a.c
     endif
 
     ifeq ($(strip $(RGB_MATRIX_DRIVER)), is31fl3743a)
         I2C_DRIVER_REQUIRED = yes
+        PWM_DIRTY_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led/issi
         SRC += is31fl3743a.c
     endif
 
     ifeq ($(strip $(RGB_MATRIX_DRIVER)), is31fl3745)
         I2C_DRIVER_REQUIRED = yes
+        PWM_DIRTY_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led/issi
         SRC += is31fl3745.c
     endif
 
     ifeq ($(strip $(RGB_MATRIX_DRIVER)), is31fl3746a)
         I2C_DRIVER_REQUIRED = yes
+        PWM_DIRTY_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led/issi
         SRC += is31fl3746a.c
     endif
 
     ifeq ($(strip $(RGB_MATRIX_DRIVER)), snled27351)
         I2C_DRIVER_REQUIRED = yes
+        PWM_DIRTY_REQUIRED = yes
         COMMON_VPATH += $(DRIVER_PATH)/led
         SRC += snled27351.c
     endif
@@ -574,6 +596,16 @@ ifeq ($(strip $(RGB_MATRIX_ENABLE)), yes)
     ifeq ($(strip $(RGB_MATRIX_CUSTOM_USER)), yes)
         OPT_DEFS += -DRGB_MATRIX_CUSTOM_USER
     endif
+
+    ifeq ($(strip $(ENABLE_RGB_MATRIX_TIMELINE)), yes)
+        OPT_DEFS += -DENABLE_RGB_MATRIX_TIMELINE
+        SRC += $(QUANTUM_DIR)/rgb_matrix/rgb_matrix_timeline.c
+    endif
+
+    ifeq ($(strip $(RGB_MATRIX_OUTPUT_LUT)), yes)
+        OPT_DEFS += -DRGB_MATRIX_OUTPUT_LUT
+        SRC += $(QUANTUM_DIR)/rgb_matrix/rgb_matrix_output.c
+    endif
 endif
 
 VARIABLE_TRACE ?= no
@@ -628,6 +660,12 @@ ifeq ($(strip $(LED_TABLES)), yes)
     SRC += $(QUANTUM_DIR)/led_tables.c
 endif
 
+ifeq ($(strip $(LED_POWER_ENABLE)), yes)
+    OPT_DEFS += -DLED_POWER_ENABLE
+    COMMON_VPATH += $(QUANTUM_DIR)/led_power
+    SRC += $(QUANTUM_DIR)/led_power/led_power.c
+endif
+
 ifeq ($(strip $(VIA_ENABLE)), yes)
     DYNAMIC_KEYMAP_ENABLE := yes
     RAW_ENABLE := yes
@@ -687,10 +725,21 @@ ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
     # Determine which (if any) transport files are required
     ifneq ($(strip $(SPLIT_TRANSPORT)), custom)
         QUANTUM_SRC += $(QUANTUM_DIR)/split_common/transport.c \
-                       $(QUANTUM_DIR)/split_common/transactions.c
+                       $(QUANTUM_DIR)/split_common/transactions.c \
+                       $(QUANTUM_DIR)/split_common/matrix_delta.c \
+                       $(QUANTUM_DIR)/split_common/transport_batch.c \
+                       $(QUANTUM_DIR)/split_common/split_push.c \
+                       $(QUANTUM_DIR)/split_common/split_blob.c \
+                       $(QUANTUM_DIR)/split_common/split_link.c
 
         OPT_DEFS += -DSPLIT_COMMON_TRANSACTIONS
 
+        ifeq ($(strip $(SPLIT_LINK_STATS_ENABLE)), yes)
+            OPT_DEFS += -DSPLIT_LINK_STATS_ENABLE
+            # Round trips are timed with the profiling clock
+            PROFILING_ENABLE := yes
+        endif
+
         # Functions added via QUANTUM_LIB_SRC are only included in the final binary if they're called.
         # Unused functions are pruned away, which is why we can add multiple drivers here without bloat.
         ifeq ($(PLATFORM),AVR)
@@ -993,6 +1042,11 @@ ifeq ($(strip $(APA102_DRIVER_REQUIRED)), yes)
     SRC += apa102.c
 endif
 
+ifeq ($(strip $(PWM_DIRTY_REQUIRED)), yes)
+    COMMON_VPATH += $(DRIVER_PATH)/led
+    SRC += pwm_dirty.c
+endif
+
 ifeq ($(strip $(ANALOG_DRIVER_REQUIRED)), yes)
     OPT_DEFS += -DHAL_USE_ADC=TRUE
     QUANTUM_LIB_SRC += analog.c
@@ -35,6 +35,7 @@ GENERIC_FEATURES = \
     DYNAMIC_TAPPING_TERM \
     GRAVE_ESC \
     HAPTIC \
+    IDLE_SLEEP \
     KEYCODE_STRING \
     KEY_LOCK \
     KEY_OVERRIDE \
@@ -44,6 +45,7 @@ GENERIC_FEATURES = \
     MOUSEKEY \
     MUSIC \
     OS_DETECTION \
+    PROFILING \
     PROGRAMMABLE_BUTTON \
     REPEAT_KEY \
     SECURE \
@@ -1,10 +1,16 @@
 TEST_LIST = $(sort $(patsubst %/test.mk,%, $(shell find $(ROOT_DIR)tests -type f -name test.mk)))
 FULL_TESTS := $(notdir $(TEST_LIST))
 
+include $(DRIVER_PATH)/led/tests/testlist.mk
 include $(QUANTUM_PATH)/debounce/tests/testlist.mk
+include $(QUANTUM_PATH)/deferred_exec/tests/testlist.mk
 include $(QUANTUM_PATH)/encoder/tests/testlist.mk
+include $(QUANTUM_PATH)/led_power/tests/testlist.mk
+include $(QUANTUM_PATH)/matrix/tests/testlist.mk
 include $(QUANTUM_PATH)/os_detection/tests/testlist.mk
+include $(QUANTUM_PATH)/rgb_matrix/tests/testlist.mk
 include $(QUANTUM_PATH)/sequencer/tests/testlist.mk
+include $(QUANTUM_PATH)/split_common/tests/testlist.mk
 include $(QUANTUM_PATH)/wear_leveling/tests/testlist.mk
 include $(PLATFORM_PATH)/test/testlist.mk
 
@@ -17,6 +17,7 @@
 
 #include "is31fl3736.h"
 #include "i2c_master.h"
+#include "pwm_dirty.h"
 #include "gpio.h"
 #include "wait.h"
 
@@ -63,19 +64,18 @@ const uint8_t i2c_addresses[IS31FL3736_DRIVER_COUNT] = {
 // These buffers match the IS31FL3736 PWM registers.
 // The control buffers match the page 0 LED On/Off registers.
 // Storing them like this is optimal for I2C transfers to the registers.
-// We could optimize this and take out the unused registers from these
-// buffers and the transfers in is31fl3736_write_pwm_buffer() but it's
-// probably not worth the extra complexity.
+// Only the registers marked in pwm_buffer_dirty are transferred, so the
+// unused ones cost RAM but no bus time.
 typedef struct is31fl3736_driver_t {
     uint8_t pwm_buffer[IS31FL3736_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
+    uint8_t pwm_buffer_dirty[PWM_DIRTY_SIZE(IS31FL3736_PWM_REGISTER_COUNT)];
     uint8_t led_control_buffer[IS31FL3736_LED_CONTROL_REGISTER_COUNT];
     bool    led_control_buffer_dirty;
 } PACKED is31fl3736_driver_t;
 
 is31fl3736_driver_t driver_buffers[IS31FL3736_DRIVER_COUNT] = {{
     .pwm_buffer               = {0},
-    .pwm_buffer_dirty         = false,
+    .pwm_buffer_dirty         = {0},
     .led_control_buffer       = {0},
     .led_control_buffer_dirty = false,
 }};
@@ -95,20 +95,20 @@ void is31fl3736_select_page(uint8_t index, uint8_t page) {
     is31fl3736_write_register(index, IS31FL3736_REG_COMMAND, page);
 }
 
-void is31fl3736_write_pwm_buffer(uint8_t index) {
-    // Assumes page 1 is already selected.
-    // Transmit PWM registers in 12 transfers of 16 bytes.
-
-    // Iterate over the pwm_buffer contents at 16 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3736_PWM_REGISTER_COUNT; i += 16) {
+static void is31fl3736_write_pwm_run(uint8_t index, uint8_t offset, uint8_t length) {
 #if IS31FL3736_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < IS31FL3736_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer + i, 16, IS31FL3736_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
+    for (uint8_t i = 0; i < IS31FL3736_I2C_PERSISTENCE; i++) {
+        if (i2c_write_register(i2c_addresses[index] << 1, offset, driver_buffers[index].pwm_buffer + offset, length, IS31FL3736_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+    }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer + i, 16, IS31FL3736_I2C_TIMEOUT);
+    i2c_write_register(i2c_addresses[index] << 1, offset, driver_buffers[index].pwm_buffer + offset, length, IS31FL3736_I2C_TIMEOUT);
 #endif
-    }
+}
+
+void is31fl3736_write_pwm_buffer(uint8_t index) {
+    // Assumes page 1 is already selected.
+    // Transmit the changed PWM registers in transfers of at most 16 bytes.
+    pwm_dirty_flush(driver_buffers[index].pwm_buffer_dirty, IS31FL3736_PWM_REGISTER_COUNT, 16, index, is31fl3736_write_pwm_run);
 }
 
 void is31fl3736_init_drivers(void) {
@@ -181,7 +181,9 @@ void is31fl3736_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         driver_buffers[led.driver].pwm_buffer[led.r] = red;
         driver_buffers[led.driver].pwm_buffer[led.g] = green;
         driver_buffers[led.driver].pwm_buffer[led.b] = blue;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        pwm_dirty_set(driver_buffers[led.driver].pwm_buffer_dirty, led.r);
+        pwm_dirty_set(driver_buffers[led.driver].pwm_buffer_dirty, led.g);
+        pwm_dirty_set(driver_buffers[led.driver].pwm_buffer_dirty, led.b);
     }
 }
 
@@ -229,12 +231,10 @@ void is31fl3736_set_led_control_register(uint8_t index, bool red, bool green, bo
 }
 
 void is31fl3736_update_pwm_buffers(uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
+    if (pwm_dirty_any(driver_buffers[index].pwm_buffer_dirty, IS31FL3736_PWM_REGISTER_COUNT)) {
         is31fl3736_select_page(index, IS31FL3736_COMMAND_PWM);
 
         is31fl3736_write_pwm_buffer(index);
-
-        driver_buffers[index].pwm_buffer_dirty = false;
     }
 }
 
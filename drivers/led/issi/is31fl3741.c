@@ -19,6 +19,7 @@
 
 #include "is31fl3741.h"
 #include "i2c_master.h"
+#include "pwm_dirty.h"
 #include "gpio.h"
 #include "wait.h"
 
@@ -71,13 +72,13 @@ const uint8_t i2c_addresses[IS31FL3741_DRIVER_COUNT] = {
 // These buffers match the IS31FL3741 and IS31FL3741A PWM registers.
 // The scaling buffers match the page 2 and 3 LED On/Off registers.
 // Storing them like this is optimal for I2C transfers to the registers.
-// We could optimize this and take out the unused registers from these
-// buffers and the transfers in is31fl3741_write_pwm_buffer() but it's
-// probably not worth the extra complexity.
+// Only the registers marked in the dirty bitmaps are transferred, so the
+// unused ones cost RAM but no bus time.
 typedef struct is31fl3741_driver_t {
     uint8_t pwm_buffer_0[IS31FL3741_PWM_0_REGISTER_COUNT];
     uint8_t pwm_buffer_1[IS31FL3741_PWM_1_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
+    uint8_t pwm_buffer_0_dirty[PWM_DIRTY_SIZE(IS31FL3741_PWM_0_REGISTER_COUNT)];
+    uint8_t pwm_buffer_1_dirty[PWM_DIRTY_SIZE(IS31FL3741_PWM_1_REGISTER_COUNT)];
     uint8_t scaling_buffer_0[IS31FL3741_SCALING_0_REGISTER_COUNT];
     uint8_t scaling_buffer_1[IS31FL3741_SCALING_1_REGISTER_COUNT];
     bool    scaling_buffer_dirty;
@@ -86,7 +87,8 @@ typedef struct is31fl3741_driver_t {
 is31fl3741_driver_t driver_buffers[IS31FL3741_DRIVER_COUNT] = {{
     .pwm_buffer_0         = {0},
     .pwm_buffer_1         = {0},
-    .pwm_buffer_dirty     = false,
+    .pwm_buffer_0_dirty   = {0},
+    .pwm_buffer_1_dirty   = {0},
     .scaling_buffer_0     = {0},
     .scaling_buffer_1     = {0},
     .scaling_buffer_dirty = false,
@@ -107,35 +109,39 @@ void is31fl3741_select_page(uint8_t index, uint8_t page) {
     is31fl3741_write_register(index, IS31FL3741_REG_COMMAND, page);
 }
 
-void is31fl3741_write_pwm_buffer(uint8_t index) {
-    is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_0);
-
-    // Transmit PWM0 registers in 6 transfers of 30 bytes.
-
-    // Iterate over the pwm_buffer_0 contents at 30 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3741_PWM_0_REGISTER_COUNT; i += 30) {
+static void is31fl3741_write_pwm_0_run(uint8_t index, uint8_t offset, uint8_t length) {
 #if IS31FL3741_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < IS31FL3741_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, 30, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
+    for (uint8_t i = 0; i < IS31FL3741_I2C_PERSISTENCE; i++) {
+        if (i2c_write_register(i2c_addresses[index] << 1, offset, driver_buffers[index].pwm_buffer_0 + offset, length, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+    }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, 30, IS31FL3741_I2C_TIMEOUT);
+    i2c_write_register(i2c_addresses[index] << 1, offset, driver_buffers[index].pwm_buffer_0 + offset, length, IS31FL3741_I2C_TIMEOUT);
 #endif
-    }
-
-    is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_1);
-
-    // Transmit PWM1 registers in 9 transfers of 19 bytes.
+}
 
-    // Iterate over the pwm_buffer_1 contents at 19 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3741_PWM_1_REGISTER_COUNT; i += 19) {
+static void is31fl3741_write_pwm_1_run(uint8_t index, uint8_t offset, uint8_t length) {
 #if IS31FL3741_I2C_PERSISTENCE > 0
-        for (uint8_t i = 0; i < IS31FL3741_I2C_PERSISTENCE; i++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
+    for (uint8_t i = 0; i < IS31FL3741_I2C_PERSISTENCE; i++) {
+        if (i2c_write_register(i2c_addresses[index] << 1, offset, driver_buffers[index].pwm_buffer_1 + offset, length, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+    }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT);
+    i2c_write_register(i2c_addresses[index] << 1, offset, driver_buffers[index].pwm_buffer_1 + offset, length, IS31FL3741_I2C_TIMEOUT);
 #endif
+}
+
+void is31fl3741_write_pwm_buffer(uint8_t index) {
+    if (pwm_dirty_any(driver_buffers[index].pwm_buffer_0_dirty, IS31FL3741_PWM_0_REGISTER_COUNT)) {
+        is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_0);
+
+        // Transmit the changed PWM0 registers in transfers of at most 30 bytes.
+        pwm_dirty_flush(driver_buffers[index].pwm_buffer_0_dirty, IS31FL3741_PWM_0_REGISTER_COUNT, 30, index, is31fl3741_write_pwm_0_run);
+    }
+
+    if (pwm_dirty_any(driver_buffers[index].pwm_buffer_1_dirty, IS31FL3741_PWM_1_REGISTER_COUNT)) {
+        is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_1);
+
+        // Transmit the changed PWM1 registers in transfers of at most 19 bytes.
+        pwm_dirty_flush(driver_buffers[index].pwm_buffer_1_dirty, IS31FL3741_PWM_1_REGISTER_COUNT, 19, index, is31fl3741_write_pwm_1_run);
     }
 }
 
@@ -196,8 +202,10 @@ uint8_t get_pwm_value(uint8_t driver, uint16_t reg) {
 void set_pwm_value(uint8_t driver, uint16_t reg, uint8_t value) {
     if (reg & 0x100) {
         driver_buffers[driver].pwm_buffer_1[reg & 0xFF] = value;
+        pwm_dirty_set(driver_buffers[driver].pwm_buffer_1_dirty, reg & 0xFF);
     } else {
         driver_buffers[driver].pwm_buffer_0[reg] = value;
+        pwm_dirty_set(driver_buffers[driver].pwm_buffer_0_dirty, reg);
     }
 }
 
@@ -214,7 +222,6 @@ void is31fl3741_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         set_pwm_value(led.driver, led.r, red);
         set_pwm_value(led.driver, led.g, green);
         set_pwm_value(led.driver, led.b, blue);
-        driver_buffers[led.driver].pwm_buffer_dirty = true;
     }
 }
 
@@ -244,18 +251,13 @@ void is31fl3741_set_led_control_register(uint8_t index, bool red, bool green, bo
 }
 
 void is31fl3741_update_pwm_buffers(uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
-        is31fl3741_write_pwm_buffer(index);
-
-        driver_buffers[index].pwm_buffer_dirty = false;
-    }
+    is31fl3741_write_pwm_buffer(index);
 }
 
 void is31fl3741_set_pwm_buffer(const is31fl3741_led_t *pled, uint8_t red, uint8_t green, uint8_t blue) {
     set_pwm_value(pled->driver, pled->r, red);
     set_pwm_value(pled->driver, pled->g, green);
     set_pwm_value(pled->driver, pled->b, blue);
-    driver_buffers[pled->driver].pwm_buffer_dirty = true;
 }
 
 void is31fl3741_update_led_control_registers(uint8_t index) {
@@ -20,6 +20,7 @@
 
 #include "is31fl3742a-mono.h"
 #include "i2c_master.h"
+#include "pwm_dirty.h"
 #include "gpio.h"
 #include "wait.h"
 
@@ -69,14 +70,14 @@ const uint8_t i2c_addresses[IS31FL3742A_DRIVER_COUNT] = {
 
 typedef struct is31fl3742a_driver_t {
     uint8_t pwm_buffer[IS31FL3742A_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
+    uint8_t pwm_buffer_dirty[PWM_DIRTY_SIZE(IS31FL3742A_PWM_REGISTER_COUNT)];
     uint8_t scaling_buffer[IS31FL3742A_SCALING_REGISTER_COUNT];
     bool    scaling_buffer_dirty;
 } PACKED is31fl3742a_driver_t;
 
 is31fl3742a_driver_t driver_buffers[IS31FL3742A_DRIVER_COUNT] = {{
     .pwm_buffer           = {0},
-    .pwm_buffer_dirty     = false,
+    .pwm_buffer_dirty     = {0},
     .scaling_buffer       = {0},
     .scaling_buffer_dirty = false,
 }};
@@ -96,20 +97,20 @@ void is31fl3742a_select_page(uint8_t index, uint8_t page) {
     is31fl3742a_write_register(index, IS31FL3742A_REG_COMMAND, page);
 }
 
-void is31fl3742a_write_pwm_buffer(uint8_t index) {
-    // Assumes page 0 is already selected.
-    // Transmit PWM registers in 6 transfers of 30 bytes.
-
-    // Iterate over the pwm_buffer contents at 30 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3742A_PWM_REGISTER_COUNT; i += 30) {
+static void is31fl3742a_write_pwm_run(uint8_t index, uint8_t offset, uint8_t length) {
 #if IS31FL3742A_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < IS31FL3742A_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer + i, 30, IS31FL3742A_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
+    for (uint8_t i = 0; i < IS31FL3742A_I2C_PERSISTENCE; i++) {
+        if (i2c_write_register(i2c_addresses[index] << 1, offset, driver_buffers[index].pwm_buffer + offset, length, IS31FL3742A_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+    }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer + i, 30, IS31FL3742A_I2C_TIMEOUT);
+    i2c_write_register(i2c_addresses[index] << 1, offset, driver_buffers[index].pwm_buffer + offset, length, IS31FL3742A_I2C_TIMEOUT);
 #endif
-    }
+}
+
+void is31fl3742a_write_pwm_buffer(uint8_t index) {
+    // Assumes page 0 is already selected.
+    // Transmit the changed PWM registers in transfers of at most 30 bytes.
+    pwm_dirty_flush(driver_buffers[index].pwm_buffer_dirty, IS31FL3742A_PWM_REGISTER_COUNT, 30, index, is31fl3742a_write_pwm_run);
 }
 
 void is31fl3742a_init_drivers(void) {
@@ -174,7 +175,7 @@ void is31fl3742a_set_value(int index, uint8_t value) {
         }
 
         driver_buffers[led.driver].pwm_buffer[led.v] = value;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        pwm_dirty_set(driver_buffers[led.driver].pwm_buffer_dirty, led.v);
     }
 }
 
@@ -193,12 +194,10 @@ void is31fl3742a_set_scaling_register(uint8_t index, uint8_t value) {
 }
 
 void is31fl3742a_update_pwm_buffers(uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
+    if (pwm_dirty_any(driver_buffers[index].pwm_buffer_dirty, IS31FL3742A_PWM_REGISTER_COUNT)) {
         is31fl3742a_select_page(index, IS31FL3742A_COMMAND_PWM);
 
         is31fl3742a_write_pwm_buffer(index);
-
-        driver_buffers[index].pwm_buffer_dirty = false;
     }
 }
 
@@ -0,0 +1,49 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "pwm_dirty.h"
+
+static inline bool pwm_dirty_get(const uint8_t *dirty, uint8_t reg) {
+    return dirty[reg / 8] & (1 << (reg % 8));
+}
+
+bool pwm_dirty_any(const uint8_t *dirty, uint8_t count) {
+    for (uint8_t i = 0; i < PWM_DIRTY_SIZE(count); i++) {
+        if (dirty[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void pwm_dirty_flush(uint8_t *dirty, uint8_t count, uint8_t max_length, uint8_t index, pwm_dirty_write_t write) {
+    uint8_t reg = 0;
+    while (reg < count) {
+        // Skip whole bytes of unchanged registers
+        if (reg % 8 == 0 && dirty[reg / 8] == 0) {
+            reg += 8;
+            continue;
+        }
+        if (!pwm_dirty_get(dirty, reg)) {
+            reg++;
+            continue;
+        }
+
+        // Extend the run until the gap since its last marked register gets too long
+        uint8_t start = reg;
+        uint8_t end   = reg + 1;
+        for (reg = end; reg < count && reg - start < max_length; reg++) {
+            if (pwm_dirty_get(dirty, reg)) {
+                end = reg + 1;
+            } else if (reg - end >= PWM_DIRTY_MAX_GAP) {
+                break;
+            }
+        }
+
+        write(index, start, end - start);
+        reg = end;
+    }
+
+    memset(dirty, 0, PWM_DIRTY_SIZE(count));
+}
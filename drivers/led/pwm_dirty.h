@@ -0,0 +1,46 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Tracks which registers of an LED driver PWM buffer changed since the last
+    flush, one bit per register, so that only those are sent over I2C.
+*/
+
+/* Longest run of unchanged registers still sent along with its neighbours,
+   instead of starting a new transfer (device address + register address). */
+#ifndef PWM_DIRTY_MAX_GAP
+#    define PWM_DIRTY_MAX_GAP 2
+#endif
+
+/* Size in bytes of the bitmap for `count` registers. */
+#define PWM_DIRTY_SIZE(count) (((count) + 7) / 8)
+
+/**
+ * @brief Transfers one run of registers, called by pwm_dirty_flush().
+ *
+ * @param index the driver index
+ * @param offset the first register of the run, relative to the start of the PWM buffer
+ * @param length the number of registers in the run
+ */
+typedef void (*pwm_dirty_write_t)(uint8_t index, uint8_t offset, uint8_t length);
+
+/** @brief Marks register `reg` as changed. */
+static inline void pwm_dirty_set(uint8_t *dirty, uint8_t reg) {
+    dirty[reg / 8] |= 1 << (reg % 8);
+}
+
+/** @return true if any of the first `count` registers is marked */
+bool pwm_dirty_any(const uint8_t *dirty, uint8_t count);
+
+/**
+ * @brief Calls `write` for the minimal runs of registers covering all marked ones, then clears the marks.
+ *
+ * Runs are merged across at most PWM_DIRTY_MAX_GAP unchanged registers and
+ * split so that none is longer than `max_length`.
+ */
+void pwm_dirty_flush(uint8_t *dirty, uint8_t count, uint8_t max_length, uint8_t index, pwm_dirty_write_t write);
@@ -16,6 +16,7 @@
 
 #include "snled27351-mono.h"
 #include "i2c_master.h"
+#include "pwm_dirty.h"
 #include "gpio.h"
 
 #define SNLED27351_PWM_REGISTER_COUNT 192
@@ -54,19 +55,18 @@ const uint8_t i2c_addresses[SNLED27351_DRIVER_COUNT] = {
 // These buffers match the SNLED27351 PWM registers.
 // The control buffers match the PG0 LED On/Off registers.
 // Storing them like this is optimal for I2C transfers to the registers.
-// We could optimize this and take out the unused registers from these
-// buffers and the transfers in snled27351_write_pwm_buffer() but it's
-// probably not worth the extra complexity.
+// Only the registers marked in pwm_buffer_dirty are transferred, so the
+// unused ones cost RAM but no bus time.
 typedef struct snled27351_driver_t {
     uint8_t pwm_buffer[SNLED27351_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
+    uint8_t pwm_buffer_dirty[PWM_DIRTY_SIZE(SNLED27351_PWM_REGISTER_COUNT)];
     uint8_t led_control_buffer[SNLED27351_LED_CONTROL_REGISTER_COUNT];
     bool    led_control_buffer_dirty;
 } PACKED snled27351_driver_t;
 
 snled27351_driver_t driver_buffers[SNLED27351_DRIVER_COUNT] = {{
     .pwm_buffer               = {0},
-    .pwm_buffer_dirty         = false,
+    .pwm_buffer_dirty         = {0},
     .led_control_buffer       = {0},
     .led_control_buffer_dirty = false,
 }};
@@ -85,20 +85,20 @@ void snled27351_select_page(uint8_t index, uint8_t page) {
     snled27351_write_register(index, SNLED27351_REG_COMMAND, page);
 }
 
-void snled27351_write_pwm_buffer(uint8_t index) {
-    // Assumes PG1 is already selected.
-    // Transmit PWM registers in 12 transfers of 16 bytes.
-
-    // Iterate over the pwm_buffer contents at 16 byte intervals.
-    for (uint8_t i = 0; i < SNLED27351_PWM_REGISTER_COUNT; i += 16) {
+static void snled27351_write_pwm_run(uint8_t index, uint8_t offset, uint8_t length) {
 #if SNLED27351_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < SNLED27351_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer + i, 16, SNLED27351_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
+    for (uint8_t i = 0; i < SNLED27351_I2C_PERSISTENCE; i++) {
+        if (i2c_write_register(i2c_addresses[index] << 1, offset, driver_buffers[index].pwm_buffer + offset, length, SNLED27351_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+    }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer + i, 16, SNLED27351_I2C_TIMEOUT);
+    i2c_write_register(i2c_addresses[index] << 1, offset, driver_buffers[index].pwm_buffer + offset, length, SNLED27351_I2C_TIMEOUT);
 #endif
-    }
+}
+
+void snled27351_write_pwm_buffer(uint8_t index) {
+    // Assumes PG1 is already selected.
+    // Transmit the changed PWM registers in transfers of at most 16 bytes.
+    pwm_dirty_flush(driver_buffers[index].pwm_buffer_dirty, SNLED27351_PWM_REGISTER_COUNT, 16, index, snled27351_write_pwm_run);
 }
 
 void snled27351_init_drivers(void) {
@@ -179,7 +179,7 @@ void snled27351_set_value(int index, uint8_t value) {
         }
 
         driver_buffers[led.driver].pwm_buffer[led.v] = value;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        pwm_dirty_set(driver_buffers[led.driver].pwm_buffer_dirty, led.v);
     }
 }
 
@@ -206,12 +206,10 @@ void snled27351_set_led_control_register(uint8_t index, bool value) {
 }
 
 void snled27351_update_pwm_buffers(uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
+    if (pwm_dirty_any(driver_buffers[index].pwm_buffer_dirty, SNLED27351_PWM_REGISTER_COUNT)) {
         snled27351_select_page(index, SNLED27351_COMMAND_PWM);
 
         snled27351_write_pwm_buffer(index);
-
-        driver_buffers[index].pwm_buffer_dirty = false;
     }
 }
 
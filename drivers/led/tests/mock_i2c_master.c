@@ -0,0 +1,65 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "i2c_master.h"
+#include "mock_i2c_master.h"
+
+/* Paged register file of the IS31FL37xx family, selected through the command register. */
+#define MOCK_I2C_DEVICES 128
+#define MOCK_I2C_PAGES 4
+#define MOCK_I2C_REG_COMMAND 0xFD
+
+static uint8_t             registers[MOCK_I2C_DEVICES][MOCK_I2C_PAGES][256];
+static uint8_t             pages[MOCK_I2C_DEVICES];
+static mock_i2c_transfer_t transfers[MOCK_I2C_MAX_TRANSFERS];
+static uint16_t            transfer_count;
+static uint32_t            bytes;
+
+void i2c_init(void) {}
+
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    uint8_t address = devaddr >> 1;
+
+    if (transfer_count < MOCK_I2C_MAX_TRANSFERS) {
+        transfers[transfer_count++] = (mock_i2c_transfer_t){address, regaddr, (uint8_t)length};
+    }
+    bytes += 2 + length;
+
+    for (uint16_t i = 0; i < length; i++) {
+        uint8_t reg = regaddr + i;
+        if (reg == MOCK_I2C_REG_COMMAND) {
+            pages[address] = data[i] % MOCK_I2C_PAGES;
+        } else {
+            registers[address][pages[address]][reg] = data[i];
+        }
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+void mock_i2c_clear_log(void) {
+    transfer_count = 0;
+    bytes          = 0;
+}
+
+void mock_i2c_reset(void) {
+    memset(registers, 0, sizeof(registers));
+    memset(pages, 0, sizeof(pages));
+    mock_i2c_clear_log();
+}
+
+uint16_t mock_i2c_transfer_count(void) {
+    return transfer_count;
+}
+
+const mock_i2c_transfer_t *mock_i2c_transfer(uint16_t index) {
+    return &transfers[index];
+}
+
+uint32_t mock_i2c_bytes(void) {
+    return bytes;
+}
+
+uint8_t mock_i2c_register(uint8_t address, uint8_t page, uint8_t reg) {
+    return registers[address][page][reg];
+}
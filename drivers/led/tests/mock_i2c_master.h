@@ -0,0 +1,28 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+/* One register write on the simulated bus. */
+typedef struct {
+    uint8_t address;
+    uint8_t reg;
+    uint8_t length;
+} mock_i2c_transfer_t;
+
+#define MOCK_I2C_MAX_TRANSFERS 1024
+
+/* Clears the transfer log, but keeps the register contents. */
+void mock_i2c_clear_log(void);
+/* Clears the transfer log and all register contents. */
+void mock_i2c_reset(void);
+
+uint16_t                   mock_i2c_transfer_count(void);
+const mock_i2c_transfer_t *mock_i2c_transfer(uint16_t index);
+/* Bytes sent since the last clear: the device address, register address and data of every transfer. */
+uint32_t mock_i2c_bytes(void);
+
+/* Contents of register `reg` on page `page` of the device at 7-bit `address`. */
+uint8_t mock_i2c_register(uint8_t address, uint8_t page, uint8_t reg);
@@ -0,0 +1,210 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "is31fl3733.h"
+#include "pwm_dirty.h"
+#include "mock_i2c_master.h"
+}
+
+#define ADDRESS_1 IS31FL3733_I2C_ADDRESS_1
+#define ADDRESS_2 IS31FL3733_I2C_ADDRESS_2
+
+// clang-format off
+const is31fl3733_led_t PROGMEM g_is31fl3733_leds[IS31FL3733_LED_COUNT] = {
+    {0, SW1_CS1, SW2_CS1, SW3_CS1},
+    {0, SW1_CS2, SW2_CS2, SW3_CS2},
+    {0, SW1_CS3, SW2_CS3, SW3_CS3},
+    {0, SW1_CS4, SW2_CS4, SW3_CS4},
+    {0, SW1_CS5, SW2_CS5, SW3_CS5},
+    {0, SW1_CS6, SW2_CS6, SW3_CS6},
+    {0, SW1_CS7, SW2_CS7, SW3_CS7},
+    {0, SW1_CS8, SW2_CS8, SW3_CS8},
+    {0, SW1_CS12, SW2_CS12, SW3_CS12},
+    {1, SW1_CS1, SW2_CS1, SW3_CS1},
+};
+// clang-format on
+
+struct PwmRun {
+    uint8_t offset;
+    uint8_t length;
+
+    bool operator==(const PwmRun &other) const {
+        return offset == other.offset && length == other.length;
+    }
+};
+
+static std::vector<PwmRun> runs;
+
+static void record_run(uint8_t index, uint8_t offset, uint8_t length) {
+    runs.push_back({offset, length});
+}
+
+class PwmDirty : public ::testing::Test {
+   protected:
+    uint8_t dirty[PWM_DIRTY_SIZE(64)] = {0};
+
+    void SetUp() override {
+        runs.clear();
+    }
+
+    std::vector<PwmRun> flush(uint8_t max_length = 16) {
+        runs.clear();
+        pwm_dirty_flush(dirty, 64, max_length, 0, record_run);
+        return runs;
+    }
+};
+
+TEST_F(PwmDirty, NothingMarked) {
+    EXPECT_FALSE(pwm_dirty_any(dirty, 64));
+    EXPECT_TRUE(flush().empty());
+}
+
+TEST_F(PwmDirty, AdjacentRegistersFormOneRun) {
+    for (uint8_t reg = 5; reg < 12; reg++) {
+        pwm_dirty_set(dirty, reg);
+    }
+    EXPECT_TRUE(pwm_dirty_any(dirty, 64));
+    EXPECT_EQ(flush(), (std::vector<PwmRun>{{5, 7}}));
+    EXPECT_FALSE(pwm_dirty_any(dirty, 64));
+}
+
+TEST_F(PwmDirty, ShortGapsAreMerged) {
+    pwm_dirty_set(dirty, 0);
+    pwm_dirty_set(dirty, 1 + PWM_DIRTY_MAX_GAP);
+    pwm_dirty_set(dirty, 2 + 2 * PWM_DIRTY_MAX_GAP + 1);
+    EXPECT_EQ(flush(), (std::vector<PwmRun>{{0, 2 + PWM_DIRTY_MAX_GAP}, {2 + 2 * PWM_DIRTY_MAX_GAP + 1, 1}}));
+}
+
+TEST_F(PwmDirty, RunsAreSplitAtMaxLength) {
+    for (uint8_t reg = 0; reg < 40; reg++) {
+        pwm_dirty_set(dirty, reg);
+    }
+    pwm_dirty_set(dirty, 63);
+    EXPECT_EQ(flush(16), (std::vector<PwmRun>{{0, 16}, {16, 16}, {32, 8}, {63, 1}}));
+}
+
+TEST_F(PwmDirty, TrailingGapIsNotSent) {
+    pwm_dirty_set(dirty, 14);
+    pwm_dirty_set(dirty, 15);
+    EXPECT_EQ(flush(16), (std::vector<PwmRun>{{14, 2}}));
+}
+
+class Is31fl3733Flush : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock_i2c_reset();
+        is31fl3733_init_drivers();
+        // Start every test from a dark, fully flushed state.
+        is31fl3733_set_color_all(0, 0, 0);
+        is31fl3733_flush();
+        mock_i2c_clear_log();
+    }
+
+    /* Bytes of PWM data, without the page selection and transfer overhead. */
+    uint32_t pwm_data_bytes(uint8_t address) {
+        uint32_t data = 0;
+        for (uint16_t i = 0; i < mock_i2c_transfer_count(); i++) {
+            const mock_i2c_transfer_t *transfer = mock_i2c_transfer(i);
+            if (transfer->address == address && transfer->reg < 0xC0) {
+                data += transfer->length;
+            }
+        }
+        return data;
+    }
+
+    void expect_led(uint8_t index, uint8_t red, uint8_t green, uint8_t blue) {
+        is31fl3733_led_t led    = g_is31fl3733_leds[index];
+        uint8_t          device = led.driver ? ADDRESS_2 : ADDRESS_1;
+        EXPECT_EQ(mock_i2c_register(device, IS31FL3733_COMMAND_PWM, led.r), red) << "LED " << +index;
+        EXPECT_EQ(mock_i2c_register(device, IS31FL3733_COMMAND_PWM, led.g), green) << "LED " << +index;
+        EXPECT_EQ(mock_i2c_register(device, IS31FL3733_COMMAND_PWM, led.b), blue) << "LED " << +index;
+    }
+};
+
+TEST_F(Is31fl3733Flush, NothingChangedNothingSent) {
+    is31fl3733_flush();
+    EXPECT_EQ(mock_i2c_bytes(), 0);
+
+    is31fl3733_set_color(3, 0, 0, 0);
+    is31fl3733_flush();
+    EXPECT_EQ(mock_i2c_bytes(), 0);
+}
+
+TEST_F(Is31fl3733Flush, SingleLedSendsOnlyItsRegisters) {
+    is31fl3733_set_color(0, 10, 20, 30);
+    is31fl3733_flush();
+
+    // Page selection (2 writes) and one single register write per channel.
+    EXPECT_EQ(mock_i2c_transfer_count(), 5);
+    EXPECT_EQ(pwm_data_bytes(ADDRESS_1), 3);
+    EXPECT_EQ(mock_i2c_bytes(), 2 * 3 + 3 * 3);
+    EXPECT_EQ(pwm_data_bytes(ADDRESS_2), 0);
+    expect_led(0, 10, 20, 30);
+}
+
+TEST_F(Is31fl3733Flush, AdjacentLedsShareTransfers) {
+    for (uint8_t i = 0; i < 8; i++) {
+        is31fl3733_set_color(i, i, i + 1, i + 2);
+    }
+    is31fl3733_flush();
+
+    EXPECT_EQ(mock_i2c_transfer_count(), 2 + 3);
+    EXPECT_EQ(pwm_data_bytes(ADDRESS_1), 3 * 8);
+    for (uint8_t i = 0; i < 8; i++) {
+        expect_led(i, i, i + 1, i + 2);
+    }
+}
+
+TEST_F(Is31fl3733Flush, OnlyTheChangedDriverIsWritten) {
+    is31fl3733_set_color(9, 1, 2, 3);
+    is31fl3733_flush();
+
+    for (uint16_t i = 0; i < mock_i2c_transfer_count(); i++) {
+        EXPECT_EQ(mock_i2c_transfer(i)->address, ADDRESS_2);
+    }
+    expect_led(9, 1, 2, 3);
+}
+
+TEST_F(Is31fl3733Flush, FullFrameIsCheaperThanWholePage) {
+    is31fl3733_set_color_all(255, 128, 64);
+    is31fl3733_flush();
+
+    // Previously 12 transfers of 16 bytes, per driver.
+    uint32_t whole_pages = 2 * (2 * 3 + 12 * (2 + 16));
+    EXPECT_LT(mock_i2c_bytes(), whole_pages);
+    for (uint8_t i = 0; i < IS31FL3733_LED_COUNT; i++) {
+        expect_led(i, 255, 128, 64);
+    }
+}
+
+TEST_F(Is31fl3733Flush, RandomFramesMirrorTheBuffer) {
+    uint8_t  colors[IS31FL3733_LED_COUNT][3] = {{0}};
+    uint32_t seed                            = 12345;
+    auto     next                            = [&seed]() {
+        seed = seed * 1103515245 + 12345;
+        return (uint8_t)(seed >> 16);
+    };
+
+    for (int frame = 0; frame < 200; frame++) {
+        for (int change = next() % 6; change > 0; change--) {
+            uint8_t led = next() % IS31FL3733_LED_COUNT;
+            for (uint8_t c = 0; c < 3; c++) {
+                colors[led][c] = next();
+            }
+            is31fl3733_set_color(led, colors[led][0], colors[led][1], colors[led][2]);
+        }
+        is31fl3733_flush();
+
+        for (uint8_t led = 0; led < IS31FL3733_LED_COUNT; led++) {
+            expect_led(led, colors[led][0], colors[led][1], colors[led][2]);
+        }
+        for (uint16_t i = 0; i < mock_i2c_transfer_count(); i++) {
+            EXPECT_LE(mock_i2c_transfer(i)->length, 16);
+        }
+        mock_i2c_clear_log();
+    }
+}
@@ -0,0 +1,21 @@
+pwm_dirty_CONFIG := $(DRIVER_PATH)/led/tests/config_is31fl3733.h
+pwm_dirty_INC := $(DRIVER_PATH)/led $(DRIVER_PATH)/led/issi
+
+pwm_dirty_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(DRIVER_PATH)/led/pwm_dirty.c \
+	$(DRIVER_PATH)/led/issi/is31fl3733.c \
+	$(DRIVER_PATH)/led/tests/mock_i2c_master.c \
+	$(DRIVER_PATH)/led/tests/pwm_dirty_tests.cpp
+
+ws2812_encode_DEFS := -DWS2812_PWM_BUFFER_TYPE=uint16_t
+ws2812_encode_INC := $(DRIVER_PATH)/led
+
+ws2812_encode_SRC := \
+	$(DRIVER_PATH)/led/tests/ws2812_encode_tests.cpp
+
+ws2812_encode_bgrw_DEFS := -DWS2812_PWM_BUFFER_TYPE=uint32_t -DWS2812_BYTE_ORDER=WS2812_BYTE_ORDER_BGR -DWS2812_RGBW
+ws2812_encode_bgrw_INC := $(DRIVER_PATH)/led
+
+ws2812_encode_bgrw_SRC := \
+	$(DRIVER_PATH)/led/tests/ws2812_encode_tests.cpp
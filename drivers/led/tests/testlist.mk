@@ -0,0 +1,2 @@
+TEST_LIST += pwm_dirty
+TEST_LIST += ws2812_encode ws2812_encode_bgrw
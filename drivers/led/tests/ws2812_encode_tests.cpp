@@ -0,0 +1,133 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "ws2812_encode.h"
+}
+
+#define LED_COUNT 256
+#define DUTYCYCLE_0 0x0123
+#define DUTYCYCLE_1 0x0456
+
+/* The encoders as they were before the lookup tables, one branch per bit, with
+   each channel placed by byte order rather than by ws2812_led_t. */
+
+#if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
+enum { RED = 1, GREEN = 0, BLUE = 2 };
+#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
+enum { RED = 0, GREEN = 1, BLUE = 2 };
+#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_BGR)
+enum { RED = 2, GREEN = 1, BLUE = 0 };
+#endif
+enum { WHITE = 3 };
+
+static uint8_t reference_spi_byte(uint8_t data, int pos) {
+    uint8_t eq = 0;
+    if (data & (1 << (2 * (3 - pos))))
+        eq = 0b1110;
+    else
+        eq = 0b1000;
+    if (data & (2 << (2 * (3 - pos))))
+        eq += 0b11100000;
+    else
+        eq += 0b10000000;
+    return eq;
+}
+
+static std::vector<uint8_t> reference_spi(const ws2812_led_t *leds, uint16_t count) {
+    std::vector<uint8_t> out(count * WS2812_SPI_BYTES_PER_LED);
+    for (uint16_t led = 0; led < count; led++) {
+        uint8_t *tx = &out[WS2812_SPI_BYTES_PER_LED * led];
+        for (int j = 0; j < 4; j++) {
+            tx[4 * RED + j]   = reference_spi_byte(leds[led].r, j);
+            tx[4 * GREEN + j] = reference_spi_byte(leds[led].g, j);
+            tx[4 * BLUE + j]  = reference_spi_byte(leds[led].b, j);
+#ifdef WS2812_RGBW
+            tx[4 * WHITE + j] = reference_spi_byte(leds[led].w, j);
+#endif
+        }
+    }
+    return out;
+}
+
+static std::vector<ws2812_pwm_t> reference_pwm(const ws2812_led_t *leds, uint16_t count) {
+    const size_t              color_bits = 8 * sizeof(ws2812_led_t);
+    std::vector<ws2812_pwm_t> out(count * color_bits);
+    for (uint16_t led = 0; led < count; led++) {
+        ws2812_pwm_t *bits = &out[color_bits * led];
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            bits[8 * RED + 7 - bit]   = ((leds[led].r >> bit) & 0x01) ? DUTYCYCLE_1 : DUTYCYCLE_0;
+            bits[8 * GREEN + 7 - bit] = ((leds[led].g >> bit) & 0x01) ? DUTYCYCLE_1 : DUTYCYCLE_0;
+            bits[8 * BLUE + 7 - bit]  = ((leds[led].b >> bit) & 0x01) ? DUTYCYCLE_1 : DUTYCYCLE_0;
+#ifdef WS2812_RGBW
+            bits[8 * WHITE + 7 - bit] = ((leds[led].w >> bit) & 0x01) ? DUTYCYCLE_1 : DUTYCYCLE_0;
+#endif
+        }
+    }
+    return out;
+}
+
+static const ws2812_pwm_t pwm_nibbles[16][4] = WS2812_PWM_NIBBLES(DUTYCYCLE_0, DUTYCYCLE_1);
+
+class Ws2812Encode : public ::testing::Test {
+   protected:
+    ws2812_led_t leds[LED_COUNT];
+
+    // Every value on every channel, each channel different from the others
+    void SetUp() override {
+        for (uint16_t i = 0; i < LED_COUNT; i++) {
+            leds[i].r = i;
+            leds[i].g = 255 - i;
+            leds[i].b = i * 7;
+#ifdef WS2812_RGBW
+            leds[i].w = i ^ 0x5A;
+#endif
+        }
+    }
+};
+
+TEST_F(Ws2812Encode, SpiOneBit) {
+    leds[0] = {};
+    leds[0].r = 0x80;
+    leds[0].g = 0x01;
+
+    uint8_t out[WS2812_SPI_BYTES_PER_LED];
+    ws2812_spi_encode(out, leds, 1);
+    EXPECT_EQ(out[4 * RED], 0xE8);
+    EXPECT_EQ(out[4 * RED + 3], 0x88);
+    EXPECT_EQ(out[4 * GREEN], 0x88);
+    EXPECT_EQ(out[4 * GREEN + 3], 0x8E);
+    EXPECT_EQ(out[4 * BLUE], 0x88);
+}
+
+TEST_F(Ws2812Encode, SpiMatchesReference) {
+    std::vector<uint8_t> out(LED_COUNT * WS2812_SPI_BYTES_PER_LED + 1, 0xA5);
+    ws2812_spi_encode(out.data(), leds, LED_COUNT);
+
+    EXPECT_EQ(out.back(), 0xA5);
+    out.pop_back();
+    EXPECT_EQ(out, reference_spi(leds, LED_COUNT));
+}
+
+TEST_F(Ws2812Encode, PwmOneBit) {
+    leds[0] = {};
+    leds[0].b = 0x40;
+
+    ws2812_pwm_t out[8 * sizeof(ws2812_led_t)];
+    ws2812_pwm_encode(out, leds, 1, pwm_nibbles);
+    for (uint8_t i = 0; i < 8 * sizeof(ws2812_led_t); i++) {
+        EXPECT_EQ(out[i], i == 8 * BLUE + 1 ? DUTYCYCLE_1 : DUTYCYCLE_0) << "bit " << +i;
+    }
+}
+
+TEST_F(Ws2812Encode, PwmMatchesReference) {
+    std::vector<ws2812_pwm_t> out(LED_COUNT * 8 * sizeof(ws2812_led_t) + 1, 0);
+    ws2812_pwm_encode(out.data(), leds, LED_COUNT, pwm_nibbles);
+
+    EXPECT_EQ(out.back(), 0);
+    out.pop_back();
+    EXPECT_EQ(out, reference_pwm(leds, LED_COUNT));
+}
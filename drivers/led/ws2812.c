@@ -3,6 +3,11 @@
 
 #include "ws2812.h"
 
+// Drivers which finish sending in ws2812_flush() are always ready
+__attribute__((weak)) bool ws2812_ready(void) {
+    return true;
+}
+
 #if defined(WS2812_RGBW)
 void ws2812_rgb_to_rgbw(ws2812_led_t *led) {
     // Determine lowest value in all three colors, put that into
@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include "util.h"
 
 /*
@@ -93,5 +94,7 @@ void ws2812_init(void);
 void ws2812_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
 void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
 void ws2812_flush(void);
+/* false while the driver is still busy with the previous flush, so that the next one would have to wait */
+bool ws2812_ready(void);
 
 void ws2812_rgb_to_rgbw(ws2812_led_t *led);
@@ -0,0 +1,77 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "ws2812.h"
+
+/*
+    Encodes LED colours into the waveforms the DMA based WS2812 drivers send,
+    with lookup tables instead of a branch per bit. The bytes of ws2812_led_t
+    are already in the order the LEDs expect them, and go out most significant
+    bit first.
+*/
+
+/* SPI: each bit is a nibble on the wire, 0b1000 for a zero and 0b1110 for a one. */
+#define WS2812_SPI_BYTES_PER_BYTE 4
+#define WS2812_SPI_BYTES_PER_LED (WS2812_SPI_BYTES_PER_BYTE * sizeof(ws2812_led_t))
+
+/**
+ * @brief Encodes `count` LEDs into `out`, WS2812_SPI_BYTES_PER_LED bytes each.
+ */
+static inline void ws2812_spi_encode(uint8_t *out, const ws2812_led_t *leds, uint16_t count) {
+    // The two bytes on the wire for each nibble of colour
+    static const uint8_t nibbles[16][2] = {
+        {0x88, 0x88}, {0x88, 0x8E}, {0x88, 0xE8}, {0x88, 0xEE}, {0x8E, 0x88}, {0x8E, 0x8E}, {0x8E, 0xE8}, {0x8E, 0xEE},
+        {0xE8, 0x88}, {0xE8, 0x8E}, {0xE8, 0xE8}, {0xE8, 0xEE}, {0xEE, 0x88}, {0xEE, 0x8E}, {0xEE, 0xE8}, {0xEE, 0xEE},
+    };
+    const uint8_t *bytes = (const uint8_t *)leds;
+
+    for (size_t i = 0; i < count * sizeof(ws2812_led_t); i++) {
+        memcpy(out, nibbles[bytes[i] >> 4], 2);
+        memcpy(out + 2, nibbles[bytes[i] & 0x0F], 2);
+        out += WS2812_SPI_BYTES_PER_BYTE;
+    }
+}
+
+/* PWM: each bit is one timer period, with the duty cycle of a zero or a one.
+   The element type matches what the DMA writes to the timer compare register. */
+#ifndef WS2812_PWM_BUFFER_TYPE
+#    define WS2812_PWM_BUFFER_TYPE uint8_t
+#endif
+
+typedef WS2812_PWM_BUFFER_TYPE ws2812_pwm_t;
+
+#define WS2812_PWM_BIT(nibble, bit, zero, one) (((nibble) >> (bit)) & 1 ? (one) : (zero))
+#define WS2812_PWM_NIBBLE(nibble, zero, one) \
+    { WS2812_PWM_BIT(nibble, 3, zero, one), WS2812_PWM_BIT(nibble, 2, zero, one), WS2812_PWM_BIT(nibble, 1, zero, one), WS2812_PWM_BIT(nibble, 0, zero, one) }
+
+/* Initializer for the ws2812_pwm_t[16][4] table of duty cycles for each nibble of colour. */
+// clang-format off
+#define WS2812_PWM_NIBBLES(zero, one) {                                                                      \
+    WS2812_PWM_NIBBLE(0, zero, one),  WS2812_PWM_NIBBLE(1, zero, one),  WS2812_PWM_NIBBLE(2, zero, one),  \
+    WS2812_PWM_NIBBLE(3, zero, one),  WS2812_PWM_NIBBLE(4, zero, one),  WS2812_PWM_NIBBLE(5, zero, one),  \
+    WS2812_PWM_NIBBLE(6, zero, one),  WS2812_PWM_NIBBLE(7, zero, one),  WS2812_PWM_NIBBLE(8, zero, one),  \
+    WS2812_PWM_NIBBLE(9, zero, one),  WS2812_PWM_NIBBLE(10, zero, one), WS2812_PWM_NIBBLE(11, zero, one), \
+    WS2812_PWM_NIBBLE(12, zero, one), WS2812_PWM_NIBBLE(13, zero, one), WS2812_PWM_NIBBLE(14, zero, one), \
+    WS2812_PWM_NIBBLE(15, zero, one),                                                                     \
+}
+// clang-format on
+
+/**
+ * @brief Encodes `count` LEDs into `out`, one duty cycle per bit.
+ *
+ * @param nibbles the table built by WS2812_PWM_NIBBLES()
+ */
+static inline void ws2812_pwm_encode(ws2812_pwm_t *out, const ws2812_led_t *leds, uint16_t count, const ws2812_pwm_t nibbles[16][4]) {
+    const uint8_t *bytes = (const uint8_t *)leds;
+
+    for (size_t i = 0; i < count * sizeof(ws2812_led_t); i++) {
+        memcpy(out, nibbles[bytes[i] >> 4], sizeof(nibbles[0]));
+        memcpy(out + 4, nibbles[bytes[i] & 0x0F], sizeof(nibbles[0]));
+        out += 8;
+    }
+}
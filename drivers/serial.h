@@ -28,6 +28,13 @@ void soft_serial_target_init(void);
 
 bool soft_serial_transaction(int sstd_index);
 
+#ifdef SPLIT_TRANSPORT_PUSH
+// target sends a packet outside of a transaction
+bool soft_serial_push(const split_push_packet_t *packet);
+// initiator takes a packet the target sent, false if there is none
+bool soft_serial_receive_push(split_push_packet_t *packet);
+#endif
+
 #ifdef SERIAL_DEBUG
 #    include <debug.h>
 #    include <print.h>
@@ -61,6 +61,7 @@ subcommands = [
     'qmk.cli.generate.keymap_h',
     'qmk.cli.generate.make_dependencies',
     'qmk.cli.generate.rgb_breathe_table',
+    'qmk.cli.generate.rgb_matrix_timeline',
     'qmk.cli.generate.rules_mk',
     'qmk.cli.generate.version_h',
     'qmk.cli.git.submodule',
@@ -1,5 +1,6 @@
 """Used by the make system to generate info_config.h from info.json.
 """
+import re
 from pathlib import Path
 from dotty_dict import dotty
 
@@ -47,6 +48,56 @@ def pin_array(define, pins, postfix):
     return generate_define(f'{define}_PINS{postfix}', f'{{ {pin_array} }}')
 
 
+def col_port_reads(pins):
+    """Return the value of MATRIX_COL_PORT_READS, which groups the column pins by GPIO port.
+
+    Columns on the same port with the same distance between column index and port bit share one entry, so matrix.c reads them all with a single port read, mask and shift. Nothing is returned if a pin name does not follow the `<port><bit>` scheme, which keeps the pin-wise reads.
+    """
+    reads = {}
+
+    for col, pin in enumerate(pins):
+        if not pin:
+            continue
+
+        match = re.fullmatch(r'([A-Z]+)(\d+)', pin)
+        if not match or int(match.group(2)) > 31:
+            return ''
+
+        port, bit = match.group(1), int(match.group(2))
+        read = reads.setdefault((port, col - bit), {'pin': pin, 'mask': 0})
+        read['mask'] |= 1 << bit
+
+    if not reads:
+        return ''
+
+    entries = ', '.join(f'{{ {read["pin"]}, 0x{read["mask"]:08X}, {shift} }}' for (port, shift), read in reads.items())
+
+    return f'{{ {entries} }}'
+
+
+def col_pin_array(pins, postfix):
+    """Return the config.h lines that set the column pins, along with their port reads.
+
+    The port reads only hold for these pins, so they are only defined where the pins are. A config.h setting its own column pins gets neither, and the columns are read one pin at a time.
+    """
+    define = f'MATRIX_COL_PINS{postfix}'
+    pin_list = ', '.join(map(str, [pin or 'NO_PIN' for pin in pins]))
+    port_reads = col_port_reads(pins)
+
+    if cli.args.filename:
+        # A keymap replaces the keyboard's pins, and with them any port reads made for those
+        lines = [f'#undef {define}', f'#define {define} {{ {pin_list} }}', f'#undef MATRIX_COL_PORT_READS{postfix}']
+        if port_reads:
+            lines.append(f'#define MATRIX_COL_PORT_READS{postfix} {port_reads}')
+        return '\n' + '\n'.join(lines)
+
+    lines = [f'#ifndef {define}', f'#    define {define} {{ {pin_list} }}']
+    if port_reads:
+        lines += [f'#    ifndef MATRIX_COL_PORT_READS{postfix}', f'#        define MATRIX_COL_PORT_READS{postfix} {port_reads}', f'#    endif // MATRIX_COL_PORT_READS{postfix}']
+    lines.append(f'#endif // {define}')
+    return '\n' + '\n'.join(lines)
+
+
 def matrix_pins(matrix_pins, postfix=''):
     """Add the matrix config to the config.h.
     """
@@ -56,7 +107,7 @@ def matrix_pins(matrix_pins, postfix=''):
         pins.append(direct_pins(matrix_pins['direct'], postfix))
 
     if 'cols' in matrix_pins:
-        pins.append(pin_array('MATRIX_COL', matrix_pins['cols'], postfix))
+        pins.append(col_pin_array(matrix_pins['cols'], postfix))
 
     if 'rows' in matrix_pins:
         pins.append(pin_array('MATRIX_ROW', matrix_pins['rows'], postfix))
@@ -12,6 +12,9 @@ from qmk.keyboard import keyboard_completer, keyboard_folder
 from qmk.path import normpath
 from qmk.constants import GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE, JOYSTICK_AXES
 
+# Keep in sync with RGB_MATRIX_GEOMETRY_NEIGHBOR_RADIUS in rgb_matrix_types.h
+RGB_MATRIX_GEOMETRY_NEIGHBOR_RADIUS = 40
+
 
 def _gen_led_configs(info_data):
     lines = []
@@ -60,12 +63,144 @@ def _gen_led_config(info_data, config_type):
     lines.append(f'  {{ {", ".join(pos)} }},')
     lines.append(f'  {{ {", ".join(flags)} }},')
     lines.append('};')
+    if config_type == 'rgb_matrix':
+        lines.extend(_gen_led_geometry(info_data))
     lines.append('#endif')
     lines.append('')
 
     return lines
 
 
+def _c_div(a, b):
+    """Integer division truncating towards zero, as in C.
+    """
+    q = abs(a) // abs(b)
+    return q if (a < 0) == (b < 0) else -q
+
+
+def _sqrt16(x):
+    """Port of lib8tion sqrt16(), so tables match what the effects compute at runtime.
+    """
+    x &= 0xFFFF
+    if x <= 1:
+        return x
+
+    low = 1
+    hi = 255 if x > 7904 else (x >> 5) + 8
+    while True:
+        mid = (low + hi) >> 1
+        if (mid * mid) & 0xFFFF > x:
+            hi = (mid - 1) & 0xFF
+        else:
+            if mid == 255:
+                return 255
+            low = (mid + 1) & 0xFF
+        if hi < low:
+            break
+
+    return low - 1
+
+
+def _atan2_8(dy, dx):
+    """Port of lib8tion atan2_8().
+    """
+    if dy == 0:
+        return 0 if dx >= 0 else 128
+
+    abs_y = abs(dy)
+    if dx >= 0:
+        a = 32 - _c_div(32 * (dx - abs_y), dx + abs_y)
+    else:
+        a = 96 - _c_div(32 * (dx + abs_y), abs_y - dx)
+
+    return (-a if dy < 0 else a) & 0xFF
+
+
+def _gen_led_geometry(info_data):
+    """Convert info.json content to the RGB Matrix geometry tables
+
+    Distances and angles are computed from the LED positions exactly like the
+    distance based effects do, so enabling the tables does not change their output.
+    The center they are computed from is emitted with them, and used by the effects
+    in place of RGB_MATRIX_CENTER, so the two cannot disagree.
+    """
+    center_x, center_y = info_data['rgb_matrix'].get('center_point', [112, 32])
+    led_layout = info_data['rgb_matrix']['layout']
+    points = [(led_data.get('x', 0), led_data.get('y', 0)) for led_data in led_layout]
+
+    center_dist = []
+    center_angle = []
+    for x, y in points:
+        dx = x - center_x
+        dy = y - center_y
+        center_dist.append(str(_sqrt16(dx * dx + dy * dy)))
+        center_angle.append(str(_atan2_8(dy, dx)))
+
+    # Lower triangle of the symmetric distance matrix, see rgb_matrix_led_distance()
+    pairwise = []
+    for a in range(len(points)):
+        row = []
+        for b in range(a):
+            dx = points[a][0] - points[b][0]
+            dy = points[a][1] - points[b][1]
+            row.append(str(_sqrt16(dx * dx + dy * dy)))
+        if row:
+            pairwise.append(f'  {", ".join(row)},')
+
+    lines = []
+    lines.append('#ifdef RGB_MATRIX_GEOMETRY_TABLES')
+    lines.append(f'__attribute__ ((weak)) const led_point_t k_rgb_matrix_center = {{ {center_x}, {center_y} }};')
+    lines.append(f'__attribute__ ((weak)) const uint8_t PROGMEM g_rgb_matrix_center_dist[] = {{ {", ".join(center_dist)} }};')
+    lines.append(f'__attribute__ ((weak)) const uint8_t PROGMEM g_rgb_matrix_center_angle[] = {{ {", ".join(center_angle)} }};')
+    lines.extend(_gen_heatmap_neighbors(led_layout, points))
+    lines.append('#endif')
+    lines.append('#ifdef RGB_MATRIX_GEOMETRY_PAIRWISE')
+    lines.append('__attribute__ ((weak)) const uint8_t PROGMEM g_rgb_matrix_pairwise_dist[] = {')
+    lines.extend(pairwise)
+    lines.append('};')
+    lines.append('#endif')
+
+    return lines
+
+
+def _gen_heatmap_neighbors(led_layout, points):
+    """Convert info.json content to the typing heatmap neighbour lists
+
+    For each LED, every key whose LED is at most RGB_MATRIX_GEOMETRY_NEIGHBOR_RADIUS
+    away, including the keys of the LED itself.
+    """
+    # Same key to LED mapping as g_led_config.matrix_co
+    key_leds = {}
+    for index, led_data in enumerate(led_layout):
+        if 'matrix' in led_data:
+            key_leds[tuple(led_data['matrix'])] = index
+    keys = [(row, col, index) for (row, col), index in sorted(key_leds.items())]
+
+    offsets = [0]
+    neighbors = []
+    for a in range(len(points)):
+        entries = []
+        for row, col, b in keys:
+            dx = points[a][0] - points[b][0]
+            dy = points[a][1] - points[b][1]
+            dist = _sqrt16(dx * dx + dy * dy)
+            if dist <= RGB_MATRIX_GEOMETRY_NEIGHBOR_RADIUS:
+                entries.append(f'{{{row}, {col}, {dist}}}')
+        offsets.append(offsets[-1] + len(entries))
+        if entries:
+            neighbors.append(f'  {", ".join(entries)},')
+
+    lines = []
+    lines.append('#if defined(RGB_MATRIX_FRAMEBUFFER_EFFECTS) && defined(ENABLE_RGB_MATRIX_TYPING_HEATMAP)')
+    lines.append(f'__attribute__ ((weak)) const uint16_t PROGMEM g_rgb_matrix_neighbor_offsets[] = {{ {", ".join(str(offset) for offset in offsets)} }};')
+    lines.append('__attribute__ ((weak)) const led_neighbor_t PROGMEM g_rgb_matrix_neighbors[] = {')
+    lines.extend(neighbors)
+    lines.append('};')
+    lines.append('#endif')
+
+    return lines
+
+
 def _gen_matrix_mask(info_data):
     """Convert info.json content to matrix_mask
     """
@@ -0,0 +1,113 @@
+"""Compile RGB Matrix timeline animations from JSON into rgb_matrix_timeline_data.h.
+
+The data is played by the TIMELINE effect, see quantum/rgb_matrix/rgb_matrix_timeline.h for its layout.
+"""
+import textwrap
+
+from jsonschema import ValidationError
+from milc import cli
+
+from qmk.commands import dump_lines
+from qmk.constants import GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE
+from qmk.json_schema import json_load, validate
+from qmk.keyboard import keyboard_completer, keyboard_folder
+from qmk.keymap import keymap_completer, locate_keymap
+from qmk.path import normpath
+
+TIMELINE_VERSION = 1
+EASINGS = ['step', 'linear', 'in', 'out', 'in_out']
+LED_FLAG_ALL = 0xFF
+
+
+class TimelineError(Exception):
+    """An animation which passes the schema, but cannot be played.
+    """
+
+
+def _u16(value):
+    return [value & 0xFF, value >> 8]
+
+
+def _compile_group(group, palette, duration):
+    times = [keyframe['time'] for keyframe in group['keyframes']]
+    if times != sorted(times):
+        raise TimelineError('keyframes must be in order of time')
+    if times[-1] >= duration:
+        raise TimelineError(f'keyframe at {times[-1]} ms is past the end of the animation')
+
+    leds = group.get('leds', [])
+    flags = 0 if leds else group.get('flags', LED_FLAG_ALL)
+    data = [len(leds), flags, len(group['keyframes'])] + leds
+
+    for keyframe in group['keyframes']:
+        if keyframe['color'] not in palette:
+            raise TimelineError(f'color "{keyframe["color"]}" is not in the palette')
+        data += _u16(keyframe['time']) + [palette[keyframe['color']], EASINGS.index(keyframe.get('easing', 'linear'))]
+
+    return data
+
+
+def compile_timeline(timeline):
+    """Compiles validated timeline JSON into the byte array read by the TIMELINE effect.
+    """
+    palette = {name: index for index, name in enumerate(timeline['palette'])}
+    animations = []
+
+    for animation in timeline['animations']:
+        data = _u16(animation['duration']) + [len(animation['groups'])]
+        for index, group in enumerate(animation['groups']):
+            try:
+                data += _compile_group(group, palette, animation['duration'])
+            except TimelineError as e:
+                raise TimelineError(f'{animation["name"]}, group {index}: {e}')
+        animations.append(data)
+
+    header = [TIMELINE_VERSION, len(palette), len(animations)]
+    for color in timeline['palette'].values():
+        header += color
+
+    offset = len(header) + 2 * len(animations)
+    for data in animations:
+        header += _u16(offset)
+        offset += len(data)
+
+    if offset > 0xFFFF:
+        raise TimelineError(f'the animations take {offset} bytes, more than the 64KB that can be addressed')
+
+    return header + [byte for data in animations for byte in data]
+
+
+@cli.argument('filename', type=normpath, help='The timeline animations JSON file')
+@cli.argument('-kb', '--keyboard', type=keyboard_folder, completer=keyboard_completer, help='The keyboard to place the file in the keymap of.')
+@cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to place the file in.')
+@cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
+@cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.subcommand('Generate the RGB Matrix timeline animation data from a JSON file.')
+def generate_rgb_matrix_timeline(cli):
+    timeline = json_load(cli.args.filename)
+
+    try:
+        validate(timeline, 'qmk.rgb_matrix_timeline.v1')
+        data = compile_timeline(timeline)
+    except (ValidationError, TimelineError) as e:
+        cli.log.error('%s: %s', cli.args.filename, e.message if isinstance(e, ValidationError) else e)
+        return False
+
+    current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_rgb_matrix_timeline.keyboard
+    current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_rgb_matrix_timeline.keymap
+
+    if current_keyboard and current_keymap:
+        cli.args.output = locate_keymap(current_keyboard, current_keymap).parent / 'rgb_matrix_timeline_data.h'
+
+    lines = [GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE, '#pragma once', '']
+
+    lines.append(f'// RGB Matrix timeline animations ({len(timeline["animations"])}), select one with rgb_matrix_timeline_set_animation():')
+    for index, animation in enumerate(timeline['animations']):
+        lines.append(f'#define RGB_MATRIX_TIMELINE_{animation["name"].upper()} {index} // {animation["duration"]} ms, {len(animation["groups"])} groups')
+
+    lines.append('')
+    lines.append(f'static const uint8_t rgb_matrix_timeline_data[{len(data)}] PROGMEM = {{')
+    lines.append(textwrap.fill('    %s' % (', '.join(f'0x{b:02X}' for b in data)), width=100, subsequent_indent='    '))
+    lines.append('};')
+
+    dump_lines(cli.args.output, lines, cli.args.quiet)
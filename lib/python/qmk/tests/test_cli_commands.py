@@ -289,6 +289,13 @@ def test_generate_rgb_breathe_table():
     assert 'Breathing max:    127' in result.stdout
 
 
+def test_generate_rgb_matrix_timeline():
+    result = check_subcommand('generate-rgb-matrix-timeline', 'lib/python/qmk/tests/rgb_matrix_timeline.json')
+    check_returncode(result)
+    assert '#define RGB_MATRIX_TIMELINE_BREATHE 0' in result.stdout
+    assert 'static const uint8_t rgb_matrix_timeline_data[35] PROGMEM' in result.stdout
+
+
 def test_generate_config_h():
     result = check_subcommand('generate-config-h', '-kb', 'handwired/pytest/basic')
     check_returncode(result)
@@ -300,6 +307,8 @@ def test_generate_config_h():
     assert '#    define VENDOR_ID 0xFEED' in result.stdout
     assert '#    define MATRIX_COLS 1' in result.stdout
     assert '#    define MATRIX_COL_PINS { F4 }' in result.stdout
+    assert '#        define MATRIX_COL_PORT_READS { { F4, 0x00000010, -4 } }' in result.stdout
+    assert result.stdout.index('#ifndef MATRIX_COL_PINS') < result.stdout.index('MATRIX_COL_PORT_READS') < result.stdout.index('#endif // MATRIX_COL_PINS')
     assert '#    define MATRIX_ROWS 1' in result.stdout
     assert '#    define MATRIX_ROW_PINS { F5 }' in result.stdout
 
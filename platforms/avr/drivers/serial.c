@@ -19,6 +19,10 @@
 #include "gpio.h"
 #include "serial.h"
 
+#if defined(SPLIT_TRANSPORT_PUSH)
+#    error "SPLIT_TRANSPORT_PUSH is not supported by the bitbang serial driver"
+#endif
+
 #ifdef SOFT_SERIAL_PIN
 
 #    if !(defined(__AVR_AT90USB646__) || defined(__AVR_AT90USB647__) || defined(__AVR_AT90USB1286__) || defined(__AVR_AT90USB1287__) || defined(__AVR_AT90USB162__) || defined(__AVR_ATmega16U2__) || defined(__AVR_ATmega32U2__) || defined(__AVR_ATmega16U4__) || defined(__AVR_ATmega32U4__))
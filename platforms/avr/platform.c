@@ -30,3 +30,33 @@ static void disable_jtag(void) {
 void platform_setup(void) {
     disable_jtag();
 }
+
+#ifdef IDLE_SLEEP_ENABLE
+#    include <avr/sleep.h>
+#    include "idle_sleep.h"
+#    include "timer.h"
+
+static volatile bool idle_sleep_woken = false;
+
+void idle_sleep_platform_wait(uint32_t ms) {
+    uint32_t start   = timer_read32();
+    idle_sleep_woken = false;
+
+    set_sleep_mode(SLEEP_MODE_IDLE);
+    // The timer interrupt wakes the CPU every millisecond to re-check the deadline.
+    while (!idle_sleep_woken && timer_elapsed32(start) < ms) {
+        cli();
+        if (!idle_sleep_woken) {
+            sleep_enable();
+            sei();
+            sleep_cpu();
+            sleep_disable();
+        }
+        sei();
+    }
+}
+
+void idle_sleep_wakeup(void) {
+    idle_sleep_woken = true;
+}
+#endif
@@ -9,6 +9,10 @@
 
 #include <hal.h>
 
+#if defined(SPLIT_TRANSPORT_PUSH)
+#    error "SPLIT_TRANSPORT_PUSH is not supported by the bitbang serial driver, use the usart driver in full duplex mode"
+#endif
+
 // TODO: resolve/remove build warnings
 #if defined(RGBLIGHT_ENABLE) && defined(RGBLED_SPLIT) && defined(PROTOCOL_CHIBIOS) && defined(WS2812_BITBANG)
 #    warning "RGBLED_SPLIT not supported with bitbang WS2812 driver"
@@ -10,6 +10,64 @@
 static inline bool initiate_transaction(uint8_t transaction_id);
 static inline bool react_to_transaction(void);
 
+#if defined(SPLIT_TRANSPORT_PUSH)
+static split_push_queue_t push_queue;
+static bool               push_lost = false;
+
+/**
+ * @brief Receives the rest of a packet pushed by the slave, once its marker
+ * was read.
+ */
+static inline void receive_push(void) {
+    split_push_packet_t packet = {.marker = SPLIT_PUSH_MARKER};
+
+    if (unlikely(!serial_transport_receive((uint8_t*)&packet + sizeof(packet.marker), sizeof(packet) - sizeof(packet.marker)) || !split_push_enqueue(&push_queue, &packet))) {
+        serial_dprintf("SPLIT: receiving pushed packet failed\n");
+        push_lost = true;
+    }
+}
+
+/**
+ * @brief Receives the packets the slave pushed since the last call. Any other
+ * bytes waiting are leftovers of failed transactions and are dropped.
+ */
+static inline void receive_pushes(void) {
+    uint8_t marker = 0;
+    while (serial_transport_receive_immediate(&marker, sizeof(marker))) {
+        if (marker == SPLIT_PUSH_MARKER) {
+            receive_push();
+        }
+    }
+}
+
+/**
+ * @brief Send a packet from the slave to the master, outside of a transaction.
+ * Has to be called with the split shared memory locked, so it doesn't end up
+ * in the middle of the answer to a transaction.
+ */
+bool soft_serial_push(const split_push_packet_t* packet) {
+    return serial_transport_send((const uint8_t*)packet, sizeof(*packet));
+}
+
+/**
+ * @brief Take the oldest packet the slave pushed to the master.
+ */
+bool soft_serial_receive_push(split_push_packet_t* packet) {
+    if (push_queue.count == 0) {
+        receive_pushes();
+    }
+
+    /* Hand out a packet that fails its checks, so the master knows to catch up. */
+    if (unlikely(push_lost)) {
+        push_lost      = false;
+        packet->marker = 0;
+        return true;
+    }
+
+    return split_push_dequeue(&push_queue, packet);
+}
+#endif
+
 /**
  * @brief This thread runs on the slave and responds to transactions initiated
  * by the master.
@@ -100,9 +158,16 @@ static inline bool react_to_transaction(void) {
  * @return bool Indicates success of transaction.
  */
 bool soft_serial_transaction(int index) {
+#if defined(SPLIT_TRANSPORT_PUSH)
+    /* Empty the receive queue by reading it, so a packet the slave pushes
+     * meanwhile is kept (or noticed as lost) instead of being cleared away.
+     * Parts of failed transactions or spurious bytes are dropped on the way. */
+    receive_pushes();
+#else
     /* Clear the receive queue, to start with a clean slate.
      * Parts of failed transactions or spurious bytes could still be in it. */
     serial_transport_driver_clear();
+#endif
 
     return initiate_transaction((uint8_t)index);
 }
@@ -133,7 +198,17 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
      *   - due to the half duplex limitations on return codes, we always have to read *something*.
      *   - without the read, write only transactions *always* succeed, even during the boot process where the slave is not ready.
      */
-    if (unlikely(!serial_transport_receive(&transaction_id_shake, sizeof(transaction_id_shake)) || (transaction_id_shake != (transaction_id ^ NUM_TOTAL_TRANSACTIONS)))) {
+    bool shake_received = serial_transport_receive(&transaction_id_shake, sizeof(transaction_id_shake));
+
+#if defined(SPLIT_TRANSPORT_PUSH)
+    /* The slave may have been pushing packets when the transaction started, they come first. */
+    for (uint8_t i = 0; shake_received && transaction_id_shake == SPLIT_PUSH_MARKER && i < SPLIT_PUSH_QUEUE_SIZE; i++) {
+        receive_push();
+        shake_received = serial_transport_receive(&transaction_id_shake, sizeof(transaction_id_shake));
+    }
+#endif
+
+    if (unlikely(!shake_received || (transaction_id_shake != (transaction_id ^ NUM_TOTAL_TRANSACTIONS)))) {
         serial_dprintf("SPLIT: receiving handshake failed\n");
         return false;
     }
@@ -40,6 +40,14 @@ bool __attribute__((nonnull, hot)) serial_transport_receive(uint8_t* destination
  */
 bool __attribute__((nonnull, hot)) serial_transport_receive_blocking(uint8_t* destination, const size_t size);
 
+/**
+ * @brief Non-blocking receive of size * bytes that already arrived.
+ *
+ * @return true Receive success.
+ * @return false Not enough bytes waiting.
+ */
+bool __attribute__((nonnull)) serial_transport_receive_immediate(uint8_t* destination, const size_t size);
+
 /**
  * @brief Blocking send of buffer with timeout.
  *
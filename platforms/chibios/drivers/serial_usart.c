@@ -7,6 +7,10 @@
 #include "synchronization_util.h"
 #include "chibios_config.h"
 
+#if defined(SPLIT_TRANSPORT_PUSH) && !defined(SERIAL_USART_FULL_DUPLEX)
+#    error SPLIT_TRANSPORT_PUSH needs SERIAL_USART_FULL_DUPLEX, as the slave sends without being asked.
+#endif
+
 #if defined(SERIAL_USART_CONFIG)
 static QMKSerialConfig serial_config = SERIAL_USART_CONFIG;
 #elif defined(MCU_AT32) /* AT32 MCUs */
@@ -165,6 +169,11 @@ inline bool serial_transport_receive_blocking(uint8_t* destination, const size_t
     return success;
 }
 
+inline bool serial_transport_receive_immediate(uint8_t* destination, const size_t size) {
+    bool success = (size_t)chnReadTimeout(serial_driver, destination, size, TIME_IMMEDIATE) == size;
+    return success;
+}
+
 #if !defined(SERIAL_USART_FULL_DUPLEX)
 
 /**
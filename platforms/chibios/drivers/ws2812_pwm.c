@@ -93,10 +93,10 @@
 #define WS2812_PWM_PERIOD (WS2812_PWM_TICK_FREQUENCY / WS2812_PWM_FREQUENCY) /**< Clock period in PWM ticks. */
 
 /**
- * @brief   Number of bit-periods to hold the data line low at the end of a frame
+ * @brief   Number of bit-periods to hold the data line low before a frame
  *
  * The reset period for each frame is defined in WS2812_TRST_US.
- * Calculate the number of zeroes to add at the end assuming 1.25 uS/bit:
+ * Calculate the number of zeroes to add at the start assuming 1.25 uS/bit:
  */
 #define WS2812_COLOR_BITS (WS2812_CHANNELS * 8)
 #define WS2812_RESET_BIT_N (1000 * WS2812_TRST_US / WS2812_TIMING)
@@ -119,145 +119,6 @@
 #    error WS2812 PWM driver: High period for a 1 is more than a byte
 #endif
 
-/* --- PRIVATE MACROS ------------------------------------------------------- */
-
-/**
- * @brief   Determine the index in @ref ws2812_frame_buffer "the frame buffer" of a given bit
- *
- * @param[in] led:                  The led index [0, @ref WS2812_LED_COUNT)
- * @param[in] byte:                 The byte number [0, 2]
- * @param[in] bit:                  The bit number [0, 7]
- *
- * @return                          The bit index
- */
-#define WS2812_BIT(led, byte, bit) (WS2812_COLOR_BITS * (led) + 8 * (byte) + (7 - (bit)))
-
-#if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
-/**
- * @brief   Determine the index in @ref ws2812_frame_buffer "the frame buffer" of a given red bit
- *
- * @note    The red byte is the middle byte in the color packet
- *
- * @param[in] led:                  The led index [0, @ref WS2812_LED_COUNT)
- * @param[in] bit:                  The bit number [0, 7]
- *
- * @return                          The bit index
- */
-#    define WS2812_RED_BIT(led, bit) WS2812_BIT((led), 1, (bit))
-
-/**
- * @brief   Determine the index in @ref ws2812_frame_buffer "the frame buffer" of a given green bit
- *
- * @note    The red byte is the first byte in the color packet
- *
- * @param[in] led:                  The led index [0, @ref WS2812_LED_COUNT)
- * @param[in] bit:                  The bit number [0, 7]
- *
- * @return                          The bit index
- */
-#    define WS2812_GREEN_BIT(led, bit) WS2812_BIT((led), 0, (bit))
-
-/**
- * @brief   Determine the index in @ref ws2812_frame_buffer "the frame buffer" of a given blue bit
- *
- * @note    The red byte is the last byte in the color packet
- *
- * @param[in] led:                  The led index [0, @ref WS2812_LED_COUNT)
- * @param[in] bit:                  The bit index [0, 7]
- *
- * @return                          The bit index
- */
-#    define WS2812_BLUE_BIT(led, bit) WS2812_BIT((led), 2, (bit))
-
-#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
-/**
- * @brief   Determine the index in @ref ws2812_frame_buffer "the frame buffer" of a given red bit
- *
- * @note    The red byte is the middle byte in the color packet
- *
- * @param[in] led:                  The led index [0, @ref WS2812_LED_COUNT)
- * @param[in] bit:                  The bit number [0, 7]
- *
- * @return                          The bit index
- */
-#    define WS2812_RED_BIT(led, bit) WS2812_BIT((led), 0, (bit))
-
-/**
- * @brief   Determine the index in @ref ws2812_frame_buffer "the frame buffer" of a given green bit
- *
- * @note    The red byte is the first byte in the color packet
- *
- * @param[in] led:                  The led index [0, @ref WS2812_LED_COUNT)
- * @param[in] bit:                  The bit number [0, 7]
- *
- * @return                          The bit index
- */
-#    define WS2812_GREEN_BIT(led, bit) WS2812_BIT((led), 1, (bit))
-
-/**
- * @brief   Determine the index in @ref ws2812_frame_buffer "the frame buffer" of a given blue bit
- *
- * @note    The red byte is the last byte in the color packet
- *
- * @param[in] led:                  The led index [0, @ref WS2812_LED_COUNT)
- * @param[in] bit:                  The bit index [0, 7]
- *
- * @return                          The bit index
- */
-#    define WS2812_BLUE_BIT(led, bit) WS2812_BIT((led), 2, (bit))
-
-#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_BGR)
-/**
- * @brief   Determine the index in @ref ws2812_frame_buffer "the frame buffer" of a given red bit
- *
- * @note    The red byte is the middle byte in the color packet
- *
- * @param[in] led:                  The led index [0, @ref WS2812_LED_COUNT)
- * @param[in] bit:                  The bit number [0, 7]
- *
- * @return                          The bit index
- */
-#    define WS2812_RED_BIT(led, bit) WS2812_BIT((led), 2, (bit))
-
-/**
- * @brief   Determine the index in @ref ws2812_frame_buffer "the frame buffer" of a given green bit
- *
- * @note    The red byte is the first byte in the color packet
- *
- * @param[in] led:                  The led index [0, @ref WS2812_LED_COUNT)
- * @param[in] bit:                  The bit number [0, 7]
- *
- * @return                          The bit index
- */
-#    define WS2812_GREEN_BIT(led, bit) WS2812_BIT((led), 1, (bit))
-
-/**
- * @brief   Determine the index in @ref ws2812_frame_buffer "the frame buffer" of a given blue bit
- *
- * @note    The red byte is the last byte in the color packet
- *
- * @param[in] led:                  The led index [0, @ref WS2812_LED_COUNT)
- * @param[in] bit:                  The bit index [0, 7]
- *
- * @return                          The bit index
- */
-#    define WS2812_BLUE_BIT(led, bit) WS2812_BIT((led), 0, (bit))
-#endif
-
-#ifdef WS2812_RGBW
-/**
- * @brief   Determine the index in @ref ws2812_frame_buffer "the frame buffer" of a given white bit
- *
- * @note    The white byte is the last byte in the color packet
- *
- * @param[in] led:                  The led index [0, @ref WS2812_LED_N)
- * @param[in] bit:                  The bit index [0, 7]
- *
- * @return                          The bit index
- */
-#    define WS2812_WHITE_BIT(led, bit) WS2812_BIT((led), 3, (bit))
-#endif
-
 /* --- PRIVATE VARIABLES ---------------------------------------------------- */
 
 // STM32F2XX, STM32F4XX and STM32F7XX do NOT zero pad DMA transfers of unequal data width. Buffer width must match TIMx CCR.
@@ -266,11 +127,11 @@
 #    if defined(WS2812_PWM_TIMER_32BIT)
 #        define WS2812_PWM_DMA_MEMORY_WIDTH STM32_DMA_CR_MSIZE_WORD
 #        define WS2812_PWM_DMA_PERIPHERAL_WIDTH STM32_DMA_CR_PSIZE_WORD
-typedef uint32_t ws2812_buffer_t;
+#        define WS2812_PWM_BUFFER_TYPE uint32_t
 #    else
 #        define WS2812_PWM_DMA_MEMORY_WIDTH STM32_DMA_CR_MSIZE_HWORD
 #        define WS2812_PWM_DMA_PERIPHERAL_WIDTH STM32_DMA_CR_PSIZE_HWORD
-typedef uint16_t ws2812_buffer_t;
+#        define WS2812_PWM_BUFFER_TYPE uint16_t
 #    endif
 #elif defined(AT32F415)
 #    define WS2812_PWM_DMA_MEMORY_WIDTH AT32_DMA_CCTRL_MWIDTH_BYTE
@@ -279,7 +140,7 @@ typedef uint16_t ws2812_buffer_t;
 #    else
 #        define WS2812_PWM_DMA_PERIPHERAL_WIDTH AT32_DMA_CCTRL_PWIDTH_HWORD
 #    endif
-typedef uint8_t ws2812_buffer_t;
+#    define WS2812_PWM_BUFFER_TYPE uint8_t
 #else
 #    define WS2812_PWM_DMA_MEMORY_WIDTH STM32_DMA_CR_MSIZE_BYTE
 #    if defined(WS2812_PWM_TIMER_32BIT)
@@ -287,25 +148,67 @@ typedef uint8_t ws2812_buffer_t;
 #    else
 #        define WS2812_PWM_DMA_PERIPHERAL_WIDTH STM32_DMA_CR_PSIZE_HWORD
 #    endif
-typedef uint8_t ws2812_buffer_t;
+#    define WS2812_PWM_BUFFER_TYPE uint8_t
 #endif
 
-static ws2812_buffer_t ws2812_frame_buffer[WS2812_BIT_N + 1]; /**< Buffer for a frame */
+#include "ws2812_encode.h"
+
+static const ws2812_pwm_t ws2812_pwm_nibbles[16][4] = WS2812_PWM_NIBBLES(WS2812_DUTYCYCLE_0, WS2812_DUTYCYCLE_1);
 
-/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
 /*
- * Gedanke: Double-buffer type transactions: double buffer transfers using two memory pointers for
- * the memory (while the DMA is reading/writing from/to a buffer, the application can
- * write/read to/from the other buffer).
+ * The DMA streams the front buffer over and over, while ws2812_flush() encodes the next frame into
+ * the back buffer. Each buffer starts with the reset bits, so when a pass ends the DMA has already
+ * wrapped around to them. The transfer complete interrupt swaps the buffers while the reset bits go
+ * out, and the new frame starts with reset bits of its own, so the LEDs never latch half a frame.
+ * Should the interrupt come too late, the bits sent meanwhile are the start of the previous frame.
  */
+static ws2812_pwm_t     ws2812_frame_buffer[2][WS2812_BIT_N + 1]; /**< Buffers for a frame */
+static volatile uint8_t ws2812_front        = 0;                  /**< The buffer the DMA streams */
+static volatile bool    ws2812_swap_pending = false;              /**< The other buffer holds a new frame */
+
+/* --- PRIVATE FUNCTIONS ---------------------------------------------------- */
+
+// Points the DMA at the front buffer and starts streaming it
+static void ws2812_dma_start(void) {
+#if defined(WB32F3G71xx) || defined(WB32FQ95xx)
+    dmaStreamSetSource(WS2812_PWM_DMA_STREAM, ws2812_frame_buffer[ws2812_front]);
+    dmaStreamSetMode(WS2812_PWM_DMA_STREAM, WB32_DMA_CHCFG_HWHIF(WS2812_PWM_DMA_CHANNEL) | WB32_DMA_CHCFG_DIR_M2P | WB32_DMA_CHCFG_PSIZE_WORD | WB32_DMA_CHCFG_MSIZE_WORD | WB32_DMA_CHCFG_MINC | WB32_DMA_CHCFG_CIRC | WB32_DMA_CHCFG_TCIE | WB32_DMA_CHCFG_PL(3));
+#elif defined(AT32F415)
+    dmaStreamSetMemory0(WS2812_PWM_DMA_STREAM, ws2812_frame_buffer[ws2812_front]);
+    dmaStreamSetMode(WS2812_PWM_DMA_STREAM, AT32_DMA_CCTRL_DTD_M2P | WS2812_PWM_DMA_PERIPHERAL_WIDTH | WS2812_PWM_DMA_MEMORY_WIDTH | AT32_DMA_CCTRL_MINCM | AT32_DMA_CCTRL_LM | AT32_DMA_CCTRL_FDTIEN | AT32_DMA_CCTRL_CHPL(3));
+#else
+    dmaStreamSetMemory0(WS2812_PWM_DMA_STREAM, ws2812_frame_buffer[ws2812_front]);
+    dmaStreamSetMode(WS2812_PWM_DMA_STREAM, STM32_DMA_CR_CHSEL(WS2812_PWM_DMA_CHANNEL) | STM32_DMA_CR_DIR_M2P | WS2812_PWM_DMA_PERIPHERAL_WIDTH | WS2812_PWM_DMA_MEMORY_WIDTH | STM32_DMA_CR_MINC | STM32_DMA_CR_CIRC | STM32_DMA_CR_TCIE | STM32_DMA_CR_PL(3));
+#endif
+    // M2P: Memory 2 Periph; PL: Priority Level
+    dmaStreamSetTransactionSize(WS2812_PWM_DMA_STREAM, WS2812_BIT_N);
+    dmaStreamEnable(WS2812_PWM_DMA_STREAM);
+}
+
+// Called by the DMA at the end of each pass over the front buffer, as it starts over with the reset bits
+static void ws2812_dma_complete(void *param, uint32_t flags) {
+    (void)param;
+    (void)flags;
+
+    if (ws2812_swap_pending) {
+        dmaStreamDisable(WS2812_PWM_DMA_STREAM);
+        ws2812_front ^= 1;
+        ws2812_dma_start();
+        ws2812_swap_pending = false;
+    }
+}
+
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
 
 void ws2812_init(void) {
-    // Initialize led frame buffer
-    uint32_t i;
-    for (i = 0; i < WS2812_COLOR_BIT_N; i++)
-        ws2812_frame_buffer[i] = WS2812_DUTYCYCLE_0; // All color bits are zero duty cycle
-    for (i = 0; i < WS2812_RESET_BIT_N; i++)
-        ws2812_frame_buffer[i + WS2812_COLOR_BIT_N] = 0; // All reset bits are zero
+    // Initialize led frame buffers
+    for (uint8_t buffer = 0; buffer < 2; buffer++) {
+        uint32_t i;
+        for (i = 0; i < WS2812_RESET_BIT_N; i++)
+            ws2812_frame_buffer[buffer][i] = 0; // All reset bits are zero
+        for (i = 0; i < WS2812_COLOR_BIT_N; i++)
+            ws2812_frame_buffer[buffer][i + WS2812_RESET_BIT_N] = WS2812_DUTYCYCLE_0; // All color bits are zero duty cycle
+    }
 
     palSetLineMode(WS2812_DI_PIN, WS2812_OUTPUT_MODE);
 
@@ -331,25 +234,16 @@ void ws2812_init(void) {
     //#pragma GCC diagnostic pop  // Restore command-line warning options
 
     // Configure DMA
-    // dmaInit(); // Joe added this
 #if defined(WB32F3G71xx) || defined(WB32FQ95xx)
-    dmaStreamAlloc(WS2812_PWM_DMA_STREAM - WB32_DMA_STREAM(0), 10, NULL, NULL);
-    dmaStreamSetSource(WS2812_PWM_DMA_STREAM, ws2812_frame_buffer);
+    dmaStreamAlloc(WS2812_PWM_DMA_STREAM - WB32_DMA_STREAM(0), 10, ws2812_dma_complete, NULL);
     dmaStreamSetDestination(WS2812_PWM_DMA_STREAM, &(WS2812_PWM_DRIVER.tim->CCR[WS2812_PWM_CHANNEL - 1])); // Ziel ist der An-Zeit im Cap-Comp-Register
-    dmaStreamSetMode(WS2812_PWM_DMA_STREAM, WB32_DMA_CHCFG_HWHIF(WS2812_PWM_DMA_CHANNEL) | WB32_DMA_CHCFG_DIR_M2P | WB32_DMA_CHCFG_PSIZE_WORD | WB32_DMA_CHCFG_MSIZE_WORD | WB32_DMA_CHCFG_MINC | WB32_DMA_CHCFG_CIRC | WB32_DMA_CHCFG_TCIE | WB32_DMA_CHCFG_PL(3));
 #elif defined(AT32F415)
-    dmaStreamAlloc(WS2812_PWM_DMA_STREAM - AT32_DMA_STREAM(0), 10, NULL, NULL);
+    dmaStreamAlloc(WS2812_PWM_DMA_STREAM - AT32_DMA_STREAM(0), 10, ws2812_dma_complete, NULL);
     dmaStreamSetPeripheral(WS2812_PWM_DMA_STREAM, &(WS2812_PWM_DRIVER.tmr->CDT[WS2812_PWM_CHANNEL - 1])); // Ziel ist der An-Zeit im Cap-Comp-Register
-    dmaStreamSetMemory0(WS2812_PWM_DMA_STREAM, ws2812_frame_buffer);
-    dmaStreamSetMode(WS2812_PWM_DMA_STREAM, AT32_DMA_CCTRL_DTD_M2P | WS2812_PWM_DMA_PERIPHERAL_WIDTH | WS2812_PWM_DMA_MEMORY_WIDTH | AT32_DMA_CCTRL_MINCM | AT32_DMA_CCTRL_LM | AT32_DMA_CCTRL_CHPL(3));
 #else
-    dmaStreamAlloc(WS2812_PWM_DMA_STREAM - STM32_DMA_STREAM(0), 10, NULL, NULL);
+    dmaStreamAlloc(WS2812_PWM_DMA_STREAM - STM32_DMA_STREAM(0), 10, ws2812_dma_complete, NULL);
     dmaStreamSetPeripheral(WS2812_PWM_DMA_STREAM, &(WS2812_PWM_DRIVER.tim->CCR[WS2812_PWM_CHANNEL - 1])); // Ziel ist der An-Zeit im Cap-Comp-Register
-    dmaStreamSetMemory0(WS2812_PWM_DMA_STREAM, ws2812_frame_buffer);
-    dmaStreamSetMode(WS2812_PWM_DMA_STREAM, STM32_DMA_CR_CHSEL(WS2812_PWM_DMA_CHANNEL) | STM32_DMA_CR_DIR_M2P | WS2812_PWM_DMA_PERIPHERAL_WIDTH | WS2812_PWM_DMA_MEMORY_WIDTH | STM32_DMA_CR_MINC | STM32_DMA_CR_CIRC | STM32_DMA_CR_PL(3));
 #endif
-    dmaStreamSetTransactionSize(WS2812_PWM_DMA_STREAM, WS2812_BIT_N);
-    // M2P: Memory 2 Periph; PL: Priority Level
 
 #if (STM32_DMA_SUPPORTS_DMAMUX == TRUE)
     // If the MCU has a DMAMUX we need to assign the correct resource
@@ -362,7 +256,7 @@ void ws2812_init(void) {
 #endif
 
     // Start DMA
-    dmaStreamEnable(WS2812_PWM_DMA_STREAM);
+    ws2812_dma_start();
 
     // Configure PWM
     // NOTE: It's required that preload be enabled on the timer channel CCR register. This is currently enabled in the
@@ -372,26 +266,6 @@ void ws2812_init(void) {
     pwmEnableChannel(&WS2812_PWM_DRIVER, WS2812_PWM_CHANNEL - 1, 0); // Initial period is 0; output will be low until first duty cycle is DMA'd in
 }
 
-void ws2812_write_led(uint16_t led_number, uint8_t r, uint8_t g, uint8_t b) {
-    // Write color to frame buffer
-    for (uint8_t bit = 0; bit < 8; bit++) {
-        ws2812_frame_buffer[WS2812_RED_BIT(led_number, bit)]   = ((r >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_GREEN_BIT(led_number, bit)] = ((g >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_BLUE_BIT(led_number, bit)]  = ((b >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-    }
-}
-void ws2812_write_led_rgbw(uint16_t led_number, uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
-    // Write color to frame buffer
-    for (uint8_t bit = 0; bit < 8; bit++) {
-        ws2812_frame_buffer[WS2812_RED_BIT(led_number, bit)]   = ((r >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_GREEN_BIT(led_number, bit)] = ((g >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_BLUE_BIT(led_number, bit)]  = ((b >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-#ifdef WS2812_RGBW
-        ws2812_frame_buffer[WS2812_WHITE_BIT(led_number, bit)] = ((w >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-#endif
-    }
-}
-
 ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
 
 void ws2812_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
@@ -410,11 +284,17 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ws2812_flush(void) {
-    for (int i = 0; i < WS2812_LED_COUNT; i++) {
-#if defined(WS2812_RGBW)
-        ws2812_write_led_rgbw(i, ws2812_leds[i].r, ws2812_leds[i].g, ws2812_leds[i].b, ws2812_leds[i].w);
-#else
-        ws2812_write_led(i, ws2812_leds[i].r, ws2812_leds[i].g, ws2812_leds[i].b);
-#endif
+    // The DMA has yet to take the previous frame, which it does at the end of its current pass
+    while (ws2812_swap_pending) {
     }
+
+    ws2812_pwm_encode(&ws2812_frame_buffer[ws2812_front ^ 1][WS2812_RESET_BIT_N], ws2812_leds, WS2812_LED_COUNT, ws2812_pwm_nibbles);
+
+    chSysLock();
+    ws2812_swap_pending = true;
+    chSysUnlock();
+}
+
+bool ws2812_ready(void) {
+    return !ws2812_swap_pending;
 }
@@ -1,4 +1,5 @@
 #include "ws2812.h"
+#include "ws2812_encode.h"
 #include "gpio.h"
 #include "util.h"
 #include "chibios_config.h"
@@ -102,67 +103,42 @@
 #    define WS2812_SCK_OUTPUT_MODE PAL_MODE_ALTERNATE(WS2812_SPI_SCK_PAL_MODE) | PAL_OUTPUT_TYPE_PUSHPULL
 #endif
 
-#define BYTES_FOR_LED_BYTE 4
-#ifdef WS2812_RGBW
-#    define WS2812_CHANNELS 4
-#else
-#    define WS2812_CHANNELS 3
-#endif
-#define BYTES_FOR_LED (BYTES_FOR_LED_BYTE * WS2812_CHANNELS)
-#define DATA_SIZE (BYTES_FOR_LED * WS2812_LED_COUNT)
+#define DATA_SIZE (WS2812_SPI_BYTES_PER_LED * WS2812_LED_COUNT)
 #define RESET_SIZE (1000 * WS2812_TRST_US / (2 * WS2812_TIMING))
 #define PREAMBLE_SIZE 4
 
-static uint8_t txbuf[PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
-
 /*
- * As the trick here is to use the SPI to send a huge pattern of 0 and 1 to
- * the ws2812b protocol, we use this helper function to translate bytes into
- * 0s and 1s for the LED (with the appropriate timing).
+ * Asynchronous sends use two buffers: the next frame is encoded into one while the other is still
+ * being sent, and the end of the transfer starts the next one.
  */
-static uint8_t get_protocol_eq(uint8_t data, int pos) {
-    uint8_t eq = 0;
-    if (data & (1 << (2 * (3 - pos))))
-        eq = 0b1110;
-    else
-        eq = 0b1000;
-    if (data & (2 << (2 * (3 - pos))))
-        eq += 0b11100000;
-    else
-        eq += 0b10000000;
-    return eq;
-}
+#if defined(WS2812_SPI_USE_CIRCULAR_BUFFER) || defined(WS2812_SPI_SYNC)
+#    define WS2812_SPI_BUFFER_COUNT 1
+#else
+#    define WS2812_SPI_BUFFER_COUNT 2
+#    define WS2812_SPI_DOUBLE_BUFFER
+#endif
 
-static void set_led_color_rgb(ws2812_led_t color, int pos) {
-    uint8_t* tx_start = &txbuf[PREAMBLE_SIZE];
+static uint8_t txbuf[WS2812_SPI_BUFFER_COUNT][PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
 
-#if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
-#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
-#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_BGR)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.b, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.r, j);
-#endif
-#ifdef WS2812_RGBW
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 3 + j] = get_protocol_eq(color.w, j);
-#endif
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+static volatile uint8_t ws2812_front   = 0;     // The buffer being sent, or sent last
+static volatile bool    ws2812_sending = false; // A transfer is running
+static volatile bool    ws2812_queued  = false; // The other buffer is to be sent once it ends
+
+static void ws2812_spi_complete(SPIDriver *spip) {
+    chSysLockFromISR();
+    if (ws2812_queued) {
+        ws2812_queued = false;
+        spiStartSendI(spip, ARRAY_SIZE(txbuf[0]), txbuf[ws2812_front]);
+    } else {
+        ws2812_sending = false;
+    }
+    chSysUnlockFromISR();
 }
+#    define WS2812_SPI_COMPLETE_CB ws2812_spi_complete
+#else
+#    define WS2812_SPI_COMPLETE_CB NULL
+#endif
 
 ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
 
@@ -180,7 +156,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_CIRCULAR == TRUE
         WS2812_SPI_BUFFER_MODE,
 #    endif
-        NULL, // end_cb
+        WS2812_SPI_COMPLETE_CB, // end_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
 #    if defined(WB32F3G71xx) || defined(WB32FQ95xx)
@@ -199,7 +175,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_SLAVE_MODE == TRUE
         false,
 #    endif
-        NULL, // data_cb
+        WS2812_SPI_COMPLETE_CB, // data_cb
         NULL, // error_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
@@ -220,7 +196,7 @@ void ws2812_init(void) {
     spiStart(&WS2812_SPI_DRIVER, &spicfg); /* Setup transfer parameters.       */
     spiSelect(&WS2812_SPI_DRIVER);         /* Slave Select assertion.          */
 #ifdef WS2812_SPI_USE_CIRCULAR_BUFFER
-    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf[0]), txbuf[0]);
 #endif
 }
 
@@ -240,17 +216,35 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ws2812_flush(void) {
-    for (int i = 0; i < WS2812_LED_COUNT; i++) {
-        set_led_color_rgb(ws2812_leds[i], i);
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+    // The other buffer is still waiting for the current transfer to end
+    while (ws2812_queued) {
     }
 
-    // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, animations flushing faster than send will cause issues.
-    // Instead spiSend can be used to send synchronously (or the thread logic can be added back).
-#ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
-#    ifdef WS2812_SPI_SYNC
-    spiSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
-#    else
-    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    uint8_t back = ws2812_front ^ 1;
+    ws2812_spi_encode(&txbuf[back][PREAMBLE_SIZE], ws2812_leds, WS2812_LED_COUNT);
+
+    chSysLock();
+    ws2812_front = back;
+    if (ws2812_sending) {
+        ws2812_queued = true;
+    } else {
+        ws2812_sending = true;
+        spiStartSendI(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf[back]), txbuf[back]);
+    }
+    chSysUnlock();
+#else
+    ws2812_spi_encode(&txbuf[0][PREAMBLE_SIZE], ws2812_leds, WS2812_LED_COUNT);
+
+#    ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
+    // Each led takes ~0.03ms, 50 leds ~1.5ms
+    spiSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf[0]), txbuf[0]);
 #    endif
 #endif
 }
+
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+bool ws2812_ready(void) {
+    return !ws2812_queued;
+}
+#endif
@@ -20,3 +20,71 @@ void platform_setup(void) {
     halInit();
     chSysInit();
 }
+
+#ifdef IDLE_SLEEP_ENABLE
+#    include "idle_sleep.h"
+
+#    define IDLE_SLEEP_WAKEUP_EVENT EVENT_MASK(0)
+
+static thread_t *idle_sleep_thread = NULL;
+
+void idle_sleep_platform_wait(uint32_t ms) {
+    // The idle thread executes WFI while the keyboard thread waits for the event.
+    idle_sleep_thread = chThdGetSelfX();
+    chEvtWaitAnyTimeout(IDLE_SLEEP_WAKEUP_EVENT, TIME_MS2I(ms));
+}
+
+void idle_sleep_wakeup(void) {
+    chSysLockFromISR();
+    if (idle_sleep_thread != NULL) {
+        chEvtSignalI(idle_sleep_thread, IDLE_SLEEP_WAKEUP_EVENT);
+    }
+    chSysUnlockFromISR();
+}
+#endif
+
+#ifdef MATRIX_INTERRUPT_WAKEUP
+#    include "matrix.h"
+
+#    if PAL_USE_CALLBACKS != TRUE
+#        error "MATRIX_INTERRUPT_WAKEUP requires PAL_USE_CALLBACKS = TRUE in halconf.h"
+#    endif
+
+#    if defined(MCU_STM32) || defined(MCU_AT32)
+// Pins with the same number on different ports share an EXTI line, which can only watch one of them
+#        define MATRIX_WAKEUP_SHARED_LINES 16
+static pin_t matrix_wakeup_lines[MATRIX_WAKEUP_SHARED_LINES] = {[0 ...(MATRIX_WAKEUP_SHARED_LINES - 1)] = NO_PIN};
+#    endif
+
+static void matrix_wakeup_pin_callback(void *arg) {
+    matrix_wakeup_pin_event();
+}
+
+bool matrix_wakeup_pin_enable(pin_t pin, uint8_t pressed_state) {
+#    ifdef MATRIX_WAKEUP_SHARED_LINES
+    // Another input already holds the line, so this one could not wake the matrix
+    pin_t *line = &matrix_wakeup_lines[PAL_PAD(pin) % MATRIX_WAKEUP_SHARED_LINES];
+    if (*line != NO_PIN && *line != pin) {
+        return false;
+    }
+    *line = pin;
+#    endif
+
+    palEnableLineEvent(pin, pressed_state ? PAL_EVENT_MODE_RISING_EDGE : PAL_EVENT_MODE_FALLING_EDGE);
+    palSetLineCallback(pin, matrix_wakeup_pin_callback, NULL);
+    return true;
+}
+
+void matrix_wakeup_pin_disable(pin_t pin) {
+#    ifdef MATRIX_WAKEUP_SHARED_LINES
+    // Leave the line alone if it watches another input
+    pin_t *line = &matrix_wakeup_lines[PAL_PAD(pin) % MATRIX_WAKEUP_SHARED_LINES];
+    if (*line != pin) {
+        return;
+    }
+    *line = NO_PIN;
+#    endif
+
+    palDisableLineEvent(pin);
+}
+#endif
@@ -19,3 +19,16 @@
 void platform_setup(void) {
     // do nothing
 }
+
+#ifdef IDLE_SLEEP_ENABLE
+#    include "idle_sleep.h"
+
+void advance_time(uint32_t ms);
+
+// Waiting is simulated by advancing the test timer, nothing can wake it early.
+void idle_sleep_platform_wait(uint32_t ms) {
+    advance_time(ms);
+}
+
+void idle_sleep_wakeup(void) {}
+#endif
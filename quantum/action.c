@@ -27,6 +27,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "action_tapping.h"
 #include "action_util.h"
 #include "action.h"
+#include "profiling.h"
 #include "wait.h"
 #include "keycode_config.h"
 #include "debug.h"
@@ -130,8 +131,10 @@ void action_exec(keyevent_t event) {
         retroshift_poll_time(&event);
     }
 #    endif
-    if (IS_NOEVENT(record.event) || pre_process_record_quantum(&record)) {
+    if (IS_NOEVENT(record.event)) {
         action_tapping_process(record);
+    } else if (pre_process_record_quantum(&record)) {
+        PROFILE_PROBE(ACTION_TAPPING, action_tapping_process(record));
     }
 #else
     if (IS_NOEVENT(record.event) || pre_process_record_quantum(&record)) {
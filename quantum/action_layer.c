@@ -1,5 +1,6 @@
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "keyboard.h"
 #include "action.h"
@@ -235,15 +236,7 @@ void layer_debug(void) {
 }
 #endif
 
-#if !defined(NO_ACTION_LAYER) && !defined(STRICT_LAYER_RELEASE)
-/** \brief source layer cache
- */
-
-uint8_t source_layers_cache[((MATRIX_ROWS * MATRIX_COLS) + (CHAR_BIT)-1) / (CHAR_BIT)][MAX_LAYER_BITS] = {{0}};
-#    ifdef ENCODER_MAP_ENABLE
-uint8_t encoder_source_layers_cache[(NUM_ENCODERS + (CHAR_BIT)-1) / (CHAR_BIT)][MAX_LAYER_BITS] = {{0}};
-#    endif // ENCODER_MAP_ENABLE
-
+#if !defined(NO_ACTION_LAYER) && (!defined(STRICT_LAYER_RELEASE) || defined(LAYER_CACHE_ENABLE))
 /** \brief update source layers cache impl
  *
  * Updates the supplied cache when changing layers
@@ -271,6 +264,16 @@ uint8_t read_source_layers_cache_impl(uint16_t entry_number, uint8_t cache[][MAX
 
     return layer;
 }
+#endif
+
+#if !defined(NO_ACTION_LAYER) && !defined(STRICT_LAYER_RELEASE)
+/** \brief source layer cache
+ */
+
+uint8_t source_layers_cache[((MATRIX_ROWS * MATRIX_COLS) + (CHAR_BIT)-1) / (CHAR_BIT)][MAX_LAYER_BITS] = {{0}};
+#    ifdef ENCODER_MAP_ENABLE
+uint8_t encoder_source_layers_cache[(NUM_ENCODERS + (CHAR_BIT)-1) / (CHAR_BIT)][MAX_LAYER_BITS] = {{0}};
+#    endif // ENCODER_MAP_ENABLE
 
 /** \brief update encoder source layers cache
  *
@@ -335,16 +338,15 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
 #endif
 }
 
-/** \brief Layer switch get layer
+#ifndef NO_ACTION_LAYER
+/** \brief Resolve layer
  *
- * Gets the layer based on key info
+ * Finds the topmost non-transparent layer for the key within the supplied layer state
  */
-uint8_t layer_switch_get_layer(keypos_t key) {
-#ifndef NO_ACTION_LAYER
+static uint8_t resolve_layer(layer_state_t layers, keypos_t key) {
     action_t action;
     action.code = ACTION_TRANSPARENT;
 
-    layer_state_t layers = layer_state | default_layer_state;
     /* check top layer first */
     for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
@@ -356,6 +358,62 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     }
     /* fall back to layer 0 */
     return 0;
+}
+#endif
+
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_CACHE_ENABLE)
+/** \brief resolved layers cache
+ *
+ * Holds the resolved layer of every key for the layer state in resolved_layers_state
+ */
+static uint8_t       resolved_layers_cache[((MATRIX_ROWS * MATRIX_COLS) + (CHAR_BIT)-1) / (CHAR_BIT)][MAX_LAYER_BITS] = {{0}};
+static uint8_t       resolved_layers_valid[((MATRIX_ROWS * MATRIX_COLS) + (CHAR_BIT)-1) / (CHAR_BIT)]                 = {0};
+static layer_state_t resolved_layers_state                                                                           = 0;
+
+/** \brief invalidate resolved layers cache
+ *
+ * Must be called when the keymap contents change, layer state changes are picked up automatically
+ */
+void layer_cache_invalidate(void) {
+    memset(resolved_layers_valid, 0, sizeof(resolved_layers_valid));
+}
+
+/** \brief read resolved layers cache
+ *
+ * Returns the cached layer for the key, resolving and caching it first if needed
+ */
+static uint8_t read_resolved_layers_cache(layer_state_t layers, keypos_t key) {
+    const uint16_t entry_number = (uint16_t)(key.row * MATRIX_COLS) + key.col;
+    const uint16_t storage_idx  = entry_number / (CHAR_BIT);
+    const uint8_t  storage_bit  = entry_number % (CHAR_BIT);
+
+    if (layers != resolved_layers_state) {
+        layer_cache_invalidate();
+        resolved_layers_state = layers;
+    } else if (resolved_layers_valid[storage_idx] & (1U << storage_bit)) {
+        return read_source_layers_cache_impl(entry_number, resolved_layers_cache);
+    }
+
+    uint8_t layer = resolve_layer(layers, key);
+    update_source_layers_cache_impl(layer, entry_number, resolved_layers_cache);
+    resolved_layers_valid[storage_idx] |= 1U << storage_bit;
+    return layer;
+}
+#endif
+
+/** \brief Layer switch get layer
+ *
+ * Gets the layer based on key info
+ */
+uint8_t layer_switch_get_layer(keypos_t key) {
+#ifndef NO_ACTION_LAYER
+    layer_state_t layers = layer_state | default_layer_state;
+#    ifdef LAYER_CACHE_ENABLE
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        return read_resolved_layers_cache(layers, key);
+    }
+#    endif
+    return resolve_layer(layers, key);
 #else
     return get_highest_layer(default_layer_state);
 #endif
@@ -1,5 +1,6 @@
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "action.h"
 #include "action_layer.h"
@@ -110,13 +111,27 @@ static bool     flow_tap_expired      = true;
 static bool flow_tap_key_if_within_term(keyrecord_t *record, uint16_t prev_time);
 #    endif // defined(FLOW_TAP_TERM)
 
-static keyrecord_t tapping_key                         = {};
-static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE] = {};
-static uint8_t     waiting_buffer_head                 = 0;
-static uint8_t     waiting_buffer_tail                 = 0;
+#    if WAITING_BUFFER_SIZE < 2 || WAITING_BUFFER_SIZE > 128
+#        error "WAITING_BUFFER_SIZE must be between 2 and 128"
+#    endif
+
+#    define WAITING_BUFFER_NEXT(i) (((i) + 1) % WAITING_BUFFER_SIZE)
+
+// Buffered events are also counted per key bucket, split by press and release,
+// so that lookups by key position can bail out without walking the buffer.
+#    define WAITING_BUFFER_KEY_BUCKETS 8
+#    define WAITING_BUFFER_KEY_BUCKET(key) (((key).row * 3 + (key).col) % WAITING_BUFFER_KEY_BUCKETS)
+
+static keyrecord_t tapping_key                                         = {};
+static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE]                 = {};
+static uint8_t     waiting_buffer_head                                 = 0;
+static uint8_t     waiting_buffer_tail                                 = 0;
+static uint8_t     waiting_buffer_presses[WAITING_BUFFER_KEY_BUCKETS]  = {};
+static uint8_t     waiting_buffer_releases[WAITING_BUFFER_KEY_BUCKETS] = {};
 
 static bool process_tapping(keyrecord_t *record);
 static bool waiting_buffer_enq(keyrecord_t record);
+static void waiting_buffer_pop(void);
 static void waiting_buffer_clear(void);
 static bool waiting_buffer_typed(keyevent_t event);
 static bool waiting_buffer_has_anykey_pressed(void);
@@ -149,7 +164,7 @@ void action_tapping_process(keyrecord_t record) {
     if (IS_EVENT(record.event) && waiting_buffer_head != waiting_buffer_tail) {
         ac_dprintf("---- action_exec: process waiting_buffer -----\n");
     }
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_pop()) {
         if (process_tapping(&waiting_buffer[waiting_buffer_tail])) {
             ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
             debug_record(waiting_buffer[waiting_buffer_tail]);
@@ -169,6 +184,31 @@ void action_tapping_process(keyrecord_t record) {
     }
 }
 
+/** \brief Time at which the next tick event can change the tapping state
+ *
+ * Until the tapping term of the tapping key has passed, a tick can settle it.
+ * Afterwards only events still in the waiting buffer need one, right away.
+ *
+ * \param deadline[out] the deadline, in the same time-space as timer_read32()
+ * \return true if a tick event is needed
+ */
+bool action_tapping_next_deadline(uint32_t *deadline) {
+    if (!IS_EVENT(tapping_key.event)) {
+        return false;
+    }
+
+    uint16_t term    = GET_TAPPING_TERM(get_record_keycode(&tapping_key, false), &tapping_key);
+    uint16_t elapsed = TIMER_DIFF_16(timer_read(), tapping_key.event.time);
+    if (elapsed >= term) {
+        if (waiting_buffer_tail == waiting_buffer_head) {
+            return false;
+        }
+        elapsed = term;
+    }
+    *deadline = timer_read32() + (term - elapsed);
+    return true;
+}
+
 /* Some conditionally defined helper macros to keep process_tapping more
  * readable. The conditional definition of tapping_keycode and all the
  * conditional uses of it are hidden inside macros named TAP_...
@@ -293,7 +333,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     // Now that tapping_key has settled as tapped, check whether
                     // Flow Tap applies to following yet-unsettled keys.
                     uint16_t prev_time = tapping_key.event.time;
-                    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+                    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_pop()) {
                         keyrecord_t *record = &waiting_buffer[waiting_buffer_tail];
                         if (!record->event.pressed) {
                             break;
@@ -353,7 +393,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     uint8_t first_tap = waiting_buffer_find_chordal_hold_tap();
                     ac_dprintf("first_tap = %u\n", first_tap);
                     if (first_tap < WAITING_BUFFER_SIZE) {
-                        for (; waiting_buffer_tail != first_tap; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+                        for (; waiting_buffer_tail != first_tap; waiting_buffer_pop()) {
                             ac_dprintf("Processing [%u]\n", waiting_buffer_tail);
                             process_record(&waiting_buffer[waiting_buffer_tail]);
                         }
@@ -453,7 +493,7 @@ bool process_tapping(keyrecord_t *keyp) {
                             if (waiting_buffer_tail != waiting_buffer_head && is_tap_record(&waiting_buffer[waiting_buffer_tail])) {
                                 tapping_key = waiting_buffer[waiting_buffer_tail];
                                 // Pop tail from the queue.
-                                waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+                                waiting_buffer_pop();
                                 debug_waiting_buffer();
                             } else
 #    endif // CHORDAL_HOLD
@@ -629,19 +669,35 @@ bool waiting_buffer_enq(keyrecord_t record) {
         return true;
     }
 
-    if ((waiting_buffer_head + 1) % WAITING_BUFFER_SIZE == waiting_buffer_tail) {
+    if (WAITING_BUFFER_NEXT(waiting_buffer_head) == waiting_buffer_tail) {
         ac_dprintf("waiting_buffer_enq: Over flow.\n");
         return false;
     }
 
+    uint8_t *counts = record.event.pressed ? waiting_buffer_presses : waiting_buffer_releases;
+    ++counts[WAITING_BUFFER_KEY_BUCKET(record.event.key)];
+
     waiting_buffer[waiting_buffer_head] = record;
-    waiting_buffer_head                 = (waiting_buffer_head + 1) % WAITING_BUFFER_SIZE;
+    waiting_buffer_head                 = WAITING_BUFFER_NEXT(waiting_buffer_head);
 
     ac_dprintf("waiting_buffer_enq: ");
     debug_waiting_buffer();
     return true;
 }
 
+/** \brief Removes the oldest event from the waiting buffer. */
+void waiting_buffer_pop(void) {
+    if (waiting_buffer_tail == waiting_buffer_head) {
+        return;
+    }
+
+    const keyevent_t *event  = &waiting_buffer[waiting_buffer_tail].event;
+    uint8_t *         counts = event->pressed ? waiting_buffer_presses : waiting_buffer_releases;
+    --counts[WAITING_BUFFER_KEY_BUCKET(event->key)];
+
+    waiting_buffer_tail = WAITING_BUFFER_NEXT(waiting_buffer_tail);
+}
+
 /** \brief Waiting buffer clear
  *
  * FIXME: Needs docs
@@ -649,6 +705,8 @@ bool waiting_buffer_enq(keyrecord_t record) {
 void waiting_buffer_clear(void) {
     waiting_buffer_head = 0;
     waiting_buffer_tail = 0;
+    memset(waiting_buffer_presses, 0, sizeof(waiting_buffer_presses));
+    memset(waiting_buffer_releases, 0, sizeof(waiting_buffer_releases));
 }
 
 /** \brief Waiting buffer typed
@@ -656,7 +714,12 @@ void waiting_buffer_clear(void) {
  * FIXME: Needs docs
  */
 bool waiting_buffer_typed(keyevent_t event) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    const uint8_t *counts = event.pressed ? waiting_buffer_releases : waiting_buffer_presses;
+    if (counts[WAITING_BUFFER_KEY_BUCKET(event.key)] == 0) {
+        return false;
+    }
+
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = WAITING_BUFFER_NEXT(i)) {
         if (KEYEQ(event.key, waiting_buffer[i].event.key) && event.pressed != waiting_buffer[i].event.pressed) {
             return true;
         }
@@ -669,7 +732,7 @@ bool waiting_buffer_typed(keyevent_t event) {
  * FIXME: Needs docs
  */
 __attribute__((unused)) bool waiting_buffer_has_anykey_pressed(void) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = WAITING_BUFFER_NEXT(i)) {
         if (waiting_buffer[i].event.pressed) return true;
     }
     return false;
@@ -686,11 +749,15 @@ void waiting_buffer_scan_tap(void) {
     if ((tapping_key.tap.count > 0) || !tapping_key.event.pressed) {
         return;
     }
+    // - no release of the tapping key is buffered
+    if (waiting_buffer_releases[WAITING_BUFFER_KEY_BUCKET(tapping_key.event.key)] == 0) {
+        return;
+    }
 
 #    if (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
     TAP_DEFINE_KEYCODE;
 #    endif
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = WAITING_BUFFER_NEXT(i)) {
         keyrecord_t *candidate = &waiting_buffer[i];
         // clang-format off
         if (IS_EVENT(candidate->event) && KEYEQ(candidate->event.key, tapping_key.event.key) && !candidate->event.pressed && (
@@ -774,7 +841,7 @@ static uint8_t waiting_buffer_find_chordal_hold_tap(void) {
     keyrecord_t *prev         = &tapping_key;
     uint16_t     prev_keycode = get_record_keycode(&tapping_key, false);
     uint8_t      first_tap    = WAITING_BUFFER_SIZE;
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = WAITING_BUFFER_NEXT(i)) {
         keyrecord_t *  cur         = &waiting_buffer[i];
         const uint16_t cur_keycode = get_record_keycode(cur, false);
         if (!cur->event.pressed || !is_mt_or_lt(prev_keycode)) {
@@ -797,7 +864,7 @@ static void waiting_buffer_chordal_hold_taps_until(keypos_t key) {
             registered_taps_add(record->event.key);
         }
         process_record(record);
-        waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+        waiting_buffer_pop();
 
         if (KEYEQ(key, record->event.key) && record->event.pressed) {
             break;
@@ -806,7 +873,7 @@ static void waiting_buffer_chordal_hold_taps_until(keypos_t key) {
 }
 
 static void waiting_buffer_process_regular(void) {
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_pop()) {
         if (is_tap_record(&waiting_buffer[waiting_buffer_tail])) {
             break; // Stop once a tap-hold key event is reached.
         }
@@ -921,7 +988,7 @@ static void debug_tapping_key(void) {
 /** \brief Logs waiting buffer if ACTION_DEBUG is enabled. */
 static void debug_waiting_buffer(void) {
     ac_dprintf("{");
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = WAITING_BUFFER_NEXT(i)) {
         ac_dprintf(" [%u]=", i);
         debug_record(waiting_buffer[i]);
     }
@@ -32,12 +32,16 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define TAPPING_TOGGLE 5
 #endif
 
-#define WAITING_BUFFER_SIZE 8
+/* number of key events buffered while a tap-hold key is undecided */
+#ifndef WAITING_BUFFER_SIZE
+#    define WAITING_BUFFER_SIZE 8
+#endif
 
 #ifndef NO_ACTION_TAPPING
 uint16_t get_record_keycode(keyrecord_t *record, bool update_layer_cache);
 uint16_t get_event_keycode(keyevent_t event, bool update_layer_cache);
 void     action_tapping_process(keyrecord_t record);
+bool     action_tapping_next_deadline(uint32_t *deadline);
 #endif
 
 uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record);
@@ -19,6 +19,8 @@
         PROFILE_CALL_NAMED(1000, "matrix_task", {
             matrix_task();
         });
+
+    For min/max/mean/histogram statistics of named probes, see profiling.h (PROFILING_ENABLE).
 */
 
 #if defined(PROTOCOL_LUFA) || defined(PROTOCOL_VUSB)
@@ -97,14 +97,65 @@ rgb_t hsv_to_rgb_impl(hsv_t hsv, bool use_cie) {
     return rgb;
 }
 
-rgb_t hsv_to_rgb(hsv_t hsv) {
-#ifdef USE_CIE1931_CURVE
-    return hsv_to_rgb_impl(hsv, true);
+#if defined(USE_CIE1931_CURVE) && defined(RGB_MATRIX_OUTPUT_LUT)
+// Turned off by RGB Matrix while it renders, as its output tables apply the curve
+static bool hsv_to_rgb_cie = true;
+
+void hsv_to_rgb_cie_enable(bool enable) {
+    hsv_to_rgb_cie = enable;
+}
+#    define HSV_TO_RGB_CIE hsv_to_rgb_cie
+#elif defined(USE_CIE1931_CURVE)
+#    define HSV_TO_RGB_CIE true
 #else
-    return hsv_to_rgb_impl(hsv, false);
+#    define HSV_TO_RGB_CIE false
 #endif
+
+rgb_t hsv_to_rgb(hsv_t hsv) {
+    return hsv_to_rgb_impl(hsv, HSV_TO_RGB_CIE);
 }
 
 rgb_t hsv_to_rgb_nocie(hsv_t hsv) {
     return hsv_to_rgb_impl(hsv, false);
 }
+
+// Which of v, p, q and t become red, green and blue in each hue region
+static const uint8_t hsv_region_channels[7][3] = {
+    {0, 3, 1}, {2, 0, 1}, {1, 0, 3}, {1, 2, 0}, {3, 1, 0}, {0, 1, 2}, {0, 3, 1},
+};
+
+// The same math as hsv_to_rgb_impl(), without the branches, so the loop stays tight
+static inline void hsv_to_rgb_batch_impl(const hsv_t *hsv, rgb_t *rgb, uint8_t count, bool use_cie) {
+    for (uint8_t i = 0; i < count; i++) {
+        uint16_t h = hsv[i].h;
+        uint16_t s = hsv[i].s;
+#ifdef USE_CIE1931_CURVE
+        uint16_t v = use_cie ? pgm_read_byte(&CIE1931_CURVE[hsv[i].v]) : hsv[i].v;
+#else
+        uint16_t v = hsv[i].v;
+#endif
+
+        uint8_t region    = h * 6 / 255;
+        uint8_t remainder = (h * 2 - region * 85) * 3;
+
+        // With no saturation all channels are v, same as the early return of the scalar version
+        uint8_t values[4];
+        values[0] = v;
+        values[1] = s ? (v * (255 - s)) >> 8 : v;
+        values[2] = s ? (v * (255 - ((s * remainder) >> 8))) >> 8 : v;
+        values[3] = s ? (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8 : v;
+
+        const uint8_t *channels = hsv_region_channels[region];
+        rgb[i].r                = values[channels[0]];
+        rgb[i].g                = values[channels[1]];
+        rgb[i].b                = values[channels[2]];
+    }
+}
+
+void hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count) {
+    hsv_to_rgb_batch_impl(hsv, rgb, count, HSV_TO_RGB_CIE);
+}
+
+void hsv_to_rgb_batch_nocie(const hsv_t *hsv, rgb_t *rgb, uint8_t count) {
+    hsv_to_rgb_batch_impl(hsv, rgb, count, false);
+}
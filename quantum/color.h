@@ -95,3 +95,18 @@ typedef hsv_t HSV;
 
 rgb_t hsv_to_rgb(hsv_t hsv);
 rgb_t hsv_to_rgb_nocie(hsv_t hsv);
+
+#if defined(USE_CIE1931_CURVE) && defined(RGB_MATRIX_OUTPUT_LUT)
+// Whether hsv_to_rgb() and hsv_to_rgb_batch() apply the lightness curve, on unless turned off
+void hsv_to_rgb_cie_enable(bool enable);
+#endif
+
+/**
+ * @brief Converts `count` colors at once, the same as calling hsv_to_rgb() on each.
+ *
+ * @param hsv the colors to convert
+ * @param rgb[out] the converted colors, may not overlap `hsv`
+ * @param count the number of colors
+ */
+void hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count);
+void hsv_to_rgb_batch_nocie(const hsv_t *hsv, rgb_t *rgb, uint8_t count);
@@ -19,3 +19,11 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 void debounce_init(uint8_t num_rows);
 
 void debounce_free(void);
+
+/**
+ * @brief Whether any key is still being debounced, so debounce() has to be called again within a millisecond.
+ *
+ * @return true A debounce timer is running
+ * @return false Cooked only changes on the next raw change
+ */
+bool debounce_active(void);
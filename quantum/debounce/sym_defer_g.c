@@ -55,6 +55,10 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 }
 
 void debounce_free(void) {}
+
+bool debounce_active(void) {
+    return debouncing;
+}
 #else // no debouncing.
 #    include "none.c"
 #endif
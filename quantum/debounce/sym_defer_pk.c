@@ -70,6 +70,10 @@ void debounce_free(void) {
     debounce_counters = NULL;
 }
 
+bool debounce_active(void) {
+    return counters_need_update;
+}
+
 bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
     bool updated_last = false;
     cooked_changed    = false;
@@ -26,6 +26,7 @@ DEBOUNCE milliseconds have elapsed since the last change.
 #endif
 
 static uint16_t last_time;
+static uint8_t  countdown_rows;
 // [row] milliseconds until key's state is considered debounced.
 static uint8_t* countdowns;
 // [row]
@@ -35,14 +36,16 @@ void debounce_init(uint8_t num_rows) {
     countdowns = (uint8_t*)calloc(num_rows, sizeof(uint8_t));
     last_raw   = (matrix_row_t*)calloc(num_rows, sizeof(matrix_row_t));
 
-    last_time = timer_read();
+    countdown_rows = num_rows;
+    last_time      = timer_read();
 }
 
 void debounce_free(void) {
     free(countdowns);
     countdowns = NULL;
     free(last_raw);
-    last_raw = NULL;
+    last_raw       = NULL;
+    countdown_rows = 0;
 }
 
 bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
@@ -73,5 +76,10 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 }
 
 bool debounce_active(void) {
-    return true;
+    for (uint8_t row = 0; row < countdown_rows; ++row) {
+        if (countdowns[row]) {
+            return true;
+        }
+    }
+    return false;
 }
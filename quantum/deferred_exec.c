@@ -12,24 +12,113 @@
 //------------------------------------
 // Helpers
 //
+// Each table is kept as a binary min-heap ordered by trigger time, with all active executors packed at the start of the
+// table. The next executor to fire is always table[0], so the task only needs to look at executors which are actually due.
 
 static deferred_token current_token = 0;
 
-static inline bool token_can_be_used(deferred_executor_t *table, size_t table_count, deferred_token token) {
-    if (token == INVALID_DEFERRED_TOKEN) {
-        return false;
+static inline void clear_entry(deferred_executor_t *entry) {
+    entry->token        = INVALID_DEFERRED_TOKEN;
+    entry->lagging      = false;
+    entry->trigger_time = 0;
+    entry->callback     = NULL;
+    entry->cb_arg       = NULL;
+}
+
+static inline size_t heap_size(deferred_executor_t *table, size_t table_count) {
+    // Active executors are packed at the start of the table, so binary search for the first free slot
+    size_t lo = 0, hi = table_count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (table[mid].token == INVALID_DEFERRED_TOKEN) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return lo;
+}
+
+static inline bool fires_before(const deferred_executor_t *a, const deferred_executor_t *b) {
+    // Executors which fell behind during the current task invocation are ordered after everything else
+    if (a->lagging != b->lagging) {
+        return !a->lagging;
     }
-    for (int i = 0; i < table_count; ++i) {
+    return ((int32_t)TIMER_DIFF_32(a->trigger_time, b->trigger_time)) < 0;
+}
+
+static inline void swap_entries(deferred_executor_t *table, size_t a, size_t b) {
+    deferred_executor_t tmp = table[a];
+    table[a]                = table[b];
+    table[b]                = tmp;
+}
+
+static size_t sift_up(deferred_executor_t *table, size_t index) {
+    while (index > 0) {
+        size_t parent = (index - 1) / 2;
+        if (!fires_before(&table[index], &table[parent])) {
+            break;
+        }
+        swap_entries(table, index, parent);
+        index = parent;
+    }
+    return index;
+}
+
+static void sift_down(deferred_executor_t *table, size_t size, size_t index) {
+    while (true) {
+        size_t first = index;
+        size_t left  = 2 * index + 1;
+        size_t right = left + 1;
+        if (left < size && fires_before(&table[left], &table[first])) {
+            first = left;
+        }
+        if (right < size && fires_before(&table[right], &table[first])) {
+            first = right;
+        }
+        if (first == index) {
+            break;
+        }
+        swap_entries(table, index, first);
+        index = first;
+    }
+}
+
+static inline void reposition_entry(deferred_executor_t *table, size_t size, size_t index) {
+    sift_down(table, size, sift_up(table, index));
+}
+
+static void remove_entry(deferred_executor_t *table, size_t size, size_t index) {
+    // Move the last executor into the hole to keep the table packed, then restore ordering
+    size_t last = size - 1;
+    if (index != last) {
+        table[index] = table[last];
+    }
+    clear_entry(&table[last]);
+    if (index < last) {
+        reposition_entry(table, last, index);
+    }
+}
+
+static int find_entry(deferred_executor_t *table, size_t size, deferred_token token) {
+    for (int i = 0; i < size; ++i) {
         if (table[i].token == token) {
-            return false;
+            return i;
         }
     }
-    return true;
+    return -1;
+}
+
+static inline bool token_can_be_used(deferred_executor_t *table, size_t size, deferred_token token) {
+    if (token == INVALID_DEFERRED_TOKEN) {
+        return false;
+    }
+    return find_entry(table, size, token) < 0;
 }
 
-static inline deferred_token allocate_token(deferred_executor_t *table, size_t table_count) {
+static inline deferred_token allocate_token(deferred_executor_t *table, size_t size) {
     deferred_token first = ++current_token;
-    while (!token_can_be_used(table, table_count, current_token)) {
+    while (!token_can_be_used(table, size, current_token)) {
         ++current_token;
         if (current_token == first) {
             // If we've looped back around to the first, everything is already allocated (yikes!). Need to exit with a failure.
@@ -49,27 +138,27 @@ deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_coun
         return INVALID_DEFERRED_TOKEN;
     }
 
-    // Find an unused slot and claim it
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == INVALID_DEFERRED_TOKEN) {
-            // Work out the new token value, dropping out if none were available
-            deferred_token token = allocate_token(table, table_count);
-            if (token == INVALID_DEFERRED_TOKEN) {
-                return false;
-            }
+    // Claim the first unused slot, if any are available
+    size_t size = heap_size(table, table_count);
+    if (size == table_count) {
+        return INVALID_DEFERRED_TOKEN;
+    }
 
-            // Set up the executor table entry
-            entry->token        = current_token;
-            entry->trigger_time = timer_read32() + delay_ms;
-            entry->callback     = callback;
-            entry->cb_arg       = cb_arg;
-            return current_token;
-        }
+    // Work out the new token value, dropping out if none were available
+    deferred_token token = allocate_token(table, size);
+    if (token == INVALID_DEFERRED_TOKEN) {
+        return INVALID_DEFERRED_TOKEN;
     }
 
-    // None available
-    return INVALID_DEFERRED_TOKEN;
+    // Set up the executor table entry and move it into place
+    deferred_executor_t *entry = &table[size];
+    entry->token               = token;
+    entry->lagging             = false;
+    entry->trigger_time        = timer_read32() + delay_ms;
+    entry->callback            = callback;
+    entry->cb_arg              = cb_arg;
+    sift_up(table, size);
+    return token;
 }
 
 bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
@@ -79,17 +168,16 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, extend the delay
-            entry->trigger_time = timer_read32() + delay_ms;
-            return true;
-        }
+    size_t size  = heap_size(table, table_count);
+    int    index = find_entry(table, size, token);
+    if (index < 0) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, extend the delay and move it into place
+    table[index].trigger_time = timer_read32() + delay_ms;
+    reposition_entry(table, size, index);
+    return true;
 }
 
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
@@ -99,20 +187,24 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, cancel and clear the table entry
-            entry->token        = INVALID_DEFERRED_TOKEN;
-            entry->trigger_time = 0;
-            entry->callback     = NULL;
-            entry->cb_arg       = NULL;
-            return true;
-        }
+    size_t size  = heap_size(table, table_count);
+    int    index = find_entry(table, size, token);
+    if (index < 0) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, cancel and clear the table entry
+    remove_entry(table, size, index);
+    return true;
+}
+
+bool deferred_exec_advanced_next_trigger(deferred_executor_t *table, size_t table_count, uint32_t *trigger_time) {
+    if (!table || table_count == 0 || table[0].token == INVALID_DEFERRED_TOKEN) {
+        return false;
+    }
+
+    *trigger_time = table[0].trigger_time;
+    return true;
 }
 
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
@@ -122,35 +214,58 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
     if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
         *last_execution_time = now;
 
-        // Run through each of the executors
-        for (int i = 0; i < table_count; ++i) {
-            deferred_executor_t *entry      = &table[i];
-            deferred_token       curr_token = entry->token;
+        // Run through each of the executors which are due, earliest first
+        bool any_lagging = false;
+        while (table_count > 0 && table[0].token != INVALID_DEFERRED_TOKEN) {
+            deferred_executor_t *entry = &table[0];
 
-            // Check if we're supposed to execute this entry
-            if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
-                // Invoke the callback and work work out if we should be requeued
-                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+            // Stop once the next executor is in the future, or has already been invoked during this pass
+            if (entry->lagging || ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) > 0) {
+                break;
+            }
 
-                // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
-                if (entry->token != curr_token) {
-                    continue;
-                }
+            // Invoke the callback and work work out if we should be requeued
+            deferred_token curr_token = entry->token;
+            uint32_t       delay_ms   = entry->callback(entry->trigger_time, entry->cb_arg);
 
-                // Update the trigger time if we have to repeat, otherwise clear it out
-                if (delay_ms > 0) {
-                    // Intentionally add just the delay to the existing trigger time -- this ensures the next
-                    // invocation is with respect to the previous trigger, rather than when it got to execution. Under
-                    // normal circumstances this won't cause issue, but if another executor is invoked that takes a
-                    // considerable length of time, then this ensures best-effort timing between invocations.
-                    entry->trigger_time += delay_ms;
-                } else {
-                    // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
-                    entry->token        = INVALID_DEFERRED_TOKEN;
-                    entry->trigger_time = 0;
-                    entry->callback     = NULL;
-                    entry->cb_arg       = NULL;
+            // The callback may have modified the table. If the token is gone, then the callback has canceled and
+            // possibly re-queued. Skip further processing.
+            size_t size  = heap_size(table, table_count);
+            int    index = find_entry(table, size, curr_token);
+            if (index < 0) {
+                continue;
+            }
+            entry = &table[index];
+
+            // Update the trigger time if we have to repeat, otherwise clear it out
+            if (delay_ms > 0) {
+                // Intentionally add just the delay to the existing trigger time -- this ensures the next
+                // invocation is with respect to the previous trigger, rather than when it got to execution. Under
+                // normal circumstances this won't cause issue, but if another executor is invoked that takes a
+                // considerable length of time, then this ensures best-effort timing between invocations.
+                entry->trigger_time += delay_ms;
+
+                // If it's still due it has fallen behind; it catches up one invocation per task call, so park it
+                // behind everything else for the remainder of this pass.
+                if (((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
+                    entry->lagging = true;
+                    any_lagging    = true;
                 }
+                reposition_entry(table, size, index);
+            } else {
+                // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
+                remove_entry(table, size, index);
+            }
+        }
+
+        // Put any executors which fell behind back into trigger time order for the next pass
+        if (any_lagging) {
+            size_t size = heap_size(table, table_count);
+            for (size_t i = 0; i < size; ++i) {
+                table[i].lagging = false;
+            }
+            for (size_t i = size / 2; i-- > 0;) {
+                sift_down(table, size, i);
             }
         }
     }
@@ -175,3 +290,6 @@ bool cancel_deferred_exec(deferred_token token) {
 void deferred_exec_task(void) {
     deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
 }
+bool deferred_exec_next_trigger(uint32_t *trigger_time) {
+    return deferred_exec_advanced_next_trigger(basic_executors, MAX_DEFERRED_EXECUTORS, trigger_time);
+}
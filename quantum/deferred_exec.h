@@ -65,6 +65,14 @@ bool cancel_deferred_exec(deferred_token token);
  */
 void deferred_exec_task(void);
 
+/**
+ * Queries the time at which the next deferred execution is due.
+ *
+ * @param trigger_time[out] the trigger time of the earliest deferred execution -- equivalent time-space as timer_read32()
+ * @return true if a deferred execution is queued, otherwise false
+ */
+bool deferred_exec_next_trigger(uint32_t *trigger_time);
+
 //------------------------------------
 // Advanced API: used when a custom-allocated table is used, primarily for core code.
 //------------------------------------
@@ -76,6 +84,7 @@ void deferred_exec_task(void);
  */
 typedef struct deferred_executor_t {
     deferred_token         token;
+    bool                   lagging;
     uint32_t               trigger_time;
     deferred_exec_callback callback;
     void *                 cb_arg;
@@ -110,6 +119,16 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
  */
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token);
 
+/**
+ * Queries the time at which the next deferred execution in a custom table is due.
+ *
+ * @param table[in] the custom table used for storage
+ * @param table_count[in] the number of available items in the table
+ * @param trigger_time[out] the trigger time of the earliest deferred execution -- equivalent time-space as timer_read32()
+ * @return true if a deferred execution is queued, otherwise false
+ */
+bool deferred_exec_advanced_next_trigger(deferred_executor_t *table, size_t table_count, uint32_t *trigger_time);
+
 /**
  * Forward declaration for the main loop in order to execute any custom table deferred executors. Should not be invoked by keyboard/user code.
  * Needed for any custom-allocated deferred execution tables. Any core tasks should add appropriate invocation to quantum/main.c.
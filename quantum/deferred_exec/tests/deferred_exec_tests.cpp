@@ -0,0 +1,190 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "deferred_exec.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+struct callback_state_t {
+    std::vector<uint32_t> trigger_times;
+    uint32_t              repeat_ms;
+    uint32_t              invocations_left;
+};
+
+static std::vector<void *> invocation_order;
+
+static uint32_t record_callback(uint32_t trigger_time, void *cb_arg) {
+    auto *state = static_cast<callback_state_t *>(cb_arg);
+    state->trigger_times.push_back(trigger_time);
+    invocation_order.push_back(cb_arg);
+    if (state->invocations_left > 0 && --state->invocations_left > 0) {
+        return state->repeat_ms;
+    }
+    return 0;
+}
+
+class DeferredExec : public ::testing::Test {
+   protected:
+    static constexpr size_t table_count = 128;
+
+    deferred_executor_t table[table_count] = {};
+    uint32_t            last_exec          = 0;
+
+    void SetUp() override {
+        set_time(0);
+        invocation_order.clear();
+    }
+
+    void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            deferred_exec_advanced_task(table, table_count, &last_exec);
+        }
+    }
+
+    deferred_token defer(uint32_t delay_ms, callback_state_t *state) {
+        return defer_exec_advanced(table, table_count, delay_ms, record_callback, state);
+    }
+};
+
+TEST_F(DeferredExec, FiresOnceAfterDelay) {
+    callback_state_t state{{}, 0, 1};
+    EXPECT_NE(defer(10, &state), INVALID_DEFERRED_TOKEN);
+
+    run_for(9);
+    EXPECT_TRUE(state.trigger_times.empty());
+    run_for(1);
+    ASSERT_EQ(state.trigger_times.size(), 1);
+    EXPECT_EQ(state.trigger_times[0], 10);
+    run_for(100);
+    EXPECT_EQ(state.trigger_times.size(), 1);
+}
+
+TEST_F(DeferredExec, RepeatsRelativeToPreviousTrigger) {
+    callback_state_t state{{}, 5, 3};
+    defer(10, &state);
+
+    run_for(30);
+    EXPECT_EQ(state.trigger_times, (std::vector<uint32_t>{10, 15, 20}));
+}
+
+TEST_F(DeferredExec, FiresInTriggerTimeOrder) {
+    callback_state_t late{{}, 0, 1}, early{{}, 0, 1}, middle{{}, 0, 1};
+    defer(30, &late);
+    defer(10, &early);
+    defer(20, &middle);
+
+    uint32_t next = 0;
+    ASSERT_TRUE(deferred_exec_advanced_next_trigger(table, table_count, &next));
+    EXPECT_EQ(next, 10);
+
+    run_for(30);
+    EXPECT_EQ(invocation_order, (std::vector<void *>{&early, &middle, &late}));
+    EXPECT_FALSE(deferred_exec_advanced_next_trigger(table, table_count, &next));
+}
+
+TEST_F(DeferredExec, CancelAndExtend) {
+    callback_state_t cancelled{{}, 0, 1}, extended{{}, 0, 1};
+    deferred_token   cancel_token = defer(10, &cancelled);
+    deferred_token   extend_token = defer(10, &extended);
+
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, table_count, cancel_token));
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, table_count, cancel_token));
+
+    run_for(5);
+    EXPECT_TRUE(extend_deferred_exec_advanced(table, table_count, extend_token, 20));
+
+    uint32_t next = 0;
+    ASSERT_TRUE(deferred_exec_advanced_next_trigger(table, table_count, &next));
+    EXPECT_EQ(next, 25);
+
+    run_for(19);
+    EXPECT_TRUE(extended.trigger_times.empty());
+    run_for(1);
+    EXPECT_EQ(extended.trigger_times, (std::vector<uint32_t>{25}));
+    EXPECT_TRUE(cancelled.trigger_times.empty());
+    EXPECT_FALSE(extend_deferred_exec_advanced(table, table_count, extend_token, 20));
+}
+
+TEST_F(DeferredExec, TableFullReturnsInvalidToken) {
+    callback_state_t state{{}, 0, 1};
+    deferred_executor_t small_table[2] = {};
+    EXPECT_NE(defer_exec_advanced(small_table, 2, 10, record_callback, &state), INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(defer_exec_advanced(small_table, 2, 10, record_callback, &state), INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(defer_exec_advanced(small_table, 2, 10, record_callback, &state), INVALID_DEFERRED_TOKEN);
+}
+
+TEST_F(DeferredExec, LaggingExecutorCatchesUpWithoutStarvingOthers) {
+    callback_state_t lagging{{}, 1, 20}, other{{}, 0, 1};
+    defer(1, &lagging);
+    defer(5, &other);
+
+    // Skip ahead so that both are overdue, the repeating executor by far more than its interval
+    advance_time(10);
+    run_for(1);
+
+    // Both run on the first pass, the lagging one catches up by one invocation per pass
+    EXPECT_EQ(lagging.trigger_times, (std::vector<uint32_t>{1}));
+    EXPECT_EQ(other.trigger_times, (std::vector<uint32_t>{5}));
+
+    run_for(3);
+    EXPECT_EQ(lagging.trigger_times, (std::vector<uint32_t>{1, 2, 3, 4}));
+}
+
+TEST_F(DeferredExec, CallbackCanRequeueItself) {
+    struct requeue_state_t {
+        deferred_executor_t *table;
+        int                  invocations;
+    } state{table, 0};
+
+    auto requeue = [](uint32_t trigger_time, void *cb_arg) -> uint32_t {
+        auto *state = static_cast<requeue_state_t *>(cb_arg);
+        if (++state->invocations < 3) {
+            defer_exec_advanced(state->table, table_count, 2, +[](uint32_t, void *cb_arg) -> uint32_t { return 0; }, nullptr);
+        }
+        return 0;
+    };
+    defer_exec_advanced(table, table_count, 1, requeue, &state);
+
+    run_for(10);
+    EXPECT_EQ(state.invocations, 1);
+    uint32_t next = 0;
+    EXPECT_FALSE(deferred_exec_advanced_next_trigger(table, table_count, &next));
+}
+
+TEST_F(DeferredExec, BenchmarkManyActiveExecutors) {
+    constexpr size_t              active = 100;
+    std::vector<callback_state_t> states(active);
+
+    for (size_t i = 0; i < active; i++) {
+        states[i] = {{}, static_cast<uint32_t>(50 + i), UINT32_MAX};
+        ASSERT_NE(defer(50 + i, &states[i]), INVALID_DEFERRED_TOKEN);
+    }
+
+    constexpr uint32_t duration_ms = 20000;
+    auto               start       = std::chrono::steady_clock::now();
+    run_for(duration_ms);
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+    size_t invocations = 0;
+    for (size_t i = 0; i < active; i++) {
+        // Each executor keeps its own period
+        ASSERT_GE(states[i].trigger_times.size(), 2);
+        EXPECT_EQ(states[i].trigger_times[1] - states[i].trigger_times[0], 50 + i);
+        invocations += states[i].trigger_times.size();
+    }
+
+    double ns_per_task = elapsed.count() / duration_ms;
+    RecordProperty("ns_per_task", std::to_string(static_cast<uint64_t>(ns_per_task)));
+    std::cout << "[ BENCH    ] " << active << " active executors: " << static_cast<uint64_t>(ns_per_task) << " ns/task, " << invocations << " invocations" << std::endl;
+}
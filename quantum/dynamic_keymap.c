@@ -18,6 +18,7 @@
 #include "dynamic_keymap.h"
 #include "keymap_introspection.h"
 #include "action.h"
+#include "action_layer.h"
 #include "send_string.h"
 #include "keycodes.h"
 #include "nvm_dynamic_keymap.h"
@@ -42,6 +43,9 @@ uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column)
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     nvm_dynamic_keymap_update_keycode(layer, row, column, keycode);
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_CACHE_ENABLE)
+    layer_cache_invalidate();
+#endif
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -80,6 +84,9 @@ void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     nvm_dynamic_keymap_update_buffer(offset, size, data);
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_CACHE_ENABLE)
+    layer_cache_invalidate();
+#endif
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
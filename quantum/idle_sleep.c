@@ -0,0 +1,103 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "idle_sleep.h"
+#include "action.h"
+#include "action_tapping.h"
+#include "debounce.h"
+#include "keyboard.h"
+#include "matrix.h"
+#include "timer.h"
+#include "util.h"
+#ifdef DEFERRED_EXEC_ENABLE
+#    include "deferred_exec.h"
+#endif
+#ifdef COMBO_ENABLE
+#    include "process_combo.h"
+#endif
+#ifdef RGB_MATRIX_ENABLE
+#    include "rgb_matrix.h"
+#endif
+
+/* Custom matrices without a debounce algorithm have nothing to wait for. */
+__attribute__((weak)) bool debounce_active(void) {
+    return false;
+}
+
+__attribute__((weak)) bool idle_sleep_next_deadline_user(uint32_t *deadline) {
+    return false;
+}
+
+__attribute__((weak)) bool idle_sleep_next_deadline_kb(uint32_t *deadline) {
+    return idle_sleep_next_deadline_user(deadline);
+}
+
+/* Keeps the earlier of `*deadline` and `candidate`, returns true. */
+static bool earliest_deadline(bool found, uint32_t *deadline, uint32_t candidate) {
+    if (!found || (int32_t)TIMER_DIFF_32(candidate, *deadline) < 0) {
+        *deadline = candidate;
+    }
+    return true;
+}
+
+bool idle_sleep_next_deadline(uint32_t *deadline) {
+    uint32_t candidate;
+    bool     found = false;
+
+    if (debounce_active()) {
+        found = earliest_deadline(found, deadline, timer_read32() + 1);
+    }
+#ifdef MATRIX_INTERRUPT_WAKEUP
+    // Only an armed matrix raises an interrupt on key presses, otherwise it has to be polled.
+    // A split master polls anyway, the keys of the other half only reach it through the transport.
+#    ifdef SPLIT_KEYBOARD
+    if (matrix_wakeup_state() != MATRIX_WAKEUP_ARMED || is_keyboard_master()) {
+#    else
+    if (matrix_wakeup_state() != MATRIX_WAKEUP_ARMED) {
+#    endif
+        found = earliest_deadline(found, deadline, timer_read32() + 1);
+    }
+#endif
+#ifndef NO_ACTION_TAPPING
+    if (action_tapping_next_deadline(&candidate)) {
+        found = earliest_deadline(found, deadline, candidate);
+    }
+#endif
+#ifdef COMBO_ENABLE
+    if (combo_next_deadline(&candidate)) {
+        found = earliest_deadline(found, deadline, candidate);
+    }
+#endif
+#ifdef DEFERRED_EXEC_ENABLE
+    if (deferred_exec_next_trigger(&candidate)) {
+        found = earliest_deadline(found, deadline, candidate);
+    }
+#endif
+#ifdef RGB_MATRIX_ENABLE
+    if (rgb_matrix_next_deadline(&candidate)) {
+        found = earliest_deadline(found, deadline, candidate);
+    }
+#endif
+    if (idle_sleep_next_deadline_kb(&candidate)) {
+        found = earliest_deadline(found, deadline, candidate);
+    }
+
+    return found;
+}
+
+uint32_t idle_sleep_duration(void) {
+    uint32_t deadline;
+    if (!idle_sleep_next_deadline(&deadline)) {
+        return IDLE_SLEEP_MAX_MS;
+    }
+
+    int32_t remaining = TIMER_DIFF_32(deadline, timer_read32());
+    return remaining > 0 ? MIN((uint32_t)remaining, IDLE_SLEEP_MAX_MS) : 0;
+}
+
+void idle_sleep_task(void) {
+    uint32_t duration = idle_sleep_duration();
+    if (duration > 0) {
+        idle_sleep_platform_wait(duration);
+    }
+}
@@ -0,0 +1,57 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+    Lets the MCU wait between two passes of the main loop instead of spinning.
+
+    Before waiting, the next deadline is gathered from every module with pending
+    time-based work: deferred executors, the tapping term of an undecided tap-hold
+    key, the combo term, the RGB Matrix flush interval and keys that are still
+    being debounced. The wait ends at that deadline, after IDLE_SLEEP_MAX_MS, or
+    as soon as idle_sleep_wakeup() is called from an interrupt, whichever comes
+    first.
+*/
+
+#ifndef IDLE_SLEEP_MAX_MS
+#    define IDLE_SLEEP_MAX_MS 1
+#endif
+
+/**
+ * @brief Queries the earliest time at which keyboard_task() has pending work.
+ *
+ * @param deadline[out] the deadline, in the same time-space as timer_read32(); may already have passed
+ * @return true if any module has a deadline, otherwise false
+ */
+bool idle_sleep_next_deadline(uint32_t *deadline);
+
+/**
+ * @brief Keyboard level hook to add deadlines of its own, defaults to idle_sleep_next_deadline_user().
+ *
+ * @param deadline[out] the deadline, in the same time-space as timer_read32()
+ * @return true if `deadline` was set
+ */
+bool idle_sleep_next_deadline_kb(uint32_t *deadline);
+
+/** @brief User level hook to add deadlines of its own, see idle_sleep_next_deadline_kb(). */
+bool idle_sleep_next_deadline_user(uint32_t *deadline);
+
+/** @return the number of milliseconds the main loop may wait for, at most IDLE_SLEEP_MAX_MS */
+uint32_t idle_sleep_duration(void);
+
+/** @brief Waits for idle_sleep_duration() ms, if any. Called by the main loop. */
+void idle_sleep_task(void);
+
+/**
+ * @brief Platform specific wait of up to `ms` milliseconds.
+ *
+ * Returns early once idle_sleep_wakeup() is called.
+ */
+void idle_sleep_platform_wait(uint32_t ms);
+
+/** @brief Ends the current idle_sleep_platform_wait(), safe to call from interrupts. */
+void idle_sleep_wakeup(void);
@@ -32,6 +32,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "profiling.h"
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
@@ -122,6 +123,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef SPLIT_KEYBOARD
 #    include "split_util.h"
 #endif
+#if defined(SPLIT_COMMON_TRANSACTIONS) && defined(SPLIT_TRANSPORT_PUSH)
+#    include "transactions.h"
+#endif
+#ifdef SPLIT_LINK_STATS_ENABLE
+#    include "split_link.h"
+#endif
 #ifdef BATTERY_DRIVER
 #    include "battery.h"
 #endif
@@ -419,9 +426,11 @@ __attribute__((weak)) void housekeeping_task_user(void) {}
  * Invokes hooks for executing code after QMK is done after each loop iteration.
  */
 void housekeeping_task(void) {
-    housekeeping_task_modules();
-    housekeeping_task_kb();
-    housekeeping_task_user();
+    PROFILE_PROBE(HOUSEKEEPING_TASK, {
+        housekeeping_task_modules();
+        housekeeping_task_kb();
+        housekeeping_task_user();
+    });
 }
 
 /** \brief quantum_init
@@ -580,6 +589,11 @@ static inline void generate_tick_event(void) {
  * @brief This task scans the keyboards matrix and processes any key presses
  * that occur.
  *
+ * The matrix is compared against the previous state in a single pass which
+ * records a bitmap of the changed rows. Only those rows are then visited, and
+ * within a row only the changed columns, so the per-scan cost scales with the
+ * number of key changes rather than with the size of the matrix.
+ *
  * @return true Matrix did change
  * @return false Matrix didn't change
  */
@@ -590,11 +604,17 @@ static bool matrix_task(void) {
     }
 
     static matrix_row_t matrix_previous[MATRIX_ROWS];
+    matrix_row_t        matrix_changes[MATRIX_ROWS];
+    uint32_t            changed_rows[CEILING(MATRIX_ROWS, 32)] = {0};
+    bool                matrix_changed = false;
 
     matrix_scan();
-    bool matrix_changed = false;
-    for (uint8_t row = 0; row < MATRIX_ROWS && !matrix_changed; row++) {
-        matrix_changed |= matrix_previous[row] ^ matrix_get_row(row);
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix_changes[row] = matrix_get_row(row) ^ matrix_previous[row];
+        if (matrix_changes[row]) {
+            changed_rows[row / 32] |= (uint32_t)1 << (row % 32);
+            matrix_changed = true;
+        }
     }
 
     matrix_scan_perf_task();
@@ -611,28 +631,33 @@ static bool matrix_task(void) {
 
     const bool process_keypress = should_process_keypress();
 
-    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
-        const matrix_row_t current_row = matrix_get_row(row);
-        const matrix_row_t row_changes = current_row ^ matrix_previous[row];
+    for (uint8_t word = 0; word < ARRAY_SIZE(changed_rows); word++) {
+        for (uint32_t rows = changed_rows[word]; rows; rows &= rows - 1) {
+            const uint8_t      row         = (word * 32) + __builtin_ctzl(rows);
+            const matrix_row_t current_row = matrix_previous[row] ^ matrix_changes[row];
 
-        if (!row_changes || has_ghost_in_row(row, current_row)) {
-            continue;
-        }
+            if (has_ghost_in_row(row, current_row)) {
+                continue;
+            }
 
-        matrix_row_t col_mask = 1;
-        for (uint8_t col = 0; col < MATRIX_COLS; col++, col_mask <<= 1) {
-            if (row_changes & col_mask) {
-                const bool key_pressed = current_row & col_mask;
+            for (matrix_row_t row_changes = matrix_changes[row]; row_changes; row_changes &= row_changes - 1) {
+                const uint8_t col         = __builtin_ctzl(row_changes);
+                const bool    key_pressed = current_row & (MATRIX_ROW_SHIFTER << col);
 
                 if (process_keypress) {
-                    action_exec(MAKE_KEYEVENT(row, col, key_pressed));
+                    keyevent_t event = MAKE_KEYEVENT(row, col, key_pressed);
+#if defined(SPLIT_COMMON_TRANSACTIONS) && defined(SPLIT_TRANSPORT_PUSH)
+                    // Keys on the slave are timed from when the slave saw them change
+                    event.time = transactions_key_event_time(row, event.time);
+#endif
+                    action_exec(event);
                 }
 
                 switch_events(row, col, key_pressed);
             }
-        }
 
-        matrix_previous[row] = current_row;
+            matrix_previous[row] = current_row;
+        }
     }
 
     return matrix_changed;
@@ -720,12 +745,12 @@ void quantum_task(void) {
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
     __attribute__((unused)) bool activity_has_occurred = false;
-    if (matrix_task()) {
+    if (PROFILE_PROBE_RESULT(MATRIX_TASK, matrix_task())) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
 
-    quantum_task();
+    PROFILE_PROBE(QUANTUM_TASK, quantum_task());
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
     split_watchdog_task();
@@ -739,7 +764,7 @@ void keyboard_task(void) {
     led_matrix_task();
 #endif
 #ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_task();
+    PROFILE_PROBE(RGB_MATRIX_TASK, rgb_matrix_task());
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
@@ -756,7 +781,7 @@ void keyboard_task(void) {
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
-    if (pointing_device_task()) {
+    if (PROFILE_PROBE_RESULT(POINTING_DEVICE_TASK, pointing_device_task())) {
         last_pointing_device_activity_trigger();
         activity_has_occurred = true;
     }
@@ -812,4 +837,12 @@ void keyboard_task(void) {
 #ifdef OS_DETECTION_ENABLE
     os_detection_task();
 #endif
+
+#ifdef PROFILING_ENABLE
+    profiling_task();
+#endif
+
+#ifdef SPLIT_LINK_STATS_ENABLE
+    split_link_task();
+#endif
 }
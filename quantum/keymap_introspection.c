@@ -119,6 +119,17 @@ __attribute__((weak)) combo_t* combo_get(uint16_t combo_idx) {
     return combo_get_raw(combo_idx);
 }
 
+#    if defined(COMBO_INDEX_ENABLE)
+
+// One bit per combo for every bucket, set when any of the combo's keys hashes into that bucket
+static uint32_t combo_index[COMBO_INDEX_BUCKETS][COMBO_INDEX_WORDS(ARRAY_SIZE(key_combos))];
+
+uint32_t* combo_index_get_raw(uint8_t bucket) {
+    return combo_index[bucket];
+}
+
+#    endif // defined(COMBO_INDEX_ENABLE)
+
 #endif // defined(COMBO_ENABLE)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -66,6 +66,11 @@ combo_t* combo_get_raw(uint16_t combo_idx);
 // Get the combo definition, potentially stored dynamically
 combo_t* combo_get(uint16_t combo_idx);
 
+#    if defined(COMBO_INDEX_ENABLE)
+// Get the keycode to combo index bitmap for a bucket, sized for the combos stored in firmware
+uint32_t* combo_index_get_raw(uint8_t bucket);
+#    endif // defined(COMBO_INDEX_ENABLE)
+
 #endif // defined(COMBO_ENABLE)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,81 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "led_power.h"
+#include "timer.h"
+#include "util.h"
+
+#if LED_POWER_BUDGET > UINT16_MAX
+#    error "LED_POWER_BUDGET is limited to 65535 mA"
+#endif
+
+// The colours asked of each LED, and the sum of what they draw, in mA * 255
+static rgb_t    led_power_colors[LED_POWER_LED_COUNT];
+static uint32_t led_power_load          = 0;
+static uint16_t led_power_target        = LED_POWER_SCALE_FULL;
+static uint16_t led_power_current_scale = LED_POWER_SCALE_FULL;
+// The scale the recovery started from, and when, so updates of any frequency add up to the same ramp
+static uint16_t led_power_release_scale = LED_POWER_SCALE_FULL;
+static uint32_t led_power_release_timer = 0;
+
+static uint32_t led_power_load_of(rgb_t rgb) {
+    return (uint32_t)rgb.r * LED_POWER_RED_MA + (uint32_t)rgb.g * LED_POWER_GREEN_MA + (uint32_t)rgb.b * LED_POWER_BLUE_MA;
+}
+
+static rgb_t led_power_scaled(rgb_t rgb) {
+    if (led_power_current_scale == LED_POWER_SCALE_FULL) {
+        return rgb;
+    }
+    return (rgb_t){
+        .r = rgb.r * led_power_current_scale >> 8,
+        .g = rgb.g * led_power_current_scale >> 8,
+        .b = rgb.b * led_power_current_scale >> 8,
+    };
+}
+
+rgb_t led_power_set_color(uint16_t led, uint8_t red, uint8_t green, uint8_t blue) {
+    rgb_t rgb = {.r = red, .g = green, .b = blue};
+    if (led < LED_POWER_LED_COUNT) {
+        led_power_load -= led_power_load_of(led_power_colors[led]);
+        led_power_load += led_power_load_of(rgb);
+        led_power_colors[led] = rgb;
+    }
+    return led_power_scaled(rgb);
+}
+
+rgb_t led_power_get_color(uint16_t led) {
+    return led < LED_POWER_LED_COUNT ? led_power_scaled(led_power_colors[led]) : (rgb_t){0};
+}
+
+uint32_t led_power_estimate(void) {
+    return led_power_load / 255;
+}
+
+uint16_t led_power_update(void) {
+    const uint32_t budget = (uint32_t)LED_POWER_BUDGET * 255;
+    led_power_target      = led_power_load <= budget ? LED_POWER_SCALE_FULL : budget * LED_POWER_SCALE_FULL / led_power_load;
+
+    if (led_power_current_scale < led_power_target) {
+        uint32_t elapsed        = MIN(timer_elapsed32(led_power_release_timer), LED_POWER_RELEASE_TIME);
+        uint32_t step           = elapsed * LED_POWER_SCALE_FULL / LED_POWER_RELEASE_TIME;
+        led_power_current_scale = MIN(led_power_target, led_power_release_scale + step);
+    } else {
+        // Over budget, drop right away
+        led_power_current_scale = led_power_target;
+    }
+
+    if (led_power_current_scale == led_power_target) {
+        // Any recovery starts from here
+        led_power_release_scale = led_power_current_scale;
+        led_power_release_timer = timer_read32();
+    }
+    return led_power_current_scale;
+}
+
+uint16_t led_power_scale(void) {
+    return led_power_current_scale;
+}
+
+bool led_power_settled(void) {
+    return led_power_current_scale == led_power_target;
+}
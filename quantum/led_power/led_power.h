@@ -0,0 +1,101 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "color.h"
+
+/*
+    Estimates the current drawn by the RGB Matrix and RGBLight LEDs, and scales
+    their colours down so that together they stay within LED_POWER_BUDGET mA.
+    Enabled with LED_POWER_ENABLE = yes in rules.mk, the budget is set in
+    config.h.
+
+    Each lighting feature hands every colour it sends to its driver through
+    led_power_set_color(), which keeps the total up to date from the LEDs that
+    changed. Before flushing, it calls led_power_update() and sends all of its
+    LEDs again through led_power_get_color() if the scale changed since.
+
+    The scale drops at once when a frame goes over the budget, and rises back
+    over LED_POWER_RELEASE_TIME once it is under, so the LEDs do not pump.
+*/
+
+#ifndef LED_POWER_BUDGET
+#    error "LED_POWER_ENABLE needs LED_POWER_BUDGET, the mA available to the LEDs"
+#endif
+
+/* Current drawn by one channel of one LED at full value, in mA. */
+#ifndef LED_POWER_RED_MA
+#    define LED_POWER_RED_MA 20
+#endif
+#ifndef LED_POWER_GREEN_MA
+#    define LED_POWER_GREEN_MA 20
+#endif
+#ifndef LED_POWER_BLUE_MA
+#    define LED_POWER_BLUE_MA 20
+#endif
+
+/* Time for the scale to recover from nothing to full, in ms. */
+#ifndef LED_POWER_RELEASE_TIME
+#    define LED_POWER_RELEASE_TIME 500
+#endif
+
+/* How often the lighting features update while the scale recovers, in ms. */
+#ifndef LED_POWER_UPDATE_INTERVAL
+#    define LED_POWER_UPDATE_INTERVAL 16
+#endif
+
+/* Where the LEDs of each feature are kept, by driver index. */
+#ifdef RGB_MATRIX_ENABLE
+#    define LED_POWER_RGB_MATRIX_COUNT RGB_MATRIX_LED_COUNT
+#else
+#    define LED_POWER_RGB_MATRIX_COUNT 0
+#endif
+#ifdef RGBLIGHT_ENABLE
+#    define LED_POWER_RGBLIGHT_COUNT RGBLIGHT_LED_COUNT
+#else
+#    define LED_POWER_RGBLIGHT_COUNT 0
+#endif
+#define LED_POWER_RGB_MATRIX_FIRST 0
+#define LED_POWER_RGBLIGHT_FIRST (LED_POWER_RGB_MATRIX_FIRST + LED_POWER_RGB_MATRIX_COUNT)
+#define LED_POWER_LED_COUNT (LED_POWER_RGBLIGHT_FIRST + LED_POWER_RGBLIGHT_COUNT)
+
+/* Scale of the colours when within budget, out of 256. */
+#define LED_POWER_SCALE_FULL 256
+
+/**
+ * @brief Records the colour asked of an LED.
+ *
+ * @param led the LED, from LED_POWER_RGB_MATRIX_FIRST or LED_POWER_RGBLIGHT_FIRST, out of range LEDs are ignored
+ * @return the colour to send to the driver, scaled to the current budget
+ */
+rgb_t led_power_set_color(uint16_t led, uint8_t red, uint8_t green, uint8_t blue);
+
+/**
+ * @return the last colour recorded for an LED, scaled to the current budget
+ */
+rgb_t led_power_get_color(uint16_t led);
+
+/**
+ * @return the current all LEDs would draw at the colours asked of them, in mA
+ */
+uint32_t led_power_estimate(void);
+
+/**
+ * @brief Moves the scale towards what keeps the LEDs within budget.
+ *
+ * @return the scale out of LED_POWER_SCALE_FULL
+ */
+uint16_t led_power_update(void);
+
+/**
+ * @return the scale out of LED_POWER_SCALE_FULL, as of the last update
+ */
+uint16_t led_power_scale(void);
+
+/**
+ * @return false while the scale is still recovering towards what the budget allows
+ */
+bool led_power_settled(void);
@@ -0,0 +1,139 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "led_power.h"
+}
+
+extern "C" {
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+class LedPower : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        for (uint16_t i = 0; i < LED_POWER_LED_COUNT; i++) {
+            led_power_set_color(i, 0, 0, 0);
+        }
+        set_time(0);
+        advance_time(LED_POWER_RELEASE_TIME);
+        led_power_update();
+    }
+
+    void set_all(uint16_t first, uint16_t count, uint8_t red, uint8_t green, uint8_t blue) {
+        for (uint16_t i = first; i < first + count; i++) {
+            led_power_set_color(i, red, green, blue);
+        }
+    }
+};
+
+TEST_F(LedPower, EstimateSumsTheChannels) {
+    led_power_set_color(0, 255, 0, 0);
+    EXPECT_EQ(led_power_estimate(), LED_POWER_RED_MA);
+    led_power_set_color(1, 255, 255, 255);
+    EXPECT_EQ(led_power_estimate(), LED_POWER_RED_MA + LED_POWER_RED_MA + LED_POWER_GREEN_MA + LED_POWER_BLUE_MA);
+}
+
+TEST_F(LedPower, ChangedLedReplacesItsLoad) {
+    led_power_set_color(0, 255, 255, 255);
+    led_power_set_color(0, 0, 0, 255);
+    EXPECT_EQ(led_power_estimate(), LED_POWER_BLUE_MA);
+    led_power_set_color(0, 0, 0, 0);
+    EXPECT_EQ(led_power_estimate(), 0);
+}
+
+TEST_F(LedPower, UnderBudgetIsNotScaled) {
+    led_power_set_color(0, 255, 255, 255);
+    EXPECT_EQ(led_power_update(), LED_POWER_SCALE_FULL);
+    EXPECT_TRUE(led_power_settled());
+
+    rgb_t rgb = led_power_get_color(0);
+    EXPECT_EQ(rgb.r, 255);
+    EXPECT_EQ(rgb.g, 255);
+    EXPECT_EQ(rgb.b, 255);
+}
+
+TEST_F(LedPower, OverBudgetDropsAtOnce) {
+    set_all(LED_POWER_RGB_MATRIX_FIRST, LED_POWER_RGB_MATRIX_COUNT, 255, 255, 255);
+    uint16_t scale = led_power_update();
+    EXPECT_LT(scale, LED_POWER_SCALE_FULL);
+    EXPECT_TRUE(led_power_settled());
+
+    uint32_t scaled = 0;
+    for (uint16_t i = 0; i < LED_POWER_LED_COUNT; i++) {
+        rgb_t rgb = led_power_get_color(i);
+        scaled += (uint32_t)rgb.r * LED_POWER_RED_MA + (uint32_t)rgb.g * LED_POWER_GREEN_MA + (uint32_t)rgb.b * LED_POWER_BLUE_MA;
+    }
+    EXPECT_LE(scaled / 255, LED_POWER_BUDGET);
+}
+
+TEST_F(LedPower, SetColorReturnsScaled) {
+    set_all(LED_POWER_RGB_MATRIX_FIRST, LED_POWER_RGB_MATRIX_COUNT, 255, 255, 255);
+    uint16_t scale = led_power_update();
+
+    rgb_t rgb = led_power_set_color(0, 255, 128, 0);
+    EXPECT_EQ(rgb.r, 255 * scale >> 8);
+    EXPECT_EQ(rgb.g, 128 * scale >> 8);
+    EXPECT_EQ(rgb.b, 0);
+}
+
+TEST_F(LedPower, RecoversOverReleaseTime) {
+    set_all(LED_POWER_RGB_MATRIX_FIRST, LED_POWER_RGB_MATRIX_COUNT, 255, 255, 255);
+    uint16_t low = led_power_update();
+
+    set_all(LED_POWER_RGB_MATRIX_FIRST, LED_POWER_RGB_MATRIX_COUNT, 0, 0, 0);
+    advance_time(LED_POWER_RELEASE_TIME / 4);
+    uint16_t rising = led_power_update();
+    EXPECT_GT(rising, low);
+    EXPECT_LT(rising, LED_POWER_SCALE_FULL);
+    EXPECT_FALSE(led_power_settled());
+
+    advance_time(LED_POWER_RELEASE_TIME);
+    EXPECT_EQ(led_power_update(), LED_POWER_SCALE_FULL);
+    EXPECT_TRUE(led_power_settled());
+}
+
+TEST_F(LedPower, RecoversWhenUpdatedEveryMillisecond) {
+    set_all(LED_POWER_RGB_MATRIX_FIRST, LED_POWER_RGB_MATRIX_COUNT, 255, 255, 255);
+    uint16_t low = led_power_update();
+
+    set_all(LED_POWER_RGB_MATRIX_FIRST, LED_POWER_RGB_MATRIX_COUNT, 0, 0, 0);
+    uint16_t last = low;
+    for (uint32_t t = 0; t < LED_POWER_RELEASE_TIME / 2; t++) {
+        advance_time(1);
+        uint16_t scale = led_power_update();
+        EXPECT_GE(scale, last);
+        last = scale;
+    }
+    // Halfway through, as with a single update
+    EXPECT_NEAR(last, low + LED_POWER_SCALE_FULL / 2, 1);
+
+    for (uint32_t t = 0; t < LED_POWER_RELEASE_TIME / 2; t++) {
+        advance_time(1);
+        led_power_update();
+    }
+    EXPECT_EQ(led_power_scale(), LED_POWER_SCALE_FULL);
+    EXPECT_TRUE(led_power_settled());
+}
+
+TEST_F(LedPower, OutOfRangeLedsAreIgnored) {
+    rgb_t rgb = led_power_set_color(LED_POWER_LED_COUNT, 255, 255, 255);
+    EXPECT_EQ(rgb.r, 255);
+    EXPECT_EQ(led_power_estimate(), 0);
+
+    rgb = led_power_get_color(LED_POWER_LED_COUNT);
+    EXPECT_EQ(rgb.r, 0);
+}
+
+TEST_F(LedPower, FeaturesShareOneBudget) {
+    // Each range alone stays within budget, both together do not
+    led_power_set_color(LED_POWER_RGB_MATRIX_FIRST, 255, 255, 255);
+    EXPECT_EQ(led_power_update(), LED_POWER_SCALE_FULL);
+
+    led_power_set_color(LED_POWER_RGBLIGHT_FIRST, 255, 255, 255);
+    EXPECT_EQ(led_power_estimate(), 2 * (LED_POWER_RED_MA + LED_POWER_GREEN_MA + LED_POWER_BLUE_MA));
+    EXPECT_LT(led_power_update(), LED_POWER_SCALE_FULL);
+}
@@ -0,0 +1,8 @@
+led_power_DEFS := -DLED_POWER_ENABLE -DLED_POWER_BUDGET=100 -DRGB_MATRIX_ENABLE -DRGB_MATRIX_LED_COUNT=16 -DRGBLIGHT_ENABLE -DRGBLIGHT_LED_COUNT=4
+led_power_INC := $(QUANTUM_PATH)/led_power
+
+led_power_SRC := \
+	$(QUANTUM_PATH)/led_power/tests/led_power_tests.cpp \
+	$(QUANTUM_PATH)/led_power/led_power.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
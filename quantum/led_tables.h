@@ -18,6 +18,31 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "progmem.h"
 #include <stdint.h>
 
+// clang-format off
+
+// Lightness curve using the CIE 1931 lightness formula, as X(value) for each of the 256 inputs,
+// so that other tables can be built from it at compile time
+// Generated by the python script provided in http://jared.geek.nz/2013/feb/linear-led-pwm
+#define CIE1931_CURVE_VALUES(X) \
+    X(  0) X(  1) X(  1) X(  1) X(  1) X(  1) X(  1) X(  1) X(  1) X(  1) X(  2) X(  2) X(  2) X(  2) X(  2) X(  2) \
+    X(  2) X(  2) X(  2) X(  3) X(  3) X(  3) X(  3) X(  3) X(  3) X(  3) X(  3) X(  4) X(  4) X(  4) X(  4) X(  4) \
+    X(  4) X(  4) X(  5) X(  5) X(  5) X(  5) X(  5) X(  6) X(  6) X(  6) X(  6) X(  6) X(  7) X(  7) X(  7) X(  7) \
+    X(  7) X(  8) X(  8) X(  8) X(  8) X(  9) X(  9) X(  9) X(  9) X( 10) X( 10) X( 10) X( 11) X( 11) X( 11) X( 12) \
+    X( 12) X( 12) X( 13) X( 13) X( 13) X( 14) X( 14) X( 14) X( 15) X( 15) X( 15) X( 16) X( 16) X( 17) X( 17) X( 17) \
+    X( 18) X( 18) X( 19) X( 19) X( 20) X( 20) X( 21) X( 21) X( 22) X( 22) X( 23) X( 23) X( 24) X( 24) X( 25) X( 25) \
+    X( 26) X( 26) X( 27) X( 27) X( 28) X( 29) X( 29) X( 30) X( 30) X( 31) X( 32) X( 32) X( 33) X( 34) X( 34) X( 35) \
+    X( 36) X( 36) X( 37) X( 38) X( 38) X( 39) X( 40) X( 41) X( 41) X( 42) X( 43) X( 44) X( 45) X( 45) X( 46) X( 47) \
+    X( 48) X( 49) X( 50) X( 50) X( 51) X( 52) X( 53) X( 54) X( 55) X( 56) X( 57) X( 58) X( 59) X( 60) X( 61) X( 62) \
+    X( 63) X( 64) X( 65) X( 66) X( 67) X( 68) X( 69) X( 70) X( 71) X( 72) X( 73) X( 74) X( 76) X( 77) X( 78) X( 79) \
+    X( 80) X( 81) X( 83) X( 84) X( 85) X( 86) X( 88) X( 89) X( 90) X( 91) X( 93) X( 94) X( 95) X( 97) X( 98) X(100) \
+    X(101) X(102) X(104) X(105) X(107) X(108) X(109) X(111) X(112) X(114) X(115) X(117) X(119) X(120) X(122) X(123) \
+    X(125) X(126) X(128) X(130) X(131) X(133) X(135) X(136) X(138) X(140) X(142) X(143) X(145) X(147) X(149) X(150) \
+    X(152) X(154) X(156) X(158) X(160) X(162) X(163) X(165) X(167) X(169) X(171) X(173) X(175) X(177) X(179) X(181) \
+    X(183) X(186) X(188) X(190) X(192) X(194) X(196) X(198) X(201) X(203) X(205) X(207) X(209) X(212) X(214) X(216) \
+    X(219) X(221) X(223) X(226) X(228) X(231) X(233) X(235) X(238) X(240) X(243) X(245) X(248) X(250) X(253) X(255)
+
+// clang-format on
+
 #ifdef USE_CIE1931_CURVE
 extern const uint8_t CIE1931_CURVE[] PROGMEM;
 #endif
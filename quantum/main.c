@@ -73,5 +73,11 @@ int main(void) {
 #endif // DEFERRED_EXEC_ENABLE
 
         housekeeping_task();
+
+#ifdef IDLE_SLEEP_ENABLE
+        // Wait for the next deadline instead of spinning
+        void idle_sleep_task(void);
+        idle_sleep_task();
+#endif // IDLE_SLEEP_ENABLE
     }
 }
@@ -21,6 +21,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "matrix.h"
 #include "debounce.h"
 #include "atomic_util.h"
+#ifdef IDLE_SLEEP_ENABLE
+#    include "idle_sleep.h"
+#endif
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
@@ -60,6 +63,56 @@ static SPLIT_MUTABLE_ROW pin_t row_pins[ROWS_PER_HAND] = MATRIX_ROW_PINS;
 #    ifdef MATRIX_COL_PINS
 static SPLIT_MUTABLE_COL pin_t col_pins[MATRIX_COLS]   = MATRIX_COL_PINS;
 #    endif // MATRIX_COL_PINS
+#    if (DIODE_DIRECTION == COL2ROW) && defined(MATRIX_COL_PORT_READS) && defined(gpio_read_port) && (!defined(MATRIX_COL_PINS_RIGHT) || defined(MATRIX_COL_PORT_READS_RIGHT))
+#        define MATRIX_COL_PORT_READ
+// Columns sharing a GPIO port, generated from info.json
+typedef struct {
+    pin_t    pin;   // any column pin of the port
+    uint32_t mask;  // port bits of the columns
+    int8_t   shift; // column index minus port bit
+} matrix_port_read_t;
+
+static const matrix_port_read_t col_port_reads_left[] = MATRIX_COL_PORT_READS;
+#        ifdef MATRIX_COL_PORT_READS_RIGHT
+static const matrix_port_read_t col_port_reads_right[] = MATRIX_COL_PORT_READS_RIGHT;
+#        endif
+static const matrix_port_read_t *col_port_reads      = col_port_reads_left;
+static uint8_t                   col_port_read_count = ARRAY_SIZE(col_port_reads_left);
+
+/**
+ * @brief Drops the port reads unless they cover exactly the column pins, each entry starting at the
+ * pin it names, so port reads made for other pins fall back to reading the columns one by one.
+ */
+static void matrix_col_port_reads_check(void) {
+    matrix_row_t wired = 0, covered = 0;
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        if (col_pins[col] != NO_PIN) {
+            wired |= MATRIX_ROW_SHIFTER << col;
+        }
+    }
+
+    for (uint8_t i = 0; i < col_port_read_count; i++) {
+        uint32_t mask  = col_port_reads[i].mask;
+        int8_t   shift = col_port_reads[i].shift;
+        uint8_t  bit   = 0;
+        while (bit < 32 && !(mask & (1UL << bit))) {
+            bit++;
+        }
+
+        int16_t      first = bit + shift;
+        matrix_row_t cols  = (matrix_row_t)(shift >= 0 ? mask << shift : mask >> -shift);
+        if (bit == 32 || first < 0 || first >= MATRIX_COLS || col_pins[first] != col_port_reads[i].pin || (covered & cols)) {
+            col_port_read_count = 0;
+            return;
+        }
+        covered |= cols;
+    }
+
+    if (covered != wired) {
+        col_port_read_count = 0;
+    }
+}
+#    endif // MATRIX_COL_PORT_READ
 #endif
 
 /* matrix state(1:on, 0:off) */
@@ -181,13 +234,31 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     }
     matrix_output_select_delay();
 
-    // For each col...
-    matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
-    for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
-        uint8_t pin_state = readMatrixPin(col_pins[col_index]);
-
-        // Populate the matrix row with the state of the col pin
-        current_row_value |= pin_state ? 0 : row_shifter;
+#            ifdef MATRIX_COL_PORT_READ
+    if (col_port_read_count > 0) {
+        // For each port...
+        for (uint8_t i = 0; i < col_port_read_count; i++) {
+            uint32_t pressed = gpio_read_port(col_port_reads[i].pin);
+#                if MATRIX_INPUT_PRESSED_STATE == 0
+            pressed = ~pressed;
+#                endif
+            pressed &= col_port_reads[i].mask;
+
+            // Move the port bits to their columns
+            int8_t shift = col_port_reads[i].shift;
+            current_row_value |= (matrix_row_t)(shift >= 0 ? pressed << shift : pressed >> -shift);
+        }
+    } else
+#            endif
+    {
+        // For each col...
+        matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+        for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
+            uint8_t pin_state = readMatrixPin(col_pins[col_index]);
+
+            // Populate the matrix row with the state of the col pin
+            current_row_value |= pin_state ? 0 : row_shifter;
+        }
     }
 
     // Unselect row
@@ -270,6 +341,142 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
 #    error DIODE_DIRECTION is not defined!
 #endif
 
+#ifdef MATRIX_INTERRUPT_WAKEUP
+#    ifndef MATRIX_WAKEUP_IDLE_SCANS
+#        define MATRIX_WAKEUP_IDLE_SCANS 10
+#    endif
+
+#    if defined(DIRECT_PINS)
+#        define MATRIX_WAKEUP_INPUTS (ROWS_PER_HAND * MATRIX_COLS)
+#        define MATRIX_WAKEUP_INPUT(i) (direct_pins[(i) / MATRIX_COLS][(i) % MATRIX_COLS])
+#    elif (DIODE_DIRECTION == COL2ROW)
+#        define MATRIX_WAKEUP_INPUTS MATRIX_COLS
+#        define MATRIX_WAKEUP_INPUT(i) (col_pins[i])
+#    elif (DIODE_DIRECTION == ROW2COL)
+#        define MATRIX_WAKEUP_INPUTS ROWS_PER_HAND
+#        define MATRIX_WAKEUP_INPUT(i) (row_pins[i])
+#    endif
+
+static matrix_wakeup_state_t wakeup_state      = MATRIX_WAKEUP_SCANNING;
+static uint8_t               wakeup_idle_scans = 0;
+static volatile bool         wakeup_pin_event  = false;
+
+// Platforms without pin interrupts keep the matrix polled.
+__attribute__((weak)) bool matrix_wakeup_pin_enable(pin_t pin, uint8_t pressed_state) {
+    return false;
+}
+
+__attribute__((weak)) void matrix_wakeup_pin_disable(pin_t pin) {}
+
+matrix_wakeup_state_t matrix_wakeup_state(void) {
+    return wakeup_state;
+}
+
+void matrix_wakeup_pin_event(void) {
+    wakeup_pin_event = true;
+#    ifdef IDLE_SLEEP_ENABLE
+    idle_sleep_wakeup();
+#    endif
+}
+
+static void matrix_wakeup_disarm(void) {
+    for (uint8_t i = 0; i < MATRIX_WAKEUP_INPUTS; i++) {
+        if (MATRIX_WAKEUP_INPUT(i) != NO_PIN) {
+            matrix_wakeup_pin_disable(MATRIX_WAKEUP_INPUT(i));
+        }
+    }
+#    if defined(DIRECT_PINS)
+    // direct pins have no select lines
+#    elif (DIODE_DIRECTION == COL2ROW)
+    unselect_rows();
+#    elif (DIODE_DIRECTION == ROW2COL)
+    unselect_cols();
+#    endif
+}
+
+/**
+ * @brief Selects every line at once and arms the input pins, so that any key press causes an edge.
+ *
+ * Interrupts are enabled before the inputs are checked, so a key pressed since the last scan is
+ * either seen here or raises the event.
+ *
+ * @return false if a key is already pressed or the platform cannot arm every input
+ */
+static bool matrix_wakeup_arm(void) {
+    bool armed       = true;
+    wakeup_pin_event = false;
+
+#    if defined(DIRECT_PINS)
+    // direct pins have no select lines
+#    elif (DIODE_DIRECTION == COL2ROW)
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        select_row(row);
+    }
+    matrix_output_select_delay();
+#    elif (DIODE_DIRECTION == ROW2COL)
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        select_col(col);
+    }
+    matrix_output_select_delay();
+#    endif
+
+    for (uint8_t i = 0; i < MATRIX_WAKEUP_INPUTS && armed; i++) {
+        pin_t pin = MATRIX_WAKEUP_INPUT(i);
+        if (pin != NO_PIN) {
+            armed = matrix_wakeup_pin_enable(pin, MATRIX_INPUT_PRESSED_STATE) && readMatrixPin(pin);
+        }
+    }
+
+    if (!armed) {
+        matrix_wakeup_disarm();
+    }
+    return armed;
+}
+
+/* Leaves the armed state once an edge was seen, @return true if the matrix has to be read */
+static bool matrix_wakeup_scan_needed(void) {
+    if (wakeup_state != MATRIX_WAKEUP_ARMED) {
+        return true;
+    }
+    if (!wakeup_pin_event) {
+        return false;
+    }
+
+    matrix_wakeup_disarm();
+    matrix_output_unselect_delay(0, true); // wait for all inputs to be released by the select lines
+    wakeup_state = MATRIX_WAKEUP_SCANNING;
+    return true;
+}
+
+/* Arms the wakeup after MATRIX_WAKEUP_IDLE_SCANS scans without any pressed or bouncing key. */
+static void matrix_wakeup_scanned(void) {
+    if (wakeup_state == MATRIX_WAKEUP_ARMED) {
+        return;
+    }
+
+    bool active = debounce_active();
+    for (uint8_t row = 0; row < ROWS_PER_HAND && !active; row++) {
+        active = raw_matrix[row] != 0;
+    }
+    if (active) {
+        wakeup_state      = MATRIX_WAKEUP_SCANNING;
+        wakeup_idle_scans = 0;
+        return;
+    }
+
+    wakeup_state = MATRIX_WAKEUP_IDLE;
+    if (++wakeup_idle_scans >= MATRIX_WAKEUP_IDLE_SCANS) {
+        wakeup_idle_scans = 0;
+        if (matrix_wakeup_arm()) {
+            wakeup_state = MATRIX_WAKEUP_ARMED;
+        }
+    }
+}
+#else
+#    define matrix_wakeup_scan_needed() true
+#    define matrix_wakeup_scanned()
+#endif
+
 void matrix_init(void) {
 #ifdef SPLIT_KEYBOARD
     // Set pinout for right half if pinout for that half is defined
@@ -293,6 +500,10 @@ void matrix_init(void) {
         for (uint8_t i = 0; i < MATRIX_COLS; i++) {
             col_pins[i] = col_pins_right[i];
         }
+#    endif
+#    if defined(MATRIX_COL_PORT_READ) && defined(MATRIX_COL_PORT_READS_RIGHT)
+        col_port_reads      = col_port_reads_right;
+        col_port_read_count = ARRAY_SIZE(col_port_reads_right);
 #    endif
     }
 
@@ -300,8 +511,16 @@ void matrix_init(void) {
     thatHand = ROWS_PER_HAND - thisHand;
 #endif
 
+#ifdef MATRIX_COL_PORT_READ
+    matrix_col_port_reads_check();
+#endif
+
     // initialize key pins
     matrix_init_pins();
+#ifdef MATRIX_INTERRUPT_WAKEUP
+    wakeup_state      = MATRIX_WAKEUP_SCANNING;
+    wakeup_idle_scans = 0;
+#endif
 
     // initialize matrix state: all keys off
     memset(matrix, 0, sizeof(matrix));
@@ -323,18 +542,21 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
 uint8_t matrix_scan(void) {
     matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
 
+    // While armed, all keys are known to be released until an edge says otherwise
+    if (matrix_wakeup_scan_needed()) {
 #if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
-    // Set row, read cols
-    for (uint8_t current_row = 0; current_row < ROWS_PER_HAND; current_row++) {
-        matrix_read_cols_on_row(curr_matrix, current_row);
-    }
+        // Set row, read cols
+        for (uint8_t current_row = 0; current_row < ROWS_PER_HAND; current_row++) {
+            matrix_read_cols_on_row(curr_matrix, current_row);
+        }
 #elif (DIODE_DIRECTION == ROW2COL)
-    // Set col, read rows
-    matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
-    for (uint8_t current_col = 0; current_col < MATRIX_COLS; current_col++, row_shifter <<= 1) {
-        matrix_read_rows_on_col(curr_matrix, current_col, row_shifter);
-    }
+        // Set col, read rows
+        matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+        for (uint8_t current_col = 0; current_col < MATRIX_COLS; current_col++, row_shifter <<= 1) {
+            matrix_read_rows_on_col(curr_matrix, current_col, row_shifter);
+        }
 #endif
+    }
 
     bool changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
     if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
@@ -345,5 +567,6 @@ uint8_t matrix_scan(void) {
     changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
     matrix_scan_kb();
 #endif
+    matrix_wakeup_scanned();
     return (uint8_t)changed;
 }
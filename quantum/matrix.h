@@ -81,6 +81,23 @@ void matrix_slave_scan_kb(void);
 void matrix_slave_scan_user(void);
 #endif
 
+#ifdef MATRIX_INTERRUPT_WAKEUP
+typedef enum {
+    MATRIX_WAKEUP_SCANNING, // keys are pressed or being debounced
+    MATRIX_WAKEUP_IDLE,     // all keys released, counting idle scans before arming
+    MATRIX_WAKEUP_ARMED,    // all select lines driven, waiting for an input edge
+} matrix_wakeup_state_t;
+
+/* state of the interrupt wakeup state machine */
+matrix_wakeup_state_t matrix_wakeup_state(void);
+/* resumes scanning on the next matrix_scan(), call from the input pin interrupt */
+void matrix_wakeup_pin_event(void);
+/* platform: arm an edge interrupt towards `pressed_state` calling matrix_wakeup_pin_event(), false if unsupported */
+bool matrix_wakeup_pin_enable(pin_t pin, uint8_t pressed_state);
+/* platform: disarm the edge interrupt of `pin` */
+void matrix_wakeup_pin_disable(pin_t pin);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
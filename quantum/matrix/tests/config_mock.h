@@ -0,0 +1,29 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#define MATRIX_ROWS 3
+#define MATRIX_COLS 4
+
+/* Here, "pins" from 0 to 63 are allowed. */
+#define MATRIX_ROW_PINS \
+    { 0, 1, 2 }
+#define MATRIX_COL_PINS \
+    { 3, 4, 5, 6 }
+#define DIODE_DIRECTION COL2ROW
+
+#define DEBOUNCE 5
+
+#define MATRIX_INTERRUPT_WAKEUP
+#define MATRIX_WAKEUP_IDLE_SCANS 3
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mock_gpio.h"
+
+#ifdef __cplusplus
+};
+#endif
@@ -0,0 +1,39 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#define MATRIX_ROWS 2
+#define MATRIX_COLS 8
+
+#define A0 MOCK_PIN(0, 0)
+#define A1 MOCK_PIN(0, 1)
+#define B0 MOCK_PIN(1, 0)
+#define B4 MOCK_PIN(1, 4)
+#define B5 MOCK_PIN(1, 5)
+#define B6 MOCK_PIN(1, 6)
+#define C0 MOCK_PIN(2, 0)
+#define C1 MOCK_PIN(2, 1)
+#define C7 MOCK_PIN(2, 7)
+
+#define MATRIX_ROW_PINS \
+    { A0, A1 }
+#ifndef MATRIX_COL_PINS
+#    define MATRIX_COL_PINS \
+        { B4, B5, B6, C0, C1, B0, C7, NO_PIN }
+#endif
+#define DIODE_DIRECTION COL2ROW
+
+/* As generated by `qmk generate-config-h` for the pins above. */
+#define MATRIX_COL_PORT_READS \
+    { { B4, 0x00000070, -4 }, { C0, 0x00000003, 3 }, { B0, 0x00000001, 5 }, { C7, 0x00000080, -1 } }
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mock_gpio.h"
+
+#ifdef __cplusplus
+};
+#endif
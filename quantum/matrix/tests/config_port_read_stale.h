@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/* Column pins a config.h changed after the port reads were generated, B4 and B5 swapped. */
+#define MATRIX_COL_PINS \
+    { B5, B4, B6, C0, C1, B0, C7, NO_PIN }
+#define MATRIX_PORT_READ_TEST_STALE
+
+#include "config_port_read.h"
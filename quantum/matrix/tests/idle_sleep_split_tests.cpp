@@ -0,0 +1,46 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "idle_sleep.h"
+#include "matrix.h"
+#include "timer.h"
+
+static matrix_wakeup_state_t wakeup_state;
+static bool                  master;
+
+matrix_wakeup_state_t matrix_wakeup_state(void) {
+    return wakeup_state;
+}
+
+bool is_keyboard_master(void) {
+    return master;
+}
+
+void idle_sleep_platform_wait(uint32_t ms) {}
+}
+
+class IdleSleepSplit : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        wakeup_state = MATRIX_WAKEUP_ARMED;
+        master       = false;
+    }
+};
+
+TEST_F(IdleSleepSplit, ArmedSlaveHasNoDeadline) {
+    uint32_t deadline;
+    EXPECT_FALSE(idle_sleep_next_deadline(&deadline));
+    EXPECT_EQ(idle_sleep_duration(), IDLE_SLEEP_MAX_MS);
+}
+
+TEST_F(IdleSleepSplit, ArmedMasterKeepsPollingTheOtherHalf) {
+    master = true;
+
+    uint32_t deadline;
+    ASSERT_TRUE(idle_sleep_next_deadline(&deadline));
+    EXPECT_EQ(deadline, timer_read32() + 1);
+    EXPECT_EQ(idle_sleep_duration(), 1u);
+}
@@ -0,0 +1,74 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix.h"
+#include "matrix/tests/mock_gpio.h"
+}
+
+static const pin_t row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+static const pin_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+
+class MatrixPortReadTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock_gpio_reset();
+        matrix_init();
+    }
+
+    void set_keys(uint8_t row, matrix_row_t cols) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (col_pins[col] != NO_PIN) {
+                mock_gpio_switch(row_pins[row], col_pins[col], cols & (1 << col));
+            }
+        }
+    }
+
+    /* Reads `row` one column pin at a time, like matrix.c without MATRIX_COL_PORT_READS. */
+    matrix_row_t read_row_pin_wise(uint8_t row) {
+        matrix_row_t value = 0;
+        gpio_set_pin_output(row_pins[row]);
+        gpio_write_pin_low(row_pins[row]);
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (col_pins[col] != NO_PIN && !gpio_read_pin(col_pins[col])) {
+                value |= MATRIX_ROW_SHIFTER << col;
+            }
+        }
+        gpio_set_pin_input_high(row_pins[row]);
+        return value;
+    }
+};
+
+TEST_F(MatrixPortReadTest, MatchesPinWiseRead) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (unsigned cols = 0; cols < (1 << MATRIX_COLS); cols++) {
+            set_keys(row, cols);
+            matrix_scan();
+
+            matrix_row_t expected = read_row_pin_wise(row);
+            EXPECT_EQ(expected, cols & 0x7F) << "row " << +row << " cols " << cols;
+            EXPECT_EQ(matrix_get_row(row), expected) << "row " << +row << " cols " << cols;
+            EXPECT_EQ(matrix_get_row(row ^ 1), 0);
+        }
+        set_keys(row, 0);
+    }
+}
+
+TEST_F(MatrixPortReadTest, ReadsOncePerEntry) {
+    static const struct {
+        pin_t    pin;
+        uint32_t mask;
+        int8_t   shift;
+    } port_reads[] = MATRIX_COL_PORT_READS;
+
+    uint32_t reads = mock_gpio_reads();
+    matrix_scan();
+#ifdef MATRIX_PORT_READ_TEST_STALE
+    // The port reads do not match the pins, so each wired column is read on its own
+    EXPECT_EQ(mock_gpio_reads() - reads, MATRIX_ROWS * 7u);
+#else
+    EXPECT_EQ(mock_gpio_reads() - reads, MATRIX_ROWS * (sizeof(port_reads) / sizeof(port_reads[0])));
+#endif
+}
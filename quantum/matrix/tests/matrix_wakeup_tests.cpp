@@ -0,0 +1,154 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix.h"
+#include "matrix/tests/mock_gpio.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+static const pin_t row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+static const pin_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+
+class MatrixWakeupTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock_gpio_reset();
+        set_time(1000);
+        matrix_init();
+    }
+
+    void set_key(uint8_t row, uint8_t col, bool pressed) {
+        mock_gpio_switch(row_pins[row], col_pins[col], pressed);
+    }
+
+    void scan(unsigned count = 1) {
+        for (unsigned i = 0; i < count; i++) {
+            matrix_scan();
+            advance_time(1);
+        }
+    }
+
+    void expect_armed_pins(bool armed) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            EXPECT_EQ(mock_gpio_is_output_low(row_pins[row]), armed) << "row " << +row;
+        }
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            EXPECT_EQ(mock_gpio_wakeup_enabled(col_pins[col]), armed) << "col " << +col;
+        }
+    }
+
+    void arm() {
+        scan(MATRIX_WAKEUP_IDLE_SCANS);
+        ASSERT_EQ(matrix_wakeup_state(), MATRIX_WAKEUP_ARMED);
+    }
+};
+
+TEST_F(MatrixWakeupTest, ArmsAfterIdleScans) {
+    EXPECT_EQ(matrix_wakeup_state(), MATRIX_WAKEUP_SCANNING);
+
+    scan(MATRIX_WAKEUP_IDLE_SCANS - 1);
+    EXPECT_EQ(matrix_wakeup_state(), MATRIX_WAKEUP_IDLE);
+    expect_armed_pins(false);
+
+    scan();
+    EXPECT_EQ(matrix_wakeup_state(), MATRIX_WAKEUP_ARMED);
+    expect_armed_pins(true);
+}
+
+TEST_F(MatrixWakeupTest, ArmedMatrixIsNotRead) {
+    arm();
+
+    uint32_t reads = mock_gpio_reads();
+    for (int i = 0; i < 100; i++) {
+        EXPECT_EQ(matrix_scan(), 0);
+        advance_time(1);
+    }
+    EXPECT_EQ(mock_gpio_reads(), reads);
+    EXPECT_EQ(matrix_wakeup_state(), MATRIX_WAKEUP_ARMED);
+}
+
+TEST_F(MatrixWakeupTest, EdgeResumesScanning) {
+    arm();
+
+    set_key(1, 2, true);
+    EXPECT_EQ(matrix_wakeup_state(), MATRIX_WAKEUP_ARMED);
+
+    scan();
+    EXPECT_EQ(matrix_wakeup_state(), MATRIX_WAKEUP_SCANNING);
+    expect_armed_pins(false);
+
+    // The key goes through debouncing as usual.
+    scan(DEBOUNCE);
+    EXPECT_EQ(matrix_get_row(1), 1 << 2);
+
+    set_key(1, 2, false);
+    scan(DEBOUNCE + 1);
+    EXPECT_EQ(matrix_get_row(1), 0);
+    EXPECT_EQ(matrix_wakeup_state(), MATRIX_WAKEUP_IDLE);
+
+    scan(MATRIX_WAKEUP_IDLE_SCANS);
+    EXPECT_EQ(matrix_wakeup_state(), MATRIX_WAKEUP_ARMED);
+    expect_armed_pins(true);
+}
+
+TEST_F(MatrixWakeupTest, HeldKeyKeepsScanning) {
+    set_key(0, 0, true);
+    scan(100);
+    EXPECT_EQ(matrix_wakeup_state(), MATRIX_WAKEUP_SCANNING);
+    EXPECT_EQ(matrix_get_row(0), 1);
+}
+
+TEST_F(MatrixWakeupTest, BouncingKeyKeepsScanning) {
+    scan(MATRIX_WAKEUP_IDLE_SCANS - 1);
+
+    // Too short to pass the debounce, but still has to be watched until it settles.
+    set_key(2, 3, true);
+    scan();
+    set_key(2, 3, false);
+    scan();
+    EXPECT_EQ(matrix_wakeup_state(), MATRIX_WAKEUP_SCANNING);
+
+    scan(DEBOUNCE);
+    EXPECT_EQ(matrix_get_row(2), 0);
+    EXPECT_NE(matrix_wakeup_state(), MATRIX_WAKEUP_SCANNING);
+}
+
+static void press_key_while_arming(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        if (!mock_gpio_is_output_low(row_pins[row])) {
+            return;
+        }
+    }
+    mock_gpio_switch(row_pins[0], col_pins[1], true);
+}
+
+TEST_F(MatrixWakeupTest, KeyPressedWhileArmingIsNotMissed) {
+    mock_gpio_select_delay_hook = press_key_while_arming;
+
+    scan(MATRIX_WAKEUP_IDLE_SCANS);
+    EXPECT_NE(matrix_wakeup_state(), MATRIX_WAKEUP_ARMED);
+    expect_armed_pins(false);
+
+    mock_gpio_select_delay_hook = NULL;
+    scan(DEBOUNCE + 1);
+    EXPECT_EQ(matrix_get_row(0), 1 << 1);
+    EXPECT_EQ(matrix_wakeup_state(), MATRIX_WAKEUP_SCANNING);
+}
+
+TEST_F(MatrixWakeupTest, UnsupportedPlatformKeepsPolling) {
+    mock_gpio_wakeup_supported = false;
+
+    scan(MATRIX_WAKEUP_IDLE_SCANS * 3);
+    EXPECT_NE(matrix_wakeup_state(), MATRIX_WAKEUP_ARMED);
+    expect_armed_pins(false);
+
+    set_key(1, 1, true);
+    scan(DEBOUNCE + 1);
+    EXPECT_EQ(matrix_get_row(1), 1 << 1);
+}
@@ -0,0 +1,140 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "mock_gpio.h"
+#include "matrix.h"
+
+#define MOCK_PINS 64
+
+typedef enum { PIN_FLOATING, PIN_INPUT_HIGH, PIN_OUTPUT } pin_mode_t;
+
+static pin_mode_t modes[MOCK_PINS];
+static bool       outputs[MOCK_PINS];
+static bool       switches[MOCK_PINS][MOCK_PINS];
+static bool       wakeup_enabled[MOCK_PINS];
+static bool       wakeup_levels[MOCK_PINS];
+static uint32_t   reads;
+
+bool mock_gpio_wakeup_supported = true;
+void (*mock_gpio_select_delay_hook)(void);
+
+matrix_row_t raw_matrix[MATRIX_ROWS];
+matrix_row_t matrix[MATRIX_ROWS];
+
+static bool pin_level(pin_t pin) {
+    if (modes[pin] == PIN_OUTPUT) {
+        return outputs[pin];
+    }
+    for (pin_t other = 0; other < MOCK_PINS; other++) {
+        if (switches[pin][other] && modes[other] == PIN_OUTPUT && !outputs[other]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Simulates the falling edge interrupts of all armed pins. */
+static void update_wakeup_edges(void) {
+    for (pin_t pin = 0; pin < MOCK_PINS; pin++) {
+        if (!wakeup_enabled[pin]) {
+            continue;
+        }
+        bool level = pin_level(pin);
+#ifdef MATRIX_INTERRUPT_WAKEUP
+        if (wakeup_levels[pin] && !level) {
+            matrix_wakeup_pin_event();
+        }
+#endif
+        wakeup_levels[pin] = level;
+    }
+}
+
+void mock_gpio_set_input_high(pin_t pin) {
+    modes[pin] = PIN_INPUT_HIGH;
+    update_wakeup_edges();
+}
+
+void mock_gpio_set_output(pin_t pin) {
+    modes[pin] = PIN_OUTPUT;
+    update_wakeup_edges();
+}
+
+void mock_gpio_write(pin_t pin, bool level) {
+    outputs[pin] = level;
+    update_wakeup_edges();
+}
+
+bool mock_gpio_read(pin_t pin) {
+    reads++;
+    return pin_level(pin);
+}
+
+uint32_t mock_gpio_read_port(pin_t pin) {
+    uint32_t levels = 0;
+    pin_t    first  = MOCK_PIN_PORT(pin) << 4;
+    for (uint8_t bit = 0; bit < 16; bit++) {
+        levels |= (uint32_t)pin_level(first + bit) << bit;
+    }
+    reads++;
+    return levels;
+}
+
+void mock_gpio_reset(void) {
+    memset(modes, 0, sizeof(modes));
+    memset(outputs, 0, sizeof(outputs));
+    memset(switches, 0, sizeof(switches));
+    memset(wakeup_enabled, 0, sizeof(wakeup_enabled));
+    reads                       = 0;
+    mock_gpio_wakeup_supported  = true;
+    mock_gpio_select_delay_hook = NULL;
+}
+
+void mock_gpio_switch(pin_t a, pin_t b, bool closed) {
+    switches[a][b] = closed;
+    switches[b][a] = closed;
+    update_wakeup_edges();
+}
+
+bool mock_gpio_is_output_low(pin_t pin) {
+    return modes[pin] == PIN_OUTPUT && !outputs[pin];
+}
+
+uint32_t mock_gpio_reads(void) {
+    return reads;
+}
+
+bool mock_gpio_wakeup_enabled(pin_t pin) {
+    return wakeup_enabled[pin];
+}
+
+#ifdef MATRIX_INTERRUPT_WAKEUP
+bool matrix_wakeup_pin_enable(pin_t pin, uint8_t pressed_state) {
+    if (!mock_gpio_wakeup_supported) {
+        return false;
+    }
+    wakeup_enabled[pin] = true;
+    wakeup_levels[pin]  = pin_level(pin);
+    return true;
+}
+
+void matrix_wakeup_pin_disable(pin_t pin) {
+    wakeup_enabled[pin] = false;
+}
+#endif
+
+void matrix_output_select_delay(void) {
+    if (mock_gpio_select_delay_hook) {
+        mock_gpio_select_delay_hook();
+    }
+}
+
+void matrix_output_unselect_delay(uint8_t line, bool key_pressed) {}
+
+matrix_row_t matrix_get_row(uint8_t row) {
+    return matrix[row];
+}
+
+void matrix_init_kb(void) {}
+
+void matrix_scan_kb(void) {}
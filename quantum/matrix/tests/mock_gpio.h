@@ -0,0 +1,42 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef uint8_t pin_t;
+
+#define gpio_set_pin_input_high(pin) mock_gpio_set_input_high(pin)
+#define gpio_set_pin_output(pin) mock_gpio_set_output(pin)
+#define gpio_write_pin_high(pin) mock_gpio_write(pin, true)
+#define gpio_write_pin_low(pin) mock_gpio_write(pin, false)
+#define gpio_read_pin(pin) mock_gpio_read(pin)
+#define gpio_read_port(pin) mock_gpio_read_port(pin)
+
+/* Pins are numbered like on AVR: four ports of 16 bits each. */
+#define MOCK_PIN(port, bit) ((pin_t)(((port) << 4) | (bit)))
+#define MOCK_PIN_PORT(pin) ((pin) >> 4)
+
+void     mock_gpio_set_input_high(pin_t pin);
+void     mock_gpio_set_output(pin_t pin);
+void     mock_gpio_write(pin_t pin, bool level);
+bool     mock_gpio_read(pin_t pin);
+uint32_t mock_gpio_read_port(pin_t pin);
+
+/* Resets all pins to floating inputs, opens all switches and clears the counters. */
+void mock_gpio_reset(void);
+/* Opens or closes the switch between `a` and `b`; an input reads low if it is switched to a low output. */
+void mock_gpio_switch(pin_t a, pin_t b, bool closed);
+/* True if `pin` is an output driven low. */
+bool mock_gpio_is_output_low(pin_t pin);
+/* Number of gpio_read_pin() and gpio_read_port() calls so far. */
+uint32_t mock_gpio_reads(void);
+
+/* Whether matrix_wakeup_pin_enable() succeeds, and the pins it is armed on. */
+extern bool mock_gpio_wakeup_supported;
+bool        mock_gpio_wakeup_enabled(pin_t pin);
+
+/* Called from every matrix_output_select_delay(), if set. */
+extern void (*mock_gpio_select_delay_hook)(void);
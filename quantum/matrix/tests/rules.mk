@@ -0,0 +1,37 @@
+matrix_wakeup_DEFS := -DIGNORE_ATOMIC_BLOCK
+matrix_wakeup_CONFIG := $(QUANTUM_PATH)/matrix/tests/config_mock.h
+
+matrix_wakeup_SRC := \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/debounce/sym_defer_g.c \
+	$(QUANTUM_PATH)/matrix/tests/mock_gpio.c \
+	$(QUANTUM_PATH)/matrix/tests/matrix_wakeup_tests.cpp \
+	$(QUANTUM_PATH)/matrix.c
+
+matrix_port_read_DEFS := -DIGNORE_ATOMIC_BLOCK
+matrix_port_read_CONFIG := $(QUANTUM_PATH)/matrix/tests/config_port_read.h
+
+matrix_port_read_SRC := \
+	$(QUANTUM_PATH)/debounce/none.c \
+	$(QUANTUM_PATH)/matrix/tests/mock_gpio.c \
+	$(QUANTUM_PATH)/matrix/tests/matrix_port_read_tests.cpp \
+	$(QUANTUM_PATH)/matrix.c
+
+matrix_port_read_stale_DEFS := -DIGNORE_ATOMIC_BLOCK
+matrix_port_read_stale_CONFIG := $(QUANTUM_PATH)/matrix/tests/config_port_read_stale.h
+
+matrix_port_read_stale_SRC := \
+	$(QUANTUM_PATH)/debounce/none.c \
+	$(QUANTUM_PATH)/matrix/tests/mock_gpio.c \
+	$(QUANTUM_PATH)/matrix/tests/matrix_port_read_tests.cpp \
+	$(QUANTUM_PATH)/matrix.c
+
+idle_sleep_split_DEFS := -DSPLIT_KEYBOARD -DNO_ACTION_TAPPING -DIDLE_SLEEP_MAX_MS=100
+idle_sleep_split_CONFIG := $(QUANTUM_PATH)/matrix/tests/config_mock.h
+
+idle_sleep_split_SRC := \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/matrix/tests/idle_sleep_split_tests.cpp \
+	$(QUANTUM_PATH)/idle_sleep.c
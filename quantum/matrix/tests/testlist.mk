@@ -0,0 +1,4 @@
+TEST_LIST += matrix_wakeup
+TEST_LIST += matrix_port_read
+TEST_LIST += matrix_port_read_stale
+TEST_LIST += idle_sleep_split
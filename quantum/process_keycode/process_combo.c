@@ -26,6 +26,9 @@
 #include "action_tapping.h"
 #include "action_util.h"
 #include "keymap_introspection.h"
+#ifdef COMBO_INDEX_ENABLE
+#    include <string.h>
+#endif
 
 __attribute__((weak)) void process_combo_event(uint16_t combo_index, bool pressed) {}
 
@@ -82,8 +85,15 @@ typedef enum { COMBO_KEY_NOT_PRESSED, COMBO_KEY_PRESSED, COMBO_KEY_REPRESSED } c
 #ifndef COMBO_NO_TIMER
 static uint16_t timer = 0;
 #endif
-static bool     b_combo_enable = true; // defaults to enabled
-static uint16_t longest_term   = 0;
+static bool     b_combo_enable    = true; // defaults to enabled
+static uint16_t longest_term      = 0;
+static bool     combo_state_dirty = false;
+
+#ifdef COMBO_INDEX_ENABLE
+static bool     combo_index_built  = false;
+static bool     combo_index_usable = false;
+static uint16_t combo_index_words  = 0;
+#endif
 
 typedef struct {
     keyrecord_t record;
@@ -202,6 +212,13 @@ static inline uint16_t _get_combo_term(uint16_t combo_index, combo_t *combo) {
 void clear_combos(void) {
     uint16_t index = 0;
     longest_term   = 0;
+
+    // Skip the sweep if no combo has been touched since the last one
+    if (!combo_state_dirty) {
+        return;
+    }
+    combo_state_dirty = false;
+
     for (index = 0; index < combo_count(); ++index) {
         combo_t *combo = combo_get(index);
         if (!COMBO_ACTIVE(combo)) {
@@ -264,7 +281,6 @@ static inline void dump_key_buffer(void) {
     key_buffer_next = key_buffer_size = 0;
 }
 
-#define NO_COMBO_KEYS_ARE_DOWN (0 == COMBO_STATE(combo))
 #define ALL_COMBO_KEYS_ARE_DOWN(state, key_count) (((1 << key_count) - 1) == state)
 #define ONLY_ONE_KEY_IS_DOWN(state) !(state & (state - 1))
 #define KEY_NOT_YET_RELEASED(state, key_index) ((1 << key_index) & state)
@@ -432,6 +448,9 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
         return COMBO_KEY_NOT_PRESSED;
     }
 
+    /* Combo state may change from here on, clear_combos has to look at it. */
+    combo_state_dirty = true;
+
     bool key_is_part_of_combo = (!COMBO_DISABLED(combo) && is_combo_enabled()
 #if defined(COMBO_MUST_PRESS_IN_ORDER) || defined(COMBO_MUST_PRESS_IN_ORDER_PER_COMBO)
                                  && keys_pressed_in_order(combo_index, combo, key_index, keycode, record)
@@ -551,9 +570,39 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
     return key_is_part_of_combo ? COMBO_KEY_PRESSED : COMBO_KEY_NOT_PRESSED;
 }
 
+#ifdef COMBO_INDEX_ENABLE
+/* Builds the keycode to combo index. Returns false if the combos can't be
+ * covered by the index, e.g. when combo_count() reports more combos than are
+ * stored in firmware, in which case all combos are scanned instead. */
+static bool combo_index_build(void) {
+    const uint16_t count = combo_count();
+    if (count > combo_count_raw()) {
+        return false;
+    }
+
+    combo_index_words = COMBO_INDEX_WORDS(count);
+    for (uint8_t bucket = 0; bucket < COMBO_INDEX_BUCKETS; bucket++) {
+        memset(combo_index_get_raw(bucket), 0, combo_index_words * sizeof(uint32_t));
+    }
+
+    for (uint16_t idx = 0; idx < count; ++idx) {
+        combo_t *combo = combo_get(idx);
+        uint16_t key;
+        for (uint8_t key_index = 0; (key = pgm_read_word(&combo->keys[key_index])) != COMBO_END; key_index++) {
+            combo_index_get_raw(COMBO_INDEX_BUCKET(key))[idx / 32] |= (uint32_t)1 << (idx % 32);
+        }
+    }
+    return true;
+}
+
+/* Forces the index to be rebuilt, needed if combos are changed at runtime. */
+void combo_index_invalidate(void) {
+    combo_index_built = false;
+}
+#endif
+
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
-    uint8_t is_combo_key          = COMBO_KEY_NOT_PRESSED;
-    bool    no_combo_keys_pressed = true;
+    uint8_t is_combo_key = COMBO_KEY_NOT_PRESSED;
 
     if (keycode == QK_COMBO_ON && record->event.pressed) {
         combo_enable();
@@ -581,10 +630,27 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_INDEX_ENABLE
+    if (!combo_index_built) {
+        combo_index_usable = combo_index_build();
+        combo_index_built  = true;
+    }
+
+    if (combo_index_usable) {
+        /* Only visit the combos which have a key in the same bucket. */
+        const uint32_t *bucket = combo_index_get_raw(COMBO_INDEX_BUCKET(keycode));
+        for (uint16_t word = 0; word < combo_index_words; word++) {
+            for (uint32_t combos = bucket[word]; combos; combos &= combos - 1) {
+                const uint16_t idx = (word * 32) + __builtin_ctzl(combos);
+                is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx);
+            }
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx);
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -647,6 +713,18 @@ void combo_task(void) {
 #endif
 }
 
+/* Time at which combo_task() resolves the buffered keys, in timer_read32() time-space. */
+bool combo_next_deadline(uint32_t *deadline) {
+#ifndef COMBO_NO_TIMER
+    if (b_combo_enable && timer) {
+        uint16_t elapsed = timer_elapsed(timer);
+        *deadline        = timer_read32() + (elapsed > longest_term ? 0 : longest_term - elapsed + 1);
+        return true;
+    }
+#endif
+    return false;
+}
+
 void combo_enable(void) {
     b_combo_enable = true;
 }
@@ -39,6 +39,16 @@
 #    define COMBO_BUFFER_LENGTH 4
 #endif
 
+#ifdef COMBO_INDEX_ENABLE
+#    ifndef COMBO_INDEX_BUCKETS
+#        define COMBO_INDEX_BUCKETS 32
+#    endif
+/* keycode to index bucket, combos sharing a bucket are told apart by process_combo */
+#    define COMBO_INDEX_BUCKET(keycode) ((keycode) % COMBO_INDEX_BUCKETS)
+/* number of 32 bit words needed to hold one bit per combo */
+#    define COMBO_INDEX_WORDS(count) (((count) + 31) / 32)
+#endif
+
 typedef struct combo_t {
     const uint16_t *keys;
     uint16_t        keycode;
@@ -75,9 +85,14 @@ typedef struct combo_t {
 
 bool process_combo(uint16_t keycode, keyrecord_t *record);
 void combo_task(void);
+bool combo_next_deadline(uint32_t *deadline);
 void process_combo_event(uint16_t combo_index, bool pressed);
 
 void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
 bool is_combo_enabled(void);
+
+#ifdef COMBO_INDEX_ENABLE
+void combo_index_invalidate(void);
+#endif
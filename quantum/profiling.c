@@ -0,0 +1,159 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "profiling.h"
+#include "print.h"
+#include "timer.h"
+
+#if defined(__AVR__)
+#    include <avr/io.h>
+#    include <util/atomic.h>
+#    include "timer_avr.h"
+// Timer 0 counts from 0 to TIMER_RAW_TOP for every millisecond of timer_count.
+extern volatile uint32_t timer_count;
+#    define PROFILE_TIMESTAMP_FREQUENCY ((TIMER_RAW_TOP + 1) * 1000UL)
+#elif defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#    if PORT_SUPPORTS_RT == TRUE
+#        define PROFILE_TIMESTAMP_FREQUENCY REALTIME_COUNTER_CLOCK
+#    else
+#        define PROFILE_TIMESTAMP_FREQUENCY CH_CFG_ST_FREQUENCY
+#    endif
+#else
+// Host builds, such as the unit tests, use the monotonic clock in nanoseconds.
+#    include <time.h>
+#    define PROFILE_TIMESTAMP_FREQUENCY 1000000000UL
+#endif
+
+#define PROFILE_US_TO_TICKS(us) ((uint32_t)((uint64_t)(us) * PROFILE_TIMESTAMP_FREQUENCY / 1000000UL))
+
+#define PROFILE_PROBE_NAME(id, name) name,
+static const char *const probe_names[PROFILE_PROBE_COUNT] = {PROFILE_BUILTIN_PROBES(PROFILE_PROBE_NAME) PROFILE_USER_PROBES(PROFILE_PROBE_NAME)};
+#undef PROFILE_PROBE_NAME
+
+static profile_stats_t probe_stats[PROFILE_PROBE_COUNT];
+
+uint32_t profile_timestamp(void) {
+#if defined(__AVR__)
+    uint32_t ms;
+    uint8_t  raw;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        ms  = timer_count;
+        raw = TIMER_RAW;
+    }
+    return ms * (TIMER_RAW_TOP + 1) + raw;
+#elif defined(PROTOCOL_CHIBIOS)
+#    if PORT_SUPPORTS_RT == TRUE
+    return chSysGetRealtimeCounterX();
+#    else
+    return chVTGetSystemTimeX();
+#    endif
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * PROFILE_TIMESTAMP_FREQUENCY + ts.tv_nsec);
+#endif
+}
+
+uint32_t profile_ticks_to_us(uint32_t ticks) {
+    return (uint32_t)((uint64_t)ticks * 1000000UL / PROFILE_TIMESTAMP_FREQUENCY);
+}
+
+void profile_record(uint8_t probe, uint32_t ticks) {
+    if (probe >= PROFILE_PROBE_COUNT) {
+        return;
+    }
+
+    profile_stats_t *stats = &probe_stats[probe];
+    if (stats->count == 0 || ticks < stats->min) {
+        stats->min = ticks;
+    }
+    if (ticks > stats->max) {
+        stats->max = ticks;
+    }
+    stats->count++;
+    stats->total += ticks;
+
+    uint8_t  bucket = 0;
+    uint32_t bound  = PROFILE_US_TO_TICKS(PROFILE_HISTOGRAM_BASE_US);
+    while (bucket < PROFILE_HISTOGRAM_BUCKETS - 1 && ticks >= bound) {
+        bucket++;
+        bound <<= 1;
+    }
+    if (stats->histogram[bucket] < UINT16_MAX) {
+        stats->histogram[bucket]++;
+    }
+}
+
+const profile_stats_t *profile_get_stats(uint8_t probe) {
+    return probe < PROFILE_PROBE_COUNT ? &probe_stats[probe] : NULL;
+}
+
+const char *profile_get_name(uint8_t probe) {
+    return probe < PROFILE_PROBE_COUNT ? probe_names[probe] : NULL;
+}
+
+void profile_reset(void) {
+    memset(probe_stats, 0, sizeof(probe_stats));
+}
+
+static uint32_t probe_mean(const profile_stats_t *stats) {
+    return stats->count ? (uint32_t)(stats->total / stats->count) : 0;
+}
+
+void profile_dump(void) {
+    for (uint8_t i = 0; i < PROFILE_PROBE_COUNT; i++) {
+        const profile_stats_t *stats = &probe_stats[i];
+        if (stats->count == 0) {
+            continue;
+        }
+        uprintf("%s: n=%lu min=%luus mean=%luus max=%luus hist=", probe_names[i], (unsigned long)stats->count, (unsigned long)profile_ticks_to_us(stats->min), (unsigned long)profile_ticks_to_us(probe_mean(stats)), (unsigned long)profile_ticks_to_us(stats->max));
+        for (uint8_t b = 0; b < PROFILE_HISTOGRAM_BUCKETS; b++) {
+            uprintf(b ? ",%u" : "%u", stats->histogram[b]);
+        }
+        uprintf("\n");
+    }
+}
+
+static uint8_t *write_u32(uint8_t *dst, uint32_t value) {
+    for (uint8_t i = 0; i < 4; i++) {
+        *dst++ = value >> (8 * i);
+    }
+    return dst;
+}
+
+bool profile_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 20 || data[0] != PROFILE_RAW_HID_COMMAND) {
+        return false;
+    }
+
+    uint8_t                probe = data[1];
+    const profile_stats_t *stats = profile_get_stats(probe);
+    memset(data + 2, 0, length - 2);
+    data[2] = PROFILE_PROBE_COUNT;
+    data[3] = PROFILE_HISTOGRAM_BUCKETS;
+    if (stats == NULL) {
+        return true;
+    }
+
+    uint8_t *dst = write_u32(data + 4, stats->count);
+    dst          = write_u32(dst, profile_ticks_to_us(stats->min));
+    dst          = write_u32(dst, profile_ticks_to_us(stats->max));
+    dst          = write_u32(dst, profile_ticks_to_us(probe_mean(stats)));
+    for (uint8_t b = 0; b < PROFILE_HISTOGRAM_BUCKETS && dst + 2 <= data + length; b++) {
+        *dst++ = stats->histogram[b];
+        *dst++ = stats->histogram[b] >> 8;
+    }
+    return true;
+}
+
+void profiling_task(void) {
+#ifdef PROFILE_DUMP_INTERVAL
+    static uint32_t last_dump = 0;
+    if (timer_elapsed32(last_dump) >= PROFILE_DUMP_INTERVAL) {
+        last_dump = timer_read32();
+        profile_dump();
+    }
+#endif
+}
@@ -0,0 +1,140 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+    This API keeps running timing statistics for a fixed set of named probes.
+
+    Usage example:
+
+        // config.h -- optional, adds probes of your own to the table:
+        #define PROFILE_USER_PROBES(X) X(MY_SCAN, "my_scan")
+
+        // keymap.c
+        #include "profiling.h"
+
+        PROFILE_PROBE(MY_SCAN, {
+            my_scan();
+        });
+
+        // Print all probes over console, for instance from a keycode:
+        profile_dump();
+
+    Unlike basic_profiling.h, probes compile away entirely unless PROFILING_ENABLE is set.
+*/
+
+#ifndef PROFILE_HISTOGRAM_BUCKETS
+#    define PROFILE_HISTOGRAM_BUCKETS 8
+#endif
+
+#ifndef PROFILE_HISTOGRAM_BASE_US
+#    define PROFILE_HISTOGRAM_BASE_US 16
+#endif
+
+#ifndef PROFILE_RAW_HID_COMMAND
+#    define PROFILE_RAW_HID_COMMAND 0x50
+#endif
+
+// clang-format off
+#define PROFILE_BUILTIN_PROBES(X)                       \
+    X(MATRIX_TASK, "matrix_task")                       \
+    X(QUANTUM_TASK, "quantum_task")                     \
+    X(RGB_MATRIX_TASK, "rgb_matrix_task")               \
+    X(POINTING_DEVICE_TASK, "pointing_device_task")     \
+    X(HOUSEKEEPING_TASK, "housekeeping_task")           \
+    X(ACTION_TAPPING, "action_tapping_process")         \
+    X(COMBO, "process_combo")                           \
+    X(KEY_OVERRIDE, "process_key_override")             \
+    X(AUTOCORRECT, "process_autocorrect")               \
+    X(CAPS_WORD, "process_caps_word")
+// clang-format on
+
+#ifndef PROFILE_USER_PROBES
+#    define PROFILE_USER_PROBES(X)
+#endif
+
+#define PROFILE_PROBE_ENUM(id, name) PROFILE_PROBE_##id,
+enum profile_probe_id { PROFILE_BUILTIN_PROBES(PROFILE_PROBE_ENUM) PROFILE_USER_PROBES(PROFILE_PROBE_ENUM) PROFILE_PROBE_COUNT };
+#undef PROFILE_PROBE_ENUM
+
+/**
+ * @brief Running statistics of a single probe. Durations are in timestamp ticks.
+ *
+ * Histogram bucket 0 counts samples shorter than PROFILE_HISTOGRAM_BASE_US, every
+ * following bucket doubles the upper bound, and the last bucket counts everything
+ * longer. Bucket counts saturate instead of wrapping.
+ */
+typedef struct profile_stats_t {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint16_t histogram[PROFILE_HISTOGRAM_BUCKETS];
+} profile_stats_t;
+
+/** @return the current value of the profiling clock, in ticks */
+uint32_t profile_timestamp(void);
+
+/** @return `ticks` of the profiling clock converted to microseconds */
+uint32_t profile_ticks_to_us(uint32_t ticks);
+
+/** @brief Adds a sample of `ticks` duration to `probe`. */
+void profile_record(uint8_t probe, uint32_t ticks);
+
+/** @return the statistics of `probe`, or NULL if out of range */
+const profile_stats_t *profile_get_stats(uint8_t probe);
+
+/** @return the name of `probe`, or NULL if out of range */
+const char *profile_get_name(uint8_t probe);
+
+/** @brief Clears the statistics of all probes. */
+void profile_reset(void);
+
+/** @brief Prints the statistics of all probes with samples over console. */
+void profile_dump(void);
+
+/**
+ * @brief Answers a raw HID profiling request in place.
+ *
+ * Requests are `PROFILE_RAW_HID_COMMAND, probe`. The reply overwrites `data` with
+ * `PROFILE_RAW_HID_COMMAND, probe, PROFILE_PROBE_COUNT, PROFILE_HISTOGRAM_BUCKETS`
+ * followed by count, min, max and mean (in microseconds) as little-endian uint32_t,
+ * and as many little-endian uint16_t histogram buckets as fit. Call this from
+ * raw_hid_receive() (or raw_hid_receive_kb() with VIA) and raw_hid_send() `data` back
+ * if it returns true.
+ *
+ * @return true if `data` was a profiling request
+ */
+bool profile_raw_hid_receive(uint8_t *data, uint8_t length);
+
+/** @brief Prints profile_dump() every PROFILE_DUMP_INTERVAL ms, if defined. */
+void profiling_task(void);
+
+#ifdef PROFILING_ENABLE
+#    define PROFILE_PROBE(probe, ...)                                                      \
+        do {                                                                               \
+            uint32_t profile_start_ts = profile_timestamp();                               \
+            do {                                                                           \
+                __VA_ARGS__;                                                               \
+            } while (0);                                                                   \
+            profile_record(PROFILE_PROBE_##probe, profile_timestamp() - profile_start_ts); \
+        } while (0)
+/* Evaluates to the value of `expr`, for probing calls inside conditions. */
+#    define PROFILE_PROBE_RESULT(probe, expr)                                              \
+        ({                                                                                 \
+            uint32_t         profile_start_ts = profile_timestamp();                       \
+            __typeof__(expr) profile_result   = (expr);                                    \
+            profile_record(PROFILE_PROBE_##probe, profile_timestamp() - profile_start_ts); \
+            profile_result;                                                                \
+        })
+#else
+#    define PROFILE_PROBE(probe, ...) \
+        do {                          \
+            __VA_ARGS__;              \
+        } while (0)
+#    define PROFILE_PROBE_RESULT(probe, expr) (expr)
+#endif
@@ -15,6 +15,7 @@
  */
 
 #include "quantum.h"
+#include "profiling.h"
 
 #ifdef BACKLIGHT_ENABLE
 #    include "process_backlight.h"
@@ -280,7 +281,7 @@ uint16_t get_event_keycode(keyevent_t event, bool update_layer_cache) {
 bool pre_process_record_quantum(keyrecord_t *record) {
     return pre_process_record_modules(get_record_keycode(record, true), record) && pre_process_record_kb(get_record_keycode(record, true), record) &&
 #ifdef COMBO_ENABLE
-           process_combo(get_record_keycode(record, true), record) &&
+           PROFILE_PROBE_RESULT(COMBO, process_combo(get_record_keycode(record, true), record)) &&
 #endif
            true;
 }
@@ -383,10 +384,10 @@ bool process_record_quantum(keyrecord_t *record) {
             process_music(keycode, record) &&
 #endif
 #ifdef CAPS_WORD_ENABLE
-            process_caps_word(keycode, record) &&
+            PROFILE_PROBE_RESULT(CAPS_WORD, process_caps_word(keycode, record)) &&
 #endif
 #ifdef KEY_OVERRIDE_ENABLE
-            process_key_override(keycode, record) &&
+            PROFILE_PROBE_RESULT(KEY_OVERRIDE, process_key_override(keycode, record)) &&
 #endif
 #ifdef TAP_DANCE_ENABLE
             process_tap_dance(keycode, record) &&
@@ -425,7 +426,7 @@ bool process_record_quantum(keyrecord_t *record) {
             process_programmable_button(keycode, record) &&
 #endif
 #ifdef AUTOCORRECT_ENABLE
-            process_autocorrect(keycode, record) &&
+            PROFILE_PROBE_RESULT(AUTOCORRECT, process_autocorrect(keycode, record)) &&
 #endif
 #ifdef TRI_LAYER_ENABLE
             process_tri_layer(keycode, record) &&
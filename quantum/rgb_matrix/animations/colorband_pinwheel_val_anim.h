@@ -2,13 +2,13 @@
 RGB_MATRIX_EFFECT(BAND_PINWHEEL_VAL)
 #    ifdef RGB_MATRIX_CUSTOM_EFFECT_IMPLS
 
-static hsv_t BAND_PINWHEEL_VAL_math(hsv_t hsv, int16_t dx, int16_t dy, uint8_t time) {
-    hsv.v = scale8(hsv.v - time - atan2_8(dy, dx) * 3, hsv.v);
+static hsv_t BAND_PINWHEEL_VAL_math(hsv_t hsv, uint8_t angle, uint8_t time) {
+    hsv.v = scale8(hsv.v - time - angle * 3, hsv.v);
     return hsv;
 }
 
 bool BAND_PINWHEEL_VAL(effect_params_t* params) {
-    return effect_runner_dx_dy(params, &BAND_PINWHEEL_VAL_math);
+    return effect_runner_angle(params, &BAND_PINWHEEL_VAL_math);
 }
 
 #    endif // RGB_MATRIX_CUSTOM_EFFECT_IMPLS
@@ -1,5 +1,5 @@
 #ifdef ENABLE_RGB_MATRIX_GRADIENT_UP_DOWN
-RGB_MATRIX_EFFECT(GRADIENT_UP_DOWN)
+RGB_MATRIX_EFFECT(GRADIENT_UP_DOWN, STATIC)
 #    ifdef RGB_MATRIX_CUSTOM_EFFECT_IMPLS
 
 bool GRADIENT_UP_DOWN(effect_params_t* params) {
@@ -0,0 +1,12 @@
+// Generated code.
+
+#pragma once
+
+// RGB Matrix timeline animations (1), select one with rgb_matrix_timeline_set_animation():
+#define RGB_MATRIX_TIMELINE_BREATHE 0 // 4000 ms, 2 groups
+
+static const uint8_t rgb_matrix_timeline_data[35] PROGMEM = {
+    0x01, 0x03, 0x01, 0x00, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x0E, 0x00, 0xA0, 0x0F,
+    0x02, 0x00, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x04, 0xD0, 0x07, 0x01, 0x04, 0x00, 0x01, 0x01, 0x00,
+    0x00, 0x02, 0x00
+};
@@ -0,0 +1,23 @@
+#pragma once
+
+typedef hsv_t (*angle_f)(hsv_t hsv, uint8_t angle, uint8_t time);
+
+bool effect_runner_angle(effect_params_t* params, angle_f effect_func) {
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+    rgb_matrix_batch_t batch = {0};
+
+    uint8_t time = scale16by8(g_rgb_timer, rgb_matrix_config.speed / 2);
+    for (uint8_t i = led_min; i < led_max; i++) {
+        RGB_MATRIX_TEST_LED_FLAGS();
+#ifdef RGB_MATRIX_GEOMETRY_TABLES
+        uint8_t angle = pgm_read_byte(&g_rgb_matrix_center_angle[i]);
+#else
+        int16_t dx    = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy    = g_led_config.point[i].y - k_rgb_matrix_center.y;
+        uint8_t angle = atan2_8(dy, dx);
+#endif
+        rgb_matrix_batch_set_hsv(&batch, i, effect_func(rgb_matrix_config.hsv, angle, time));
+    }
+    rgb_matrix_batch_flush(&batch);
+    return rgb_matrix_check_finished_leds(led_max);
+}
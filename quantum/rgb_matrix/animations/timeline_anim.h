@@ -0,0 +1,44 @@
+#ifdef ENABLE_RGB_MATRIX_TIMELINE
+RGB_MATRIX_EFFECT(TIMELINE)
+#    ifdef RGB_MATRIX_CUSTOM_EFFECT_IMPLS
+
+#        include "rgb_matrix_timeline.h"
+#        if __has_include("rgb_matrix_timeline_data.h")
+#            include "rgb_matrix_timeline_data.h"
+#        else
+#            pragma message "The timeline effect is using the default animations."
+#            include "rgb_matrix_timeline_data_default.h"
+#        endif
+
+typedef struct {
+    rgb_matrix_batch_t batch;
+    uint8_t            flags;
+} timeline_context_t;
+
+static void TIMELINE_set(void* context, uint8_t i, hsv_t hsv) {
+    timeline_context_t* timeline = context;
+    if (HAS_ANY_FLAGS(g_led_config.flags[i], timeline->flags)) {
+        hsv.v = scale8(hsv.v, rgb_matrix_config.hsv.v);
+        rgb_matrix_batch_set_hsv(&timeline->batch, i, hsv);
+    }
+}
+
+bool TIMELINE(effect_params_t* params) {
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+    timeline_context_t timeline = {.flags = params->flags};
+
+    // LEDs outside of all groups stay off
+    for (uint8_t i = led_min; i < led_max; i++) {
+        RGB_MATRIX_TEST_LED_FLAGS();
+        rgb_matrix_set_color(i, 0, 0, 0);
+    }
+
+    // Real time at the default speed
+    uint32_t time = ((uint64_t)g_rgb_timer * (rgb_matrix_config.speed + 1)) >> 7;
+    rgb_matrix_timeline_draw(rgb_matrix_timeline_data, rgb_matrix_timeline_get_animation(), time, led_min, led_max, g_led_config.flags, TIMELINE_set, &timeline);
+    rgb_matrix_batch_flush(&timeline.batch);
+    return rgb_matrix_check_finished_leds(led_max);
+}
+
+#    endif // RGB_MATRIX_CUSTOM_EFFECT_IMPLS
+#endif     // ENABLE_RGB_MATRIX_TIMELINE
@@ -24,6 +24,27 @@ void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
     if (g_led_config.matrix_co[row][col] == NO_LED) { // skip as pressed key doesn't have an led position
         return;
     }
+#            if defined(RGB_MATRIX_GEOMETRY_TABLES) && RGB_MATRIX_TYPING_HEATMAP_SPREAD <= RGB_MATRIX_GEOMETRY_NEIGHBOR_RADIUS
+    // Only visit the keys close enough to the pressed one, from the generated neighbour lists
+    uint8_t  led = g_led_config.matrix_co[row][col];
+    uint16_t end = pgm_read_word(&g_rgb_matrix_neighbor_offsets[led + 1]);
+    for (uint16_t i = pgm_read_word(&g_rgb_matrix_neighbor_offsets[led]); i < end; i++) {
+        uint8_t i_row = pgm_read_byte(&g_rgb_matrix_neighbors[i].row);
+        uint8_t i_col = pgm_read_byte(&g_rgb_matrix_neighbors[i].col);
+        if (i_row == row && i_col == col) {
+            g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+        } else {
+            uint8_t distance = pgm_read_byte(&g_rgb_matrix_neighbors[i].dist);
+            if (distance <= RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
+                uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance);
+                if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
+                    amount = RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT;
+                }
+                g_rgb_frame_buffer[i_row][i_col] = qadd8(g_rgb_frame_buffer[i_row][i_col], amount);
+            }
+        }
+    }
+#            else
     for (uint8_t i_row = 0; i_row < MATRIX_ROWS; i_row++) {
         for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
             if (g_led_config.matrix_co[i_row][i_col] == NO_LED) { // skip as target key doesn't have an led position
@@ -32,9 +53,9 @@ void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
             if (i_row == row && i_col == col) {
                 g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
             } else {
-#            define LED_DISTANCE(led_a, led_b) sqrt16(((int16_t)(led_a.x - led_b.x) * (int16_t)(led_a.x - led_b.x)) + ((int16_t)(led_a.y - led_b.y) * (int16_t)(led_a.y - led_b.y)))
+#                define LED_DISTANCE(led_a, led_b) sqrt16(((int16_t)(led_a.x - led_b.x) * (int16_t)(led_a.x - led_b.x)) + ((int16_t)(led_a.y - led_b.y) * (int16_t)(led_a.y - led_b.y)))
                 uint8_t distance = LED_DISTANCE(g_led_config.point[g_led_config.matrix_co[row][col]], g_led_config.point[g_led_config.matrix_co[i_row][i_col]]);
-#            undef LED_DISTANCE
+#                undef LED_DISTANCE
                 if (distance <= RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
                     uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance);
                     if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
@@ -45,6 +66,7 @@ void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
             }
         }
     }
+#            endif
 #        endif
 }
 
@@ -22,20 +22,74 @@
 #include "keyboard.h"
 #include "sync_timer.h"
 #include "debug.h"
+#include "compiler_support.h"
+#ifdef RGB_MATRIX_RENDER_ON_CHANGE
+#    include "action_layer.h"
+#    include "action_util.h"
+#    include "host.h"
+#endif
+#ifdef RGB_MATRIX_OUTPUT_LUT
+#    include "rgb_matrix_output.h"
+#endif
+#ifdef LED_POWER_ENABLE
+#    include "led_power.h"
+#elif defined(LED_POWER_BUDGET)
+#    error "LED_POWER_BUDGET needs LED_POWER_ENABLE = yes in rules.mk"
+#endif
 #include <string.h>
 #include <math.h>
 #include <stdlib.h>
 
 #include <lib/lib8tion/lib8tion.h>
 
-#ifndef RGB_MATRIX_CENTER
+#if defined(RGB_MATRIX_GEOMETRY_TABLES)
+// Generated with the geometry tables, from the center they are computed for
+extern const led_point_t k_rgb_matrix_center;
+#elif !defined(RGB_MATRIX_CENTER)
 const led_point_t k_rgb_matrix_center = {112, 32};
 #else
 const led_point_t k_rgb_matrix_center = RGB_MATRIX_CENTER;
 #endif
 
+// Set by the default conversion below, so the batch conversion can tell whether the keyboard overrode it
+static bool rgb_matrix_hsv_to_rgb_default;
+
 __attribute__((weak)) rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
+    rgb_matrix_hsv_to_rgb_default = true;
+    // With the output tables the lightness curve is applied to each channel on output, not to the value here
+#ifdef RGB_MATRIX_OUTPUT_LUT
+    return hsv_to_rgb_nocie(hsv);
+#else
     return hsv_to_rgb(hsv);
+#endif
+}
+
+__attribute__((weak)) void rgb_matrix_hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count) {
+    if (count == 0) return;
+
+    // The first element goes through rgb_matrix_hsv_to_rgb(), and the rest too if it turns out to be overridden
+    rgb_matrix_hsv_to_rgb_default = false;
+    rgb[0]                        = rgb_matrix_hsv_to_rgb(hsv[0]);
+    if (!rgb_matrix_hsv_to_rgb_default) {
+        for (uint8_t i = 1; i < count; i++) {
+            rgb[i] = rgb_matrix_hsv_to_rgb(hsv[i]);
+        }
+        return;
+    }
+#ifdef RGB_MATRIX_OUTPUT_LUT
+    hsv_to_rgb_batch_nocie(&hsv[1], &rgb[1], count - 1);
+#else
+    hsv_to_rgb_batch(&hsv[1], &rgb[1], count - 1);
+#endif
+}
+
+void rgb_matrix_batch_flush(rgb_matrix_batch_t *batch) {
+    rgb_t rgb[RGB_MATRIX_BATCH_SIZE];
+    rgb_matrix_hsv_to_rgb_batch(batch->hsv, rgb, batch->count);
+    for (uint8_t i = 0; i < batch->count; i++) {
+        rgb_matrix_set_color(batch->index[i], rgb[i].r, rgb[i].g, rgb[i].b);
+    }
+    batch->count = 0;
 }
 
 // Generic effect runners
@@ -43,7 +97,7 @@ __attribute__((weak)) rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
 
 // ------------------------------------------
 // -----Begin rgb effect includes macros-----
-#define RGB_MATRIX_EFFECT(name)
+#define RGB_MATRIX_EFFECT(name, ...)
 #define RGB_MATRIX_CUSTOM_EFFECT_IMPLS
 
 #include "rgb_matrix_effects.inc"
@@ -79,6 +133,26 @@ static uint8_t         rgb_last_effect   = UINT8_MAX;
 static effect_params_t rgb_effect_params = {0, LED_FLAG_ALL, false};
 static rgb_task_states rgb_task_state    = SYNCING;
 
+#ifdef RGB_MATRIX_RENDER_ON_CHANGE
+// What static effects and the usual indicators are drawn from
+typedef struct {
+    uint64_t      config;
+    uint8_t       effect;
+    layer_state_t layer_state;
+    layer_state_t default_layer_state;
+    uint8_t       led_state;
+    uint8_t       mods;
+} rgb_render_inputs_t;
+
+static rgb_render_inputs_t rgb_rendered_inputs;
+static bool                rgb_render_invalid = true;
+#endif // RGB_MATRIX_RENDER_ON_CHANGE
+
+#ifdef LED_POWER_ENABLE
+// the power budget scale last applied to the LEDs
+static uint16_t rgb_power_scale = LED_POWER_SCALE_FULL;
+#endif
+
 // double buffers
 static uint32_t rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
@@ -88,6 +162,21 @@ static last_hit_t last_hit_buffer;
 // split rgb matrix
 #if defined(RGB_MATRIX_SPLIT)
 const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
+
+// Each half only renders its own LEDs, from the first to one past the last
+static uint8_t rgb_split_first_led(void) {
+    return is_keyboard_left() ? 0 : k_rgb_matrix_split[0];
+}
+
+static uint8_t rgb_split_last_led(void) {
+    return is_keyboard_left() ? k_rgb_matrix_split[0] : RGB_MATRIX_LED_COUNT;
+}
+
+// The master queues key events for the slave, which keeps the count it has handled
+STATIC_ASSERT((RGB_MATRIX_SPLIT_HITS & (RGB_MATRIX_SPLIT_HITS - 1)) == 0, "RGB_MATRIX_SPLIT_HITS must be a power of two");
+static rgb_matrix_hits_t rgb_split_hits;
+// Whether the slave's count follows the master's, until then the first key events it gets are only counted
+static bool rgb_split_hits_synced = false;
 #endif
 
 EECONFIG_DEBOUNCE_HELPER(rgb_matrix, rgb_matrix_config);
@@ -155,23 +244,35 @@ __attribute__((weak)) int rgb_matrix_led_index(int index) {
 }
 
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
-    rgb_matrix_driver.set_color(rgb_matrix_led_index(index), red, green, blue);
+    int led = rgb_matrix_led_index(index);
+#ifdef RGB_MATRIX_OUTPUT_LUT
+    rgb_t rgb = rgb_matrix_output_lookup(red, green, blue);
+#else
+    rgb_t rgb = {.r = red, .g = green, .b = blue};
+#endif
+#ifdef LED_POWER_ENABLE
+    rgb = led_power_set_color(LED_POWER_RGB_MATRIX_FIRST + led, rgb.r, rgb.g, rgb.b);
+#endif
+    rgb_matrix_driver.set_color(led, rgb.r, rgb.g, rgb.b);
 }
 
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 #if defined(RGB_MATRIX_SPLIT)
+    for (uint8_t i = rgb_split_first_led(); i < rgb_split_last_led(); i++)
+        rgb_matrix_set_color(i, red, green, blue);
+#elif defined(LED_POWER_ENABLE)
+    // every LED has to be recorded for the estimate
     for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++)
         rgb_matrix_set_color(i, red, green, blue);
+#elif defined(RGB_MATRIX_OUTPUT_LUT)
+    rgb_t rgb = rgb_matrix_output_lookup(red, green, blue);
+    rgb_matrix_driver.set_color_all(rgb.r, rgb.g, rgb.b);
 #else
     rgb_matrix_driver.set_color_all(red, green, blue);
 #endif
 }
 
-void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
-#ifndef RGB_MATRIX_SPLIT
-    if (!is_keyboard_master()) return;
-#endif
-
+static void rgb_matrix_process_key_event(uint8_t row, uint8_t col, bool pressed) {
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     uint8_t led[LED_HITS_TO_REMEMBER];
     uint8_t led_count = 0;
@@ -217,6 +318,49 @@ void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
 #endif // defined(RGB_MATRIX_FRAMEBUFFER_EFFECTS) && defined(ENABLE_RGB_MATRIX_TYPING_HEATMAP)
 }
 
+void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
+    // The slave of a split keyboard gets all key events from the master instead
+    if (!is_keyboard_master()) return;
+
+#if defined(RGB_MATRIX_SPLIT) && (defined(RGB_MATRIX_KEYREACTIVE_ENABLED) || (defined(RGB_MATRIX_FRAMEBUFFER_EFFECTS) && defined(ENABLE_RGB_MATRIX_TYPING_HEATMAP)))
+    rgb_split_hits.hit[rgb_split_hits.count % RGB_MATRIX_SPLIT_HITS] = (rgb_matrix_hit_t){.row = row, .col = col, .pressed = pressed};
+    rgb_split_hits.count++;
+#endif
+
+    rgb_matrix_process_key_event(row, col, pressed);
+}
+
+#if defined(RGB_MATRIX_SPLIT)
+void rgb_matrix_get_split_hits(rgb_matrix_hits_t *hits) {
+    *hits = rgb_split_hits;
+}
+
+void rgb_matrix_set_split_hits(const rgb_matrix_hits_t *hits) {
+    if (!rgb_split_hits_synced) {
+        // The key events queued before then are long gone, replaying them would only light up phantom presses
+        rgb_split_hits.count  = hits->count;
+        rgb_split_hits_synced = true;
+        return;
+    }
+
+    uint8_t unseen = hits->count - rgb_split_hits.count;
+    if (unseen > RGB_MATRIX_SPLIT_HITS) {
+        // The older ones were overwritten before they could be sent
+        unseen = RGB_MATRIX_SPLIT_HITS;
+    }
+
+    for (uint8_t i = hits->count - unseen; i != hits->count; i++) {
+        const rgb_matrix_hit_t *hit = &hits->hit[i % RGB_MATRIX_SPLIT_HITS];
+        rgb_matrix_process_key_event(hit->row, hit->col, hit->pressed);
+    }
+    rgb_split_hits.count = hits->count;
+}
+
+void rgb_matrix_resync_split_hits(void) {
+    rgb_split_hits_synced = false;
+}
+#endif // RGB_MATRIX_SPLIT
+
 void rgb_matrix_test(void) {
     // Mask out bits 4 and 5
     // Increase the factor to make the test animation slower (and reduce to make it faster)
@@ -269,16 +413,101 @@ static void rgb_task_timers(void) {
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 }
 
-static void rgb_task_sync(void) {
+#ifdef RGB_MATRIX_RENDER_ON_CHANGE
+// RGB_MATRIX_EFFECT(name, STATIC) declares an effect that only draws from the inputs below
+#    define RGB_MATRIX_EFFECT_IS_STATIC_ false
+#    define RGB_MATRIX_EFFECT_IS_STATIC_STATIC true
+
+static bool rgb_matrix_effect_is_static(uint8_t effect) {
+    switch (effect) {
+        case RGB_MATRIX_NONE:
+            return true;
+
+#    define RGB_MATRIX_EFFECT(name, ...) \
+        case RGB_MATRIX_##name:          \
+            return RGB_MATRIX_EFFECT_IS_STATIC_##__VA_ARGS__;
+#    include "rgb_matrix_effects.inc"
+#    undef RGB_MATRIX_EFFECT
+
+#    ifdef COMMUNITY_MODULES_ENABLE
+#        define RGB_MATRIX_EFFECT(name, ...)         \
+            case RGB_MATRIX_COMMUNITY_MODULE_##name: \
+                return RGB_MATRIX_EFFECT_IS_STATIC_##__VA_ARGS__;
+#        include "rgb_matrix_community_modules.inc"
+#        undef RGB_MATRIX_EFFECT
+#    endif
+
+#    if defined(RGB_MATRIX_CUSTOM_KB) || defined(RGB_MATRIX_CUSTOM_USER)
+#        define RGB_MATRIX_EFFECT(name, ...) \
+            case RGB_MATRIX_CUSTOM_##name:   \
+                return RGB_MATRIX_EFFECT_IS_STATIC_##__VA_ARGS__;
+#        ifdef RGB_MATRIX_CUSTOM_KB
+#            include "rgb_matrix_kb.inc"
+#        endif
+#        ifdef RGB_MATRIX_CUSTOM_USER
+#            include "rgb_matrix_user.inc"
+#        endif
+#        undef RGB_MATRIX_EFFECT
+#    endif
+
+        default:
+            return false;
+    }
+}
+
+static void rgb_render_inputs_read(rgb_render_inputs_t *inputs, uint8_t effect) {
+    inputs->config              = rgb_matrix_config.raw;
+    inputs->effect              = effect;
+    inputs->layer_state         = layer_state;
+    inputs->default_layer_state = default_layer_state;
+    inputs->led_state           = host_keyboard_led_state().raw;
+    inputs->mods                = get_mods();
+#    ifndef NO_ACTION_ONESHOT
+    inputs->mods |= get_oneshot_mods();
+#    endif
+}
+
+// A static effect does not need to be rendered again until one of its inputs changes
+static bool rgb_task_unchanged(uint8_t effect) {
+    if (rgb_render_invalid || !rgb_matrix_effect_is_static(effect)) {
+        return false;
+    }
+
+    rgb_render_inputs_t inputs;
+    rgb_render_inputs_read(&inputs, effect);
+    return inputs.config == rgb_rendered_inputs.config && inputs.effect == rgb_rendered_inputs.effect && inputs.layer_state == rgb_rendered_inputs.layer_state && inputs.default_layer_state == rgb_rendered_inputs.default_layer_state && inputs.led_state == rgb_rendered_inputs.led_state && inputs.mods == rgb_rendered_inputs.mods;
+}
+#endif // RGB_MATRIX_RENDER_ON_CHANGE
+
+void rgb_matrix_invalidate(void) {
+#ifdef RGB_MATRIX_RENDER_ON_CHANGE
+    rgb_render_invalid = true;
+#endif
+}
+
+static void rgb_task_sync(uint8_t effect) {
     eeconfig_flush_rgb_matrix(false);
     // next task
+#ifdef RGB_MATRIX_RENDER_ON_CHANGE
+#    ifdef LED_POWER_ENABLE
+    // the other lighting feature moved the scale
+    if (led_power_scale() != rgb_power_scale) rgb_render_invalid = true;
+#    endif
+    if (rgb_task_unchanged(effect)) return;
+#endif
     if (sync_timer_elapsed32(g_rgb_timer) >= RGB_MATRIX_LED_FLUSH_LIMIT) rgb_task_state = STARTING;
 }
 
-static void rgb_task_start(void) {
+static void rgb_task_start(uint8_t effect) {
     // reset iter
     rgb_effect_params.iter = 0;
 
+#ifdef RGB_MATRIX_RENDER_ON_CHANGE
+    // anything changing from here on is picked up by the next frame
+    rgb_render_inputs_read(&rgb_rendered_inputs, effect);
+    rgb_render_invalid = false;
+#endif
+
     // update double buffers
     g_rgb_timer = rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
@@ -358,11 +587,41 @@ static void rgb_task_render(uint8_t effect) {
     }
 }
 
+#ifdef LED_POWER_ENABLE
+// Scale the frame to the power budget, sending every LED again if the scale moved since the last frame
+static void rgb_task_power(void) {
+    uint16_t scale = led_power_update();
+    if (scale != rgb_power_scale) {
+        rgb_power_scale = scale;
+#    if defined(RGB_MATRIX_SPLIT)
+        uint8_t first = rgb_split_first_led();
+        uint8_t last  = rgb_split_last_led();
+#    else
+        uint8_t first = 0;
+        uint8_t last  = RGB_MATRIX_LED_COUNT;
+#    endif
+        for (uint8_t i = first; i < last; i++) {
+            int   led = rgb_matrix_led_index(i);
+            rgb_t rgb = led_power_get_color(LED_POWER_RGB_MATRIX_FIRST + led);
+            rgb_matrix_driver.set_color(led, rgb.r, rgb.g, rgb.b);
+        }
+    }
+#    ifdef RGB_MATRIX_RENDER_ON_CHANGE
+    // keep flushing while the scale recovers, even if the effect is static
+    if (!led_power_settled()) rgb_render_invalid = true;
+#    endif
+}
+#endif
+
 static void rgb_task_flush(uint8_t effect) {
     // update last trackers after the first full render so we can init over several frames
     rgb_last_effect = effect;
     rgb_last_enable = rgb_matrix_config.enable;
 
+#ifdef LED_POWER_ENABLE
+    rgb_task_power();
+#endif
+
     // update pwm buffers
     rgb_matrix_update_pwm_buffers();
 
@@ -370,9 +629,8 @@ static void rgb_task_flush(uint8_t effect) {
     rgb_task_state = SYNCING;
 }
 
-void rgb_matrix_task(void) {
-    rgb_task_timers();
-
+// The effect to render, none while suspended or disabled
+static uint8_t rgb_task_effect(void) {
     // Ideally we would also stop sending zeros to the LED driver PWM buffers
     // while suspended and just do a software shutdown. This is a cheap hack for now.
     bool suspend_backlight = suspend_state ||
@@ -381,13 +639,23 @@ void rgb_matrix_task(void) {
 #endif // RGB_MATRIX_TIMEOUT > 0
                              false;
 
-    uint8_t effect = suspend_backlight || !rgb_matrix_config.enable ? 0 : rgb_matrix_config.mode;
+    return suspend_backlight || !rgb_matrix_config.enable ? 0 : rgb_matrix_config.mode;
+}
+
+void rgb_matrix_task(void) {
+    rgb_task_timers();
+
+    uint8_t effect = rgb_task_effect();
 
     switch (rgb_task_state) {
         case STARTING:
-            rgb_task_start();
+            rgb_task_start(effect);
             break;
         case RENDERING:
+#if defined(RGB_MATRIX_OUTPUT_LUT) && defined(USE_CIE1931_CURVE)
+            // the output tables apply the curve, so conversions in effects, indicators and overrides must not
+            hsv_to_rgb_cie_enable(false);
+#endif
             rgb_task_render(effect);
             if (effect) {
                 if (rgb_task_state == FLUSHING) { // ensure we only draw basic indicators once rendering is finished
@@ -395,16 +663,46 @@ void rgb_matrix_task(void) {
                 }
                 rgb_matrix_indicators_advanced(&rgb_effect_params);
             }
+#if defined(RGB_MATRIX_OUTPUT_LUT) && defined(USE_CIE1931_CURVE)
+            hsv_to_rgb_cie_enable(true);
+#endif
             break;
         case FLUSHING:
-            rgb_task_flush(effect);
+            // the driver is still sending the previous frame, try again on the next task
+            if (!rgb_matrix_driver.ready || rgb_matrix_driver.ready()) {
+                rgb_task_flush(effect);
+            }
             break;
         case SYNCING:
-            rgb_task_sync();
+            rgb_task_sync(effect);
             break;
     }
 }
 
+// Rendering and flushing continue on the next pass, syncing waits for the flush limit
+bool rgb_matrix_next_deadline(uint32_t *deadline) {
+    uint32_t wait = 0;
+#ifdef RGB_MATRIX_RENDER_ON_CHANGE
+    // A parked static effect only wakes up for input, or for the timeout to blank it
+    if (rgb_task_state == SYNCING && rgb_task_unchanged(rgb_task_effect())) {
+#    if RGB_MATRIX_TIMEOUT > 0
+        uint32_t idle = last_input_activity_elapsed();
+        if (rgb_matrix_config.enable && !suspend_state && idle <= (uint32_t)RGB_MATRIX_TIMEOUT) {
+            *deadline = timer_read32() + (uint32_t)RGB_MATRIX_TIMEOUT - idle + 1;
+            return true;
+        }
+#    endif // RGB_MATRIX_TIMEOUT > 0
+        return false;
+    }
+#endif // RGB_MATRIX_RENDER_ON_CHANGE
+    if (rgb_task_state == SYNCING) {
+        uint32_t elapsed = sync_timer_elapsed32(g_rgb_timer);
+        wait             = elapsed < RGB_MATRIX_LED_FLUSH_LIMIT ? RGB_MATRIX_LED_FLUSH_LIMIT - elapsed : 0;
+    }
+    *deadline = timer_read32() + wait;
+    return true;
+}
+
 __attribute__((weak)) bool rgb_matrix_indicators_modules(void) {
     return true;
 }
@@ -424,28 +722,21 @@ __attribute__((weak)) bool rgb_matrix_indicators_user(void) {
 
 struct rgb_matrix_limits_t rgb_matrix_get_limits(uint8_t iter) {
     struct rgb_matrix_limits_t limits = {0};
+#if defined(RGB_MATRIX_SPLIT)
+    uint8_t first = rgb_split_first_led();
+    uint8_t last  = rgb_split_last_led();
+#else
+    uint8_t first = 0;
+    uint8_t last  = RGB_MATRIX_LED_COUNT;
+#endif
 #if defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
-#    if defined(RGB_MATRIX_SPLIT)
-    limits.led_min_index = RGB_MATRIX_LED_PROCESS_LIMIT * (iter);
-    limits.led_max_index = limits.led_min_index + RGB_MATRIX_LED_PROCESS_LIMIT;
-    if (limits.led_max_index > RGB_MATRIX_LED_COUNT) limits.led_max_index = RGB_MATRIX_LED_COUNT;
-    if (is_keyboard_left() && (limits.led_max_index > k_rgb_matrix_split[0])) limits.led_max_index = k_rgb_matrix_split[0];
-    if (!(is_keyboard_left()) && (limits.led_min_index < k_rgb_matrix_split[0])) limits.led_min_index = k_rgb_matrix_split[0];
-#    else
-    limits.led_min_index = RGB_MATRIX_LED_PROCESS_LIMIT * (iter);
-    limits.led_max_index = limits.led_min_index + RGB_MATRIX_LED_PROCESS_LIMIT;
-    if (limits.led_max_index > RGB_MATRIX_LED_COUNT) limits.led_max_index = RGB_MATRIX_LED_COUNT;
-#    endif
+    // Iterations start at the first LED of this half, so a half renders in as few as its LEDs need
+    uint16_t min         = first + RGB_MATRIX_LED_PROCESS_LIMIT * iter;
+    limits.led_min_index = MIN(min, last);
+    limits.led_max_index = MIN(min + RGB_MATRIX_LED_PROCESS_LIMIT, last);
 #else
-#    if defined(RGB_MATRIX_SPLIT)
-    limits.led_min_index = 0;
-    limits.led_max_index = RGB_MATRIX_LED_COUNT;
-    if (is_keyboard_left() && (limits.led_max_index > k_rgb_matrix_split[0])) limits.led_max_index = k_rgb_matrix_split[0];
-    if (!(is_keyboard_left()) && (limits.led_min_index < k_rgb_matrix_split[0])) limits.led_min_index = k_rgb_matrix_split[0];
-#    else
-    limits.led_min_index = 0;
-    limits.led_max_index = RGB_MATRIX_LED_COUNT;
-#    endif
+    limits.led_min_index = first;
+    limits.led_max_index = last;
 #endif
     return limits;
 }
@@ -475,6 +766,7 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
 
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
+    rgb_matrix_invalidate();
 
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
@@ -500,7 +792,8 @@ void rgb_matrix_set_suspend_state(bool state) {
 #ifdef RGB_MATRIX_SLEEP
     if (state && !suspend_state) { // only run if turning off, and only once
         rgb_task_render(0);        // turn off all LEDs when suspending
-        rgb_task_flush(0);         // and actually flash led state to LEDs
+        rgb_task_flush(0);         // and actually flash led state to LEDs, the driver waits for any frame it is still sending
+        rgb_matrix_invalidate();   // the effect has to be drawn again on resume
     }
     suspend_state = state;
 #endif
@@ -24,6 +24,7 @@
 #include "rgb_matrix_drivers.h"
 #include "color.h"
 #include "keyboard.h"
+#include "progmem.h"
 
 #ifndef RGB_MATRIX_TIMEOUT
 #    define RGB_MATRIX_TIMEOUT 0
@@ -90,6 +91,14 @@
 #    define RGB_MATRIX_LED_PROCESS_LIMIT ((RGB_MATRIX_LED_COUNT + 4) / 5)
 #endif
 
+#ifndef RGB_MATRIX_BATCH_SIZE
+#    define RGB_MATRIX_BATCH_SIZE 16
+#endif
+
+#ifndef RGB_MATRIX_SPLIT_HITS
+#    define RGB_MATRIX_SPLIT_HITS 8
+#endif
+
 struct rgb_matrix_limits_t {
     uint8_t led_min_index;
     uint8_t led_max_index;
@@ -156,9 +165,56 @@ int rgb_matrix_led_index(int index);
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
 
+rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv);
+// Defaults to hsv_to_rgb_batch(), or to rgb_matrix_hsv_to_rgb() on each element if that is overridden
+void rgb_matrix_hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count);
+
+// LEDs collected by an effect, converted to RGB together once RGB_MATRIX_BATCH_SIZE are queued
+typedef struct {
+    uint8_t count;
+    uint8_t index[RGB_MATRIX_BATCH_SIZE];
+    hsv_t   hsv[RGB_MATRIX_BATCH_SIZE];
+} rgb_matrix_batch_t;
+
+// Converts and sets the queued LEDs, call once more after the last rgb_matrix_batch_set_hsv()
+void rgb_matrix_batch_flush(rgb_matrix_batch_t *batch);
+
+static inline void rgb_matrix_batch_set_hsv(rgb_matrix_batch_t *batch, uint8_t index, hsv_t hsv) {
+    batch->index[batch->count] = index;
+    batch->hsv[batch->count]   = hsv;
+    if (++batch->count == RGB_MATRIX_BATCH_SIZE) {
+        rgb_matrix_batch_flush(batch);
+    }
+}
+
 void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed);
 
+#if defined(RGB_MATRIX_SPLIT)
+// A key event seen by the master, replayed on the slave for the reactive effects
+typedef struct PACKED {
+    uint8_t row;
+    uint8_t col : 7;
+    bool    pressed : 1;
+} rgb_matrix_hit_t;
+
+// The last RGB_MATRIX_SPLIT_HITS key events, out of `count` so far
+typedef struct PACKED {
+    uint8_t          count;
+    rgb_matrix_hit_t hit[RGB_MATRIX_SPLIT_HITS];
+} rgb_matrix_hits_t;
+
+// Master side, the key events to send to the slave
+void rgb_matrix_get_split_hits(rgb_matrix_hits_t *hits);
+// Slave side, handles the key events it has not seen yet, the first call after boot or a resync only takes the count
+void rgb_matrix_set_split_hits(const rgb_matrix_hits_t *hits);
+// Slave side, for when the master may have been reset, so the next key events it gets are not replayed
+void rgb_matrix_resync_split_hits(void);
+#endif
+
 void rgb_matrix_task(void);
+bool rgb_matrix_next_deadline(uint32_t *deadline);
+// Forces the next frame to be rendered, for RGB_MATRIX_RENDER_ON_CHANGE
+void rgb_matrix_invalidate(void);
 
 // This runs after another backlight effect and replaces
 // colors already set
@@ -286,3 +342,28 @@ extern last_hit_t g_last_hit_tracker;
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
 #endif
+
+// Generated from the info.json layout, see "Geometry Tables" in the RGB Matrix docs
+#ifdef RGB_MATRIX_GEOMETRY_TABLES
+extern const uint8_t PROGMEM g_rgb_matrix_center_dist[RGB_MATRIX_LED_COUNT];
+extern const uint8_t PROGMEM g_rgb_matrix_center_angle[RGB_MATRIX_LED_COUNT];
+#    if defined(RGB_MATRIX_FRAMEBUFFER_EFFECTS) && defined(ENABLE_RGB_MATRIX_TYPING_HEATMAP)
+// The keys near LED `i` are g_rgb_matrix_neighbors[g_rgb_matrix_neighbor_offsets[i]] up to [g_rgb_matrix_neighbor_offsets[i + 1]]
+extern const uint16_t PROGMEM       g_rgb_matrix_neighbor_offsets[RGB_MATRIX_LED_COUNT + 1];
+extern const led_neighbor_t PROGMEM g_rgb_matrix_neighbors[];
+#    endif
+#endif
+#ifdef RGB_MATRIX_GEOMETRY_PAIRWISE
+extern const uint8_t PROGMEM g_rgb_matrix_pairwise_dist[RGB_MATRIX_LED_COUNT * (RGB_MATRIX_LED_COUNT - 1) / 2];
+
+static inline uint8_t rgb_matrix_led_distance(uint8_t a, uint8_t b) {
+    if (a < b) {
+        uint8_t swap = a;
+        a            = b;
+        b            = swap;
+    } else if (a == b) {
+        return 0;
+    }
+    return pgm_read_byte(&g_rgb_matrix_pairwise_dist[(uint16_t)a * (a - 1) / 2 + b]);
+}
+#endif
@@ -151,6 +151,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = ws2812_flush,
     .set_color     = ws2812_set_color,
     .set_color_all = ws2812_set_color_all,
+    .ready         = ws2812_ready,
 };
 
 #endif
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #if defined(RGB_MATRIX_AW20216S)
 #    include "aw20216s.h"
@@ -46,6 +47,8 @@ typedef struct {
     void (*set_color_all)(uint8_t r, uint8_t g, uint8_t b);
     /* Flush any buffered changes to the hardware. */
     void (*flush)(void);
+    /* Optional, return false while the previous flush is still being sent so that the next one waits. */
+    bool (*ready)(void);
 } rgb_matrix_driver_t;
 
 extern const rgb_matrix_driver_t rgb_matrix_driver;
@@ -0,0 +1,43 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix_output.h"
+#include "led_tables.h"
+#include "progmem.h"
+
+#if RGB_MATRIX_WHITE_BALANCE_RED > 255 || RGB_MATRIX_WHITE_BALANCE_GREEN > 255 || RGB_MATRIX_WHITE_BALANCE_BLUE > 255 || RGB_MATRIX_OUTPUT_LIMIT > 255
+#    error "RGB_MATRIX_WHITE_BALANCE_* and RGB_MATRIX_OUTPUT_LIMIT range from 0 to 255"
+#endif
+
+// One entry of a channel table, rounded
+#define OUTPUT_VALUE(value, balance) (uint8_t)(((uint32_t)(value) * (balance) * RGB_MATRIX_OUTPUT_LIMIT + 255 * 255 / 2) / (255 * 255)),
+#define OUTPUT_VALUE_RED(value) OUTPUT_VALUE(value, RGB_MATRIX_WHITE_BALANCE_RED)
+#define OUTPUT_VALUE_GREEN(value) OUTPUT_VALUE(value, RGB_MATRIX_WHITE_BALANCE_GREEN)
+#define OUTPUT_VALUE_BLUE(value) OUTPUT_VALUE(value, RGB_MATRIX_WHITE_BALANCE_BLUE)
+
+// clang-format off
+#if RGB_MATRIX_WHITE_BALANCE_RED == RGB_MATRIX_WHITE_BALANCE_GREEN && RGB_MATRIX_WHITE_BALANCE_RED == RGB_MATRIX_WHITE_BALANCE_BLUE
+// Balanced channels share a table
+#    define OUTPUT_TABLE_GREEN 0
+#    define OUTPUT_TABLE_BLUE 0
+static const uint8_t output_tables[1][256] PROGMEM = {
+    {CIE1931_CURVE_VALUES(OUTPUT_VALUE_RED)},
+};
+#else
+#    define OUTPUT_TABLE_GREEN 1
+#    define OUTPUT_TABLE_BLUE 2
+static const uint8_t output_tables[3][256] PROGMEM = {
+    {CIE1931_CURVE_VALUES(OUTPUT_VALUE_RED)},
+    {CIE1931_CURVE_VALUES(OUTPUT_VALUE_GREEN)},
+    {CIE1931_CURVE_VALUES(OUTPUT_VALUE_BLUE)},
+};
+#endif
+// clang-format on
+
+rgb_t rgb_matrix_output_lookup(uint8_t red, uint8_t green, uint8_t blue) {
+    return (rgb_t){
+        .r = pgm_read_byte(&output_tables[0][red]),
+        .g = pgm_read_byte(&output_tables[OUTPUT_TABLE_GREEN][green]),
+        .b = pgm_read_byte(&output_tables[OUTPUT_TABLE_BLUE][blue]),
+    };
+}
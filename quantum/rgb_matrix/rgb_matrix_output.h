@@ -0,0 +1,37 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "color.h"
+
+/*
+    The output tables of RGB_MATRIX_OUTPUT_LUT, which every colour passes
+    through on its way to the driver: the CIE 1931 lightness curve, then the
+    white balance of each channel, then the current limit. They are built at
+    compile time, one lookup per channel replaces the curve the HSV effects
+    applied to their value and leaves RGB colours (indicators, framebuffer
+    effects) on the same curve.
+*/
+
+/* Scale of each channel at full brightness, to even out LEDs whose white is tinted. */
+#ifndef RGB_MATRIX_WHITE_BALANCE_RED
+#    define RGB_MATRIX_WHITE_BALANCE_RED 255
+#endif
+#ifndef RGB_MATRIX_WHITE_BALANCE_GREEN
+#    define RGB_MATRIX_WHITE_BALANCE_GREEN 255
+#endif
+#ifndef RGB_MATRIX_WHITE_BALANCE_BLUE
+#    define RGB_MATRIX_WHITE_BALANCE_BLUE 255
+#endif
+
+/* Highest value any channel is driven at, to cap the current the LEDs draw. */
+#ifndef RGB_MATRIX_OUTPUT_LIMIT
+#    define RGB_MATRIX_OUTPUT_LIMIT 255
+#endif
+
+/**
+ * @brief Maps a colour through the output tables.
+ */
+rgb_t rgb_matrix_output_lookup(uint8_t red, uint8_t green, uint8_t blue);
@@ -0,0 +1,130 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix_timeline.h"
+#include "progmem.h"
+
+#define TIMELINE_HEADER_SIZE 3
+#define TIMELINE_KEYFRAME_SIZE 4
+
+// Multi-byte values are unaligned, which not every MCU can read as a word
+static uint16_t timeline_read16(const uint8_t *address) {
+    return pgm_read_byte(address) | (pgm_read_byte(address + 1) << 8);
+}
+
+static hsv_t timeline_read_color(const uint8_t *palette, uint8_t index) {
+    const uint8_t *color = palette + index * 3;
+    return (hsv_t){pgm_read_byte(color), pgm_read_byte(color + 1), pgm_read_byte(color + 2)};
+}
+
+static uint8_t timeline_ease(uint8_t easing, uint8_t fraction) {
+    uint16_t rest = 255 - fraction;
+    switch (easing) {
+        case RGB_MATRIX_TIMELINE_EASE_LINEAR:
+            return fraction;
+        case RGB_MATRIX_TIMELINE_EASE_IN:
+            return fraction * fraction / 255;
+        case RGB_MATRIX_TIMELINE_EASE_OUT:
+            return 255 - rest * rest / 255;
+        case RGB_MATRIX_TIMELINE_EASE_IN_OUT:
+            return fraction < 128 ? 2 * fraction * fraction / 255 : 255 - 2 * rest * rest / 255;
+        default:
+            return 0;
+    }
+}
+
+static uint8_t timeline_lerp(uint8_t from, uint8_t to, uint8_t amount) {
+    return from + ((int16_t)to - from) * amount / 255;
+}
+
+// The color of a group at `time`, which is less than `duration`
+static hsv_t timeline_sample(const uint8_t *keyframes, uint8_t count, const uint8_t *palette, uint32_t time, uint16_t duration) {
+    // The last keyframe at or before `time`, or the last one of the previous loop
+    uint8_t current = count - 1;
+    for (uint8_t i = 0; i < count && timeline_read16(keyframes + i * TIMELINE_KEYFRAME_SIZE) <= time; i++) {
+        current = i;
+    }
+
+    const uint8_t *from  = keyframes + current * TIMELINE_KEYFRAME_SIZE;
+    const uint8_t *to    = current + 1 < count ? from + TIMELINE_KEYFRAME_SIZE : keyframes;
+    uint32_t       start = timeline_read16(from);
+    uint32_t       end   = timeline_read16(to);
+    if (current + 1 == count) {
+        // Back to the first keyframe of the next loop
+        end += duration;
+        if (time < start) {
+            time += duration;
+        }
+    }
+
+    uint8_t fraction = end > start ? (time - start) * 255 / (end - start) : 0;
+    uint8_t amount   = timeline_ease(pgm_read_byte(from + 3), fraction);
+    hsv_t   a        = timeline_read_color(palette, pgm_read_byte(from + 2));
+    hsv_t   b        = timeline_read_color(palette, pgm_read_byte(to + 2));
+
+    // Hue takes the shorter way around the color wheel
+    a.h = a.h + (int8_t)(b.h - a.h) * amount / 255;
+    a.s = timeline_lerp(a.s, b.s, amount);
+    a.v = timeline_lerp(a.v, b.v, amount);
+    return a;
+}
+
+uint8_t rgb_matrix_timeline_animation_count(const uint8_t *data) {
+    if (pgm_read_byte(data) != RGB_MATRIX_TIMELINE_VERSION) {
+        return 0;
+    }
+    return pgm_read_byte(data + 2);
+}
+
+bool rgb_matrix_timeline_draw(const uint8_t *data, uint8_t animation, uint32_t time, uint8_t led_min, uint8_t led_max, const uint8_t *led_flags, rgb_matrix_timeline_set_f set, void *context) {
+    if (animation >= rgb_matrix_timeline_animation_count(data)) {
+        return false;
+    }
+
+    const uint8_t *palette  = data + TIMELINE_HEADER_SIZE;
+    const uint8_t *offsets  = palette + pgm_read_byte(data + 1) * 3;
+    const uint8_t *entry    = data + timeline_read16(offsets + animation * 2);
+    uint16_t       duration = timeline_read16(entry);
+    uint8_t        groups   = pgm_read_byte(entry + 2);
+    const uint8_t *group    = entry + 3;
+    if (duration == 0) {
+        return false;
+    }
+
+    time %= duration;
+    for (uint8_t g = 0; g < groups; g++) {
+        uint8_t        led_count = pgm_read_byte(group);
+        uint8_t        flags     = pgm_read_byte(group + 1);
+        uint8_t        count     = pgm_read_byte(group + 2);
+        const uint8_t *leds      = group + 3;
+        const uint8_t *keyframes = leds + led_count;
+        group                    = keyframes + count * TIMELINE_KEYFRAME_SIZE;
+
+        hsv_t hsv = timeline_sample(keyframes, count, palette, time, duration);
+        if (led_count) {
+            for (uint8_t i = 0; i < led_count; i++) {
+                uint8_t led = pgm_read_byte(leds + i);
+                if (led >= led_min && led < led_max) {
+                    set(context, led, hsv);
+                }
+            }
+        } else {
+            for (uint8_t led = led_min; led < led_max; led++) {
+                if (led_flags[led] & flags) {
+                    set(context, led, hsv);
+                }
+            }
+        }
+    }
+    return true;
+}
+
+static uint8_t timeline_animation = 0;
+
+void rgb_matrix_timeline_set_animation(uint8_t animation) {
+    timeline_animation = animation;
+}
+
+uint8_t rgb_matrix_timeline_get_animation(void) {
+    return timeline_animation;
+}
@@ -0,0 +1,73 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "color.h"
+
+/*
+    Keyframe animations for the TIMELINE effect, compiled from JSON into a
+    byte array by `qmk generate-rgb-matrix-timeline`.
+
+    All values are bytes, except for the little endian, unaligned uint16
+    offsets, durations and times:
+
+        version, palette count, animation count
+        palette:    h, s, v of each color
+        offsets:    uint16 offset of each animation from the start of the data
+        animation:  uint16 duration in ms, group count, then for each group
+            group:      LED count, LED flags, keyframe count, the LED indices,
+                        then for each keyframe
+                keyframe:   uint16 time in ms, palette index, easing
+
+    Animations loop after their duration. The color of a group moves from one
+    keyframe to the next with the easing of the first, and from the last back
+    to the first one. A group without LEDs covers all LEDs with any of its
+    flags. Groups are drawn in order, so later groups paint over earlier ones.
+*/
+
+#define RGB_MATRIX_TIMELINE_VERSION 1
+
+typedef enum {
+    RGB_MATRIX_TIMELINE_EASE_STEP,
+    RGB_MATRIX_TIMELINE_EASE_LINEAR,
+    RGB_MATRIX_TIMELINE_EASE_IN,
+    RGB_MATRIX_TIMELINE_EASE_OUT,
+    RGB_MATRIX_TIMELINE_EASE_IN_OUT,
+} rgb_matrix_timeline_easing_t;
+
+typedef void (*rgb_matrix_timeline_set_f)(void *context, uint8_t index, hsv_t hsv);
+
+/**
+ * @brief Validates the header of the animation data.
+ *
+ * @param data the animation data, in PROGMEM
+ * @return the number of animations, 0 if the data is of another version
+ */
+uint8_t rgb_matrix_timeline_animation_count(const uint8_t *data);
+
+/**
+ * @brief Draws a frame of an animation.
+ *
+ * Costs one pass over the keyframes and LEDs of each group, LEDs outside of
+ * `led_min` to `led_max` are skipped.
+ *
+ * @param data the animation data, in PROGMEM
+ * @param animation the index of the animation to draw
+ * @param time the time into the animation, in ms
+ * @param led_min the first LED to draw
+ * @param led_max one past the last LED to draw
+ * @param led_flags the flags of each LED, for groups without LEDs
+ * @param set called with the color of each LED in a group
+ * @param context passed on to `set`
+ * @return false if `animation` does not exist
+ */
+bool rgb_matrix_timeline_draw(const uint8_t *data, uint8_t animation, uint32_t time, uint8_t led_min, uint8_t led_max, const uint8_t *led_flags, rgb_matrix_timeline_set_f set, void *context);
+
+/** @brief Selects the animation played by the TIMELINE effect. */
+void rgb_matrix_timeline_set_animation(uint8_t animation);
+
+/** @return the animation played by the TIMELINE effect */
+uint8_t rgb_matrix_timeline_get_animation(void);
@@ -75,6 +75,15 @@ typedef struct PACKED {
     uint8_t     flags[RGB_MATRIX_LED_COUNT];
 } led_config_t;
 
+// Largest distance covered by the generated neighbour lists, keep in sync with `qmk generate-keyboard-c`
+#define RGB_MATRIX_GEOMETRY_NEIGHBOR_RADIUS 40
+
+typedef struct PACKED {
+    uint8_t row;
+    uint8_t col;
+    uint8_t dist;
+} led_neighbor_t;
+
 typedef union rgb_config_t {
     uint64_t raw;
     struct PACKED {
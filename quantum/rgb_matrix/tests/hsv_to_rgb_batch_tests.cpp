@@ -0,0 +1,87 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "color.h"
+}
+
+// Every saturation and value of one hue per batch, in batches of all sizes.
+TEST(HsvToRgbBatch, MatchesScalarConversion) {
+    hsv_t hsv[256];
+    rgb_t rgb[256];
+
+    for (unsigned h = 0; h < 256; h++) {
+        for (unsigned s = 0; s < 256; s++) {
+            for (unsigned v = 0; v < 256; v++) {
+                hsv[v] = {(uint8_t)h, (uint8_t)s, (uint8_t)v};
+            }
+            uint8_t size = h % 32 + 1;
+            for (unsigned start = 0; start < 256; start += size) {
+                hsv_to_rgb_batch(&hsv[start], &rgb[start], std::min(256u - start, (unsigned)size));
+            }
+            for (unsigned v = 0; v < 256; v++) {
+                rgb_t expected = hsv_to_rgb(hsv[v]);
+                ASSERT_EQ(rgb[v].r, expected.r) << "hsv " << h << " " << s << " " << v;
+                ASSERT_EQ(rgb[v].g, expected.g) << "hsv " << h << " " << s << " " << v;
+                ASSERT_EQ(rgb[v].b, expected.b) << "hsv " << h << " " << s << " " << v;
+            }
+        }
+    }
+}
+
+// Without the lightness curve, which the rgb_matrix output tables apply instead
+TEST(HsvToRgbBatch, NoCieMatchesScalarConversion) {
+    hsv_t hsv[256];
+    rgb_t rgb[256];
+
+    for (unsigned h = 0; h < 256; h += 3) {
+        for (unsigned s = 0; s < 256; s += 5) {
+            for (unsigned v = 0; v < 256; v++) {
+                hsv[v] = {(uint8_t)h, (uint8_t)s, (uint8_t)v};
+            }
+            hsv_to_rgb_batch_nocie(hsv, rgb, 255);
+            hsv_to_rgb_batch_nocie(&hsv[255], &rgb[255], 1);
+            for (unsigned v = 0; v < 256; v++) {
+                rgb_t expected = hsv_to_rgb_nocie(hsv[v]);
+                ASSERT_EQ(rgb[v].r, expected.r) << "hsv " << h << " " << s << " " << v;
+                ASSERT_EQ(rgb[v].g, expected.g) << "hsv " << h << " " << s << " " << v;
+                ASSERT_EQ(rgb[v].b, expected.b) << "hsv " << h << " " << s << " " << v;
+            }
+        }
+    }
+}
+
+TEST(HsvToRgbBatch, EmptyBatchWritesNothing) {
+    hsv_t hsv = {0, 255, 255};
+    rgb_t rgb = {1, 2, 3};
+
+    hsv_to_rgb_batch(&hsv, &rgb, 0);
+    EXPECT_EQ(rgb.r, 1);
+    EXPECT_EQ(rgb.g, 2);
+    EXPECT_EQ(rgb.b, 3);
+}
+
+#if defined(USE_CIE1931_CURVE) && defined(RGB_MATRIX_OUTPUT_LUT)
+// Turned off while RGB Matrix renders, so keyboard conversions do not apply the curve before its output tables
+TEST(HsvToRgbBatch, CieCanBeTurnedOff) {
+    hsv_t hsv[2] = {{0, 255, 128}, {85, 128, 64}};
+    rgb_t rgb[2];
+
+    hsv_to_rgb_cie_enable(false);
+    hsv_to_rgb_batch(hsv, rgb, 2);
+    for (unsigned i = 0; i < 2; i++) {
+        rgb_t expected = hsv_to_rgb_nocie(hsv[i]);
+        rgb_t scalar   = hsv_to_rgb(hsv[i]);
+        EXPECT_EQ(scalar.r, expected.r);
+        EXPECT_EQ(scalar.g, expected.g);
+        EXPECT_EQ(rgb[i].r, expected.r);
+        EXPECT_EQ(rgb[i].b, expected.b);
+    }
+
+    hsv_to_rgb_cie_enable(true);
+    EXPECT_NE(hsv_to_rgb(hsv[0]).r, hsv_to_rgb_nocie(hsv[0]).r);
+}
+#endif
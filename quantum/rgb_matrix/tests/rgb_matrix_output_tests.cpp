@@ -0,0 +1,47 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cmath>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "rgb_matrix_output.h"
+#include "led_tables.h"
+}
+
+#define CURVE_VALUE(value) value,
+static const uint8_t curve[256] = {CIE1931_CURVE_VALUES(CURVE_VALUE)};
+
+// The table entry worked out in floating point
+static uint8_t expected(uint8_t value, unsigned balance) {
+    return (uint8_t)std::lround(curve[value] * (balance / 255.0) * (RGB_MATRIX_OUTPUT_LIMIT / 255.0));
+}
+
+TEST(RgbMatrixOutput, EachChannelHasItsOwnScale) {
+    for (unsigned value = 0; value < 256; value++) {
+        rgb_t rgb = rgb_matrix_output_lookup(value, value, value);
+        ASSERT_EQ(rgb.r, expected(value, RGB_MATRIX_WHITE_BALANCE_RED)) << "value " << value;
+        ASSERT_EQ(rgb.g, expected(value, RGB_MATRIX_WHITE_BALANCE_GREEN)) << "value " << value;
+        ASSERT_EQ(rgb.b, expected(value, RGB_MATRIX_WHITE_BALANCE_BLUE)) << "value " << value;
+    }
+}
+
+TEST(RgbMatrixOutput, ChannelsAreIndependent) {
+    rgb_t rgb = rgb_matrix_output_lookup(255, 128, 0);
+    EXPECT_EQ(rgb.r, expected(255, RGB_MATRIX_WHITE_BALANCE_RED));
+    EXPECT_EQ(rgb.g, expected(128, RGB_MATRIX_WHITE_BALANCE_GREEN));
+    EXPECT_EQ(rgb.b, 0);
+}
+
+TEST(RgbMatrixOutput, NeverExceedsTheLimit) {
+    uint8_t last = 0;
+    for (unsigned value = 0; value < 256; value++) {
+        rgb_t rgb = rgb_matrix_output_lookup(value, value, value);
+        EXPECT_LE(rgb.r, RGB_MATRIX_OUTPUT_LIMIT);
+        EXPECT_LE(rgb.g, RGB_MATRIX_OUTPUT_LIMIT);
+        EXPECT_LE(rgb.b, RGB_MATRIX_OUTPUT_LIMIT);
+        EXPECT_GE(rgb.r, last) << "value " << value;
+        last = rgb.r;
+    }
+    EXPECT_EQ(rgb_matrix_output_lookup(255, 255, 255).r, RGB_MATRIX_WHITE_BALANCE_RED * RGB_MATRIX_OUTPUT_LIMIT / 255);
+}
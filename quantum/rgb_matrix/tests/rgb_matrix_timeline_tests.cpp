@@ -0,0 +1,113 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <map>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "rgb_matrix_timeline.h"
+}
+
+// clang-format off
+static const uint8_t timeline[] = {
+    RGB_MATRIX_TIMELINE_VERSION, 4, 3,
+    // black, red, blue, white
+    0, 0, 0,    0, 255, 200,    170, 255, 100,    0, 0, 255,
+    21, 0,  44, 0,  55, 0,
+    // 0: 1000 ms, 2 groups
+    0xE8, 0x03, 2,
+        // LEDs 1 and 3, red to blue at 500 ms
+        2, 0, 2, 1, 3,
+            0, 0, 1, RGB_MATRIX_TIMELINE_EASE_LINEAR,
+            0xF4, 0x01, 2, RGB_MATRIX_TIMELINE_EASE_STEP,
+        // LEDs with flag 4, black
+        0, 4, 1,
+            0, 0, 0, RGB_MATRIX_TIMELINE_EASE_STEP,
+    // 1: 1 ms, 1 group
+    1, 0, 1,
+        1, 0, 1, 0,
+            0, 0, 0, RGB_MATRIX_TIMELINE_EASE_LINEAR,
+    // 2: 510 ms, 1 group
+    0xFE, 0x01, 1,
+        // LED 0, black to white at 255 ms
+        1, 0, 2, 0,
+            0, 0, 0, RGB_MATRIX_TIMELINE_EASE_IN,
+            0xFF, 0, 3, RGB_MATRIX_TIMELINE_EASE_OUT,
+};
+
+static const uint8_t led_flags[] = {4, 4, 1, 1};
+// clang-format on
+
+typedef std::map<uint8_t, hsv_t> frame_t;
+
+static void record(void *context, uint8_t index, hsv_t hsv) {
+    (*static_cast<frame_t *>(context))[index] = hsv;
+}
+
+static frame_t draw(uint8_t animation, uint32_t time, uint8_t led_min = 0, uint8_t led_max = sizeof(led_flags)) {
+    frame_t frame;
+    EXPECT_TRUE(rgb_matrix_timeline_draw(timeline, animation, time, led_min, led_max, led_flags, record, &frame));
+    return frame;
+}
+
+#define EXPECT_HSV(frame, index, hue, sat, val)      \
+    do {                                             \
+        ASSERT_EQ((frame).count(index), 1u);         \
+        EXPECT_EQ((frame)[index].h, hue);            \
+        EXPECT_EQ((frame)[index].s, sat);            \
+        EXPECT_EQ((frame)[index].v, val);            \
+    } while (0)
+
+TEST(RgbMatrixTimeline, CountsAnimations) {
+    uint8_t other_version[sizeof(timeline)];
+    std::copy(timeline, timeline + sizeof(timeline), other_version);
+    other_version[0]++;
+
+    EXPECT_EQ(rgb_matrix_timeline_animation_count(timeline), 3);
+    EXPECT_EQ(rgb_matrix_timeline_animation_count(other_version), 0);
+}
+
+TEST(RgbMatrixTimeline, DrawsKeyframes) {
+    frame_t frame = draw(0, 0);
+    EXPECT_EQ(frame.size(), 3u);
+    EXPECT_HSV(frame, 0, 0, 0, 0);
+    EXPECT_HSV(frame, 1, 0, 0, 0);
+    EXPECT_HSV(frame, 3, 0, 255, 200);
+
+    frame = draw(0, 500);
+    EXPECT_HSV(frame, 3, 170, 255, 100);
+}
+
+TEST(RgbMatrixTimeline, InterpolatesTheShorterWayAroundHue) {
+    frame_t frame = draw(0, 250);
+    EXPECT_HSV(frame, 3, 214, 255, 151);
+}
+
+TEST(RgbMatrixTimeline, StepHoldsUntilTheNextLoop) {
+    frame_t frame = draw(0, 999);
+    EXPECT_HSV(frame, 3, 170, 255, 100);
+
+    frame = draw(0, 1250);
+    EXPECT_HSV(frame, 3, 214, 255, 151);
+}
+
+TEST(RgbMatrixTimeline, Eases) {
+    frame_t frame = draw(2, 127);
+    EXPECT_HSV(frame, 0, 0, 0, 63);
+
+    // White back to black across the loop
+    frame = draw(2, 382);
+    EXPECT_HSV(frame, 0, 0, 0, 64);
+}
+
+TEST(RgbMatrixTimeline, SkipsLedsOutOfRange) {
+    frame_t frame = draw(0, 0, 2, 4);
+    EXPECT_EQ(frame.size(), 1u);
+    EXPECT_HSV(frame, 3, 0, 255, 200);
+}
+
+TEST(RgbMatrixTimeline, RejectsMissingAnimation) {
+    frame_t frame;
+    EXPECT_FALSE(rgb_matrix_timeline_draw(timeline, 3, 0, 0, sizeof(led_flags), led_flags, record, &frame));
+    EXPECT_TRUE(frame.empty());
+}
@@ -0,0 +1,37 @@
+hsv_to_rgb_batch_SRC := \
+	$(QUANTUM_PATH)/rgb_matrix/tests/hsv_to_rgb_batch_tests.cpp \
+	$(QUANTUM_PATH)/color.c
+
+hsv_to_rgb_batch_cie_DEFS := -DUSE_CIE1931_CURVE
+
+hsv_to_rgb_batch_cie_SRC := \
+	$(QUANTUM_PATH)/rgb_matrix/tests/hsv_to_rgb_batch_tests.cpp \
+	$(QUANTUM_PATH)/led_tables.c \
+	$(QUANTUM_PATH)/color.c
+
+hsv_to_rgb_batch_output_DEFS := -DUSE_CIE1931_CURVE -DRGB_MATRIX_OUTPUT_LUT
+
+hsv_to_rgb_batch_output_SRC := \
+	$(QUANTUM_PATH)/rgb_matrix/tests/hsv_to_rgb_batch_tests.cpp \
+	$(QUANTUM_PATH)/led_tables.c \
+	$(QUANTUM_PATH)/color.c
+
+rgb_matrix_timeline_INC := $(QUANTUM_PATH)/rgb_matrix
+
+rgb_matrix_timeline_SRC := \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_timeline_tests.cpp \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix_timeline.c
+
+rgb_matrix_output_DEFS := -DRGB_MATRIX_OUTPUT_LUT -DRGB_MATRIX_WHITE_BALANCE_GREEN=200 -DRGB_MATRIX_WHITE_BALANCE_BLUE=180 -DRGB_MATRIX_OUTPUT_LIMIT=128
+rgb_matrix_output_INC := $(QUANTUM_PATH)/rgb_matrix
+
+rgb_matrix_output_SRC := \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_output_tests.cpp \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix_output.c
+
+rgb_matrix_output_default_DEFS := -DRGB_MATRIX_OUTPUT_LUT
+rgb_matrix_output_default_INC := $(QUANTUM_PATH)/rgb_matrix
+
+rgb_matrix_output_default_SRC := \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_output_tests.cpp \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix_output.c
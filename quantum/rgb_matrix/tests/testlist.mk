@@ -0,0 +1,6 @@
+TEST_LIST += hsv_to_rgb_batch
+TEST_LIST += hsv_to_rgb_batch_cie
+TEST_LIST += hsv_to_rgb_batch_output
+TEST_LIST += rgb_matrix_timeline
+TEST_LIST += rgb_matrix_output
+TEST_LIST += rgb_matrix_output_default
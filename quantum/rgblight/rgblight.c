@@ -25,6 +25,11 @@
 #include "led_tables.h"
 #include <lib/lib8tion/lib8tion.h>
 #include "eeconfig.h"
+#ifdef LED_POWER_ENABLE
+#    include "led_power.h"
+#elif defined(LED_POWER_BUDGET)
+#    error "LED_POWER_BUDGET needs LED_POWER_ENABLE = yes in rules.mk"
+#endif
 
 #ifdef RGBLIGHT_SPLIT
 /* for split keyboard */
@@ -146,8 +151,23 @@ uint8_t rgblight_led_index(uint8_t index) {
 #endif
 }
 
+#ifdef LED_POWER_ENABLE
+// The power budget scale last applied to the LEDs
+static uint16_t rgblight_power_scale = LED_POWER_SCALE_FULL;
+#endif
+
+// Every colour goes to the driver through here, so the power budget sees it
+static void rgblight_driver_set_color(uint8_t led, uint8_t r, uint8_t g, uint8_t b) {
+#ifdef LED_POWER_ENABLE
+    rgb_t rgb = led_power_set_color(LED_POWER_RGBLIGHT_FIRST + led, r, g, b);
+    rgblight_driver.set_color(led, rgb.r, rgb.g, rgb.b);
+#else
+    rgblight_driver.set_color(led, r, g, b);
+#endif
+}
+
 void setrgb(uint8_t r, uint8_t g, uint8_t b, int index) {
-    rgblight_driver.set_color(rgblight_led_index(index), r, g, b);
+    rgblight_driver_set_color(rgblight_led_index(index), r, g, b);
 }
 
 void sethsv_raw(uint8_t hue, uint8_t sat, uint8_t val, int index) {
@@ -628,7 +648,7 @@ void rgblight_setrgb(uint8_t r, uint8_t g, uint8_t b) {
     }
 
     for (uint8_t i = rgblight_ranges.effect_start_pos; i < rgblight_ranges.effect_end_pos; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i), r, g, b);
+        rgblight_driver_set_color(rgblight_led_index(i), r, g, b);
     }
     rgblight_set();
 }
@@ -638,7 +658,7 @@ void rgblight_setrgb_at(uint8_t r, uint8_t g, uint8_t b, uint8_t index) {
         return;
     }
 
-    rgblight_driver.set_color(rgblight_led_index(index), r, g, b);
+    rgblight_driver_set_color(rgblight_led_index(index), r, g, b);
     rgblight_set();
 }
 
@@ -669,7 +689,7 @@ void rgblight_setrgb_range(uint8_t r, uint8_t g, uint8_t b, uint8_t start, uint8
     }
 
     for (uint8_t i = start; i < end; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i), r, g, b);
+        rgblight_driver_set_color(rgblight_led_index(i), r, g, b);
     }
     rgblight_set();
 }
@@ -861,7 +881,7 @@ void rgblight_wakeup(void) {
 void rgblight_set(void) {
     if (!rgblight_config.enable) {
         for (uint8_t i = rgblight_ranges.effect_start_pos; i < rgblight_ranges.effect_end_pos; i++) {
-            rgblight_driver.set_color(rgblight_led_index(i), 0, 0, 0);
+            rgblight_driver_set_color(rgblight_led_index(i), 0, 0, 0);
         }
     }
 
@@ -877,6 +897,18 @@ void rgblight_set(void) {
     }
 #endif
 
+#ifdef LED_POWER_ENABLE
+    // Send every LED again if the scale moved since the last time
+    uint16_t scale = led_power_update();
+    if (scale != rgblight_power_scale) {
+        rgblight_power_scale = scale;
+        for (uint8_t i = 0; i < rgblight_ranges.clipping_num_leds; i++) {
+            rgb_t rgb = led_power_get_color(LED_POWER_RGBLIGHT_FIRST + i);
+            rgblight_driver.set_color(i, rgb.r, rgb.g, rgb.b);
+        }
+    }
+#endif
+
     rgblight_driver.flush();
 }
 
@@ -1198,7 +1230,7 @@ void rgblight_effect_snake(animation_status_t *anim) {
 #    endif
 
     for (i = 0; i < rgblight_ranges.effect_num_leds; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i + rgblight_ranges.effect_start_pos), 0, 0, 0);
+        rgblight_driver_set_color(rgblight_led_index(i + rgblight_ranges.effect_start_pos), 0, 0, 0);
 
         for (j = 0; j < RGBLIGHT_EFFECT_SNAKE_LENGTH; j++) {
             k = pos + j * increment;
@@ -1254,7 +1286,7 @@ void rgblight_effect_knight(animation_status_t *anim) {
 #    endif
     // Set all the LEDs to 0
     for (i = rgblight_ranges.effect_start_pos; i < rgblight_ranges.effect_end_pos; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i), 0, 0, 0);
+        rgblight_driver_set_color(rgblight_led_index(i), 0, 0, 0);
     }
     // Determine which LEDs should be lit up
     for (i = 0; i < RGBLIGHT_EFFECT_KNIGHT_LED_NUM; i++) {
@@ -1263,7 +1295,7 @@ void rgblight_effect_knight(animation_status_t *anim) {
         if (i >= low_bound && i <= high_bound) {
             sethsv(rgblight_config.hue, rgblight_config.sat, rgblight_config.val, cur);
         } else {
-            rgblight_driver.set_color(rgblight_led_index(cur), 0, 0, 0);
+            rgblight_driver_set_color(rgblight_led_index(cur), 0, 0, 0);
         }
     }
     rgblight_set();
@@ -1430,6 +1462,15 @@ void rgblight_task(void) {
     rgblight_timer_task();
 #endif
 
+#ifdef LED_POWER_ENABLE
+    // Follow the scale while it recovers, or when the other lighting feature moved it
+    static uint16_t power_timer = 0;
+    if ((!led_power_settled() || led_power_scale() != rgblight_power_scale) && timer_elapsed(power_timer) >= LED_POWER_UPDATE_INTERVAL) {
+        power_timer = timer_read();
+        rgblight_set();
+    }
+#endif
+
 #ifdef VELOCIKEY_ENABLE
     if (rgblight_velocikey_enabled()) {
         rgblight_velocikey_decelerate();
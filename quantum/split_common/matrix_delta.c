@@ -0,0 +1,65 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "matrix_delta.h"
+#include "crc.h"
+
+static bool matrix_delta_has_row(const matrix_delta_t *delta, uint8_t count, uint8_t row) {
+    for (uint8_t i = 0; i < count; i++) {
+        if (delta->payload.rows[i].row == row) return true;
+    }
+    return false;
+}
+
+void matrix_delta_build(matrix_delta_target_t *target, const matrix_row_t matrix[], uint8_t ack, matrix_delta_t *delta) {
+    // The master only has the rows of a delta once it acknowledged it
+    for (uint8_t i = 0; i < ARRAY_SIZE(target->sent); i++) {
+        const matrix_delta_t *sent = &target->sent[i];
+        if (ack == sent->payload.seq) {
+            for (uint8_t j = 0; j < MATRIX_DELTA_SLOTS; j++) {
+                target->known[sent->payload.rows[j].row] = sent->payload.rows[j].bits;
+            }
+            break;
+        }
+    }
+
+    delta->payload.seq = target->sent[0].payload.seq + 1;
+    uint8_t count      = 0;
+
+    // Rows the master does not have yet go first
+    for (uint8_t row = 0; row < MATRIX_DELTA_HALF_ROWS && count < MATRIX_DELTA_SLOTS; row++) {
+        if (matrix[row] != target->known[row]) {
+            delta->payload.rows[count++] = (matrix_delta_row_t){.row = row, .bits = matrix[row]};
+        }
+    }
+
+    // The rest of the slots send the other rows again in turn
+    for (uint8_t i = 0; i < MATRIX_DELTA_HALF_ROWS && count < MATRIX_DELTA_SLOTS; i++) {
+        uint8_t row     = target->refresh;
+        target->refresh = row + 1 < MATRIX_DELTA_HALF_ROWS ? row + 1 : 0;
+        if (!matrix_delta_has_row(delta, count, row)) {
+            delta->payload.rows[count++] = (matrix_delta_row_t){.row = row, .bits = matrix[row]};
+        }
+    }
+
+    delta->checksum = crc8(&delta->payload, sizeof(delta->payload));
+    target->sent[1] = target->sent[0];
+    target->sent[0] = *delta;
+}
+
+bool matrix_delta_apply(matrix_delta_initiator_t *initiator, const matrix_delta_t *delta) {
+    if (delta->checksum != crc8(&delta->payload, sizeof(delta->payload))) {
+        return false;
+    }
+    for (uint8_t i = 0; i < MATRIX_DELTA_SLOTS; i++) {
+        if (delta->payload.rows[i].row >= MATRIX_DELTA_HALF_ROWS) {
+            return false;
+        }
+    }
+
+    for (uint8_t i = 0; i < MATRIX_DELTA_SLOTS; i++) {
+        initiator->matrix[delta->payload.rows[i].row] = delta->payload.rows[i].bits;
+    }
+    initiator->ack = delta->payload.seq;
+    return true;
+}
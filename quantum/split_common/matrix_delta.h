@@ -0,0 +1,73 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "matrix.h"
+#include "util.h"
+
+/*
+    Sends the slave matrix to the master in one transaction per scan. The
+    master sends the sequence number of the last delta it applied, and the
+    slave answers with the next one: the rows that changed since the master
+    acknowledged them, then as many other rows in turn as fit, so a master
+    that missed anything (or restarted) catches up within a few scans.
+
+    Each row is sent whole, so applying a delta twice or out of turn never
+    leaves the master with a state the slave did not have. The slave keeps
+    the last two deltas, as transports that answer before reading the
+    master's buffer (the AVR bitbang serial) hand it the ack one scan late.
+*/
+
+/* Rows sent to the master per scan. */
+#ifndef SPLIT_MATRIX_DELTA_ROWS
+#    define SPLIT_MATRIX_DELTA_ROWS 2
+#endif
+
+#define MATRIX_DELTA_HALF_ROWS ((MATRIX_ROWS) / 2)
+#define MATRIX_DELTA_SLOTS (SPLIT_MATRIX_DELTA_ROWS < MATRIX_DELTA_HALF_ROWS ? SPLIT_MATRIX_DELTA_ROWS : MATRIX_DELTA_HALF_ROWS)
+
+typedef struct PACKED {
+    uint8_t      row;
+    matrix_row_t bits;
+} matrix_delta_row_t;
+
+typedef struct PACKED {
+    uint8_t checksum;
+    struct PACKED {
+        uint8_t            seq;
+        matrix_delta_row_t rows[MATRIX_DELTA_SLOTS];
+    } payload;
+} matrix_delta_t;
+
+// What the slave keeps between transactions
+typedef struct {
+    matrix_row_t   known[MATRIX_DELTA_HALF_ROWS]; // the master's matrix, as far as the slave knows
+    matrix_delta_t sent[2];                       // the last delta first
+    uint8_t        refresh;                       // next row to send again
+} matrix_delta_target_t;
+
+// What the master keeps between transactions
+typedef struct {
+    matrix_row_t matrix[MATRIX_DELTA_HALF_ROWS];
+    uint8_t      ack; // sequence number of the last delta applied
+} matrix_delta_initiator_t;
+
+/**
+ * @brief Builds the delta the slave answers a transaction with.
+ *
+ * @param target the slave state
+ * @param matrix the current slave matrix
+ * @param ack the sequence number the master sent
+ * @param delta the delta to send back
+ */
+void matrix_delta_build(matrix_delta_target_t *target, const matrix_row_t matrix[], uint8_t ack, matrix_delta_t *delta);
+
+/**
+ * @brief Applies a delta received by the master.
+ *
+ * @return false if the delta is corrupt, in which case nothing was applied
+ */
+bool matrix_delta_apply(matrix_delta_initiator_t *initiator, const matrix_delta_t *delta);
@@ -0,0 +1,201 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "split_blob.h"
+#include "crc.h"
+
+/*
+    Runs of three or more equal bytes are encoded as 0x80 | (length - 2)
+    followed by the byte, anything else as (length - 1) followed by up to
+    128 bytes as they are.
+*/
+#define RLE_MAX_LITERAL 128
+#define RLE_MAX_RUN 129
+
+uint16_t split_blob_encode(const uint8_t *data, uint16_t length, uint8_t *encoded, uint16_t capacity) {
+    uint16_t size = 0;
+
+    for (uint16_t i = 0; i < length;) {
+        uint16_t run = 1;
+        while (i + run < length && run < RLE_MAX_RUN && data[i + run] == data[i]) {
+            run++;
+        }
+
+        if (run >= 3) {
+            if (size + 2 > capacity) return 0;
+            encoded[size++] = 0x80 | (run - 2);
+            encoded[size++] = data[i];
+            i += run;
+            continue;
+        }
+
+        // Bytes up to the next run go as they are
+        uint16_t start = i;
+        while (i < length && i - start < RLE_MAX_LITERAL && !(i + 2 < length && data[i] == data[i + 1] && data[i] == data[i + 2])) {
+            i++;
+        }
+        if (size + 1 + (i - start) > capacity) return 0;
+        encoded[size++] = i - start - 1;
+        memcpy(&encoded[size], &data[start], i - start);
+        size += i - start;
+    }
+    return size;
+}
+
+uint16_t split_blob_decode(const uint8_t *encoded, uint16_t length, uint8_t *data, uint16_t capacity) {
+    uint16_t size = 0;
+
+    for (uint16_t i = 0; i < length;) {
+        uint8_t control = encoded[i++];
+        if (control & 0x80) {
+            uint16_t run = (control & 0x7F) + 2;
+            if (i >= length || size + run > capacity) return 0;
+            memset(&data[size], encoded[i++], run);
+            size += run;
+        } else {
+            uint16_t literal = control + 1;
+            if (i + literal > length || size + literal > capacity) return 0;
+            memcpy(&data[size], &encoded[i], literal);
+            i += literal;
+            size += literal;
+        }
+    }
+    return size;
+}
+
+static uint8_t split_blob_fragments(uint16_t length) {
+    // An empty blob still takes a fragment to announce it
+    return length > 0 ? CEILING(length, SPLIT_BLOB_FRAGMENT_SIZE) : 1;
+}
+
+static uint32_t split_blob_all(uint16_t length) {
+    uint8_t count = split_blob_fragments(length);
+    return count >= 32 ? UINT32_MAX : ((uint32_t)1 << count) - 1;
+}
+
+bool split_blob_start(split_blob_sender_t *sender, uint8_t channel, const void *data, uint16_t length) {
+    if (length > SPLIT_BLOB_MAX_SIZE) {
+        return false;
+    }
+
+    // Only worth decoding on the other side if it saves fragments
+    uint16_t encoded = split_blob_encode(data, length, sender->data, sizeof(sender->data));
+    if (encoded > 0 && split_blob_fragments(encoded) < split_blob_fragments(length)) {
+        sender->length = encoded;
+        sender->flags  = SPLIT_BLOB_ENCODED;
+    } else {
+        memcpy(sender->data, data, length);
+        sender->length = length;
+        sender->flags  = 0;
+    }
+
+    // Sequence number 0 is left to mean no blob at all
+    if (++sender->seq == 0) {
+        sender->seq = 1;
+    }
+    sender->channel       = channel;
+    sender->blob_checksum = crc8(sender->data, sender->length);
+    sender->next          = 0;
+    sender->acked         = 0;
+    return true;
+}
+
+bool split_blob_pending(const split_blob_sender_t *sender) {
+    return sender->seq != 0 && sender->acked != split_blob_all(sender->length);
+}
+
+bool split_blob_next(split_blob_sender_t *sender, split_blob_fragment_t *fragment) {
+    if (!split_blob_pending(sender)) {
+        return false;
+    }
+
+    uint8_t count = split_blob_fragments(sender->length);
+    uint8_t index = sender->next;
+    while (sender->acked & ((uint32_t)1 << index)) {
+        index = (index + 1) % count;
+    }
+    sender->next = (index + 1) % count;
+
+    uint16_t offset = index * SPLIT_BLOB_FRAGMENT_SIZE;
+    memset(fragment, 0, sizeof(*fragment));
+    fragment->payload.seq           = sender->seq;
+    fragment->payload.channel       = sender->channel;
+    fragment->payload.flags         = sender->flags;
+    fragment->payload.blob_checksum = sender->blob_checksum;
+    fragment->payload.length        = sender->length;
+    fragment->payload.index         = index;
+    if (offset < sender->length) {
+        memcpy(fragment->payload.data, &sender->data[offset], MIN(SPLIT_BLOB_FRAGMENT_SIZE, sender->length - offset));
+    }
+    fragment->checksum = crc8(&fragment->payload, sizeof(fragment->payload));
+    return true;
+}
+
+bool split_blob_acknowledge(split_blob_sender_t *sender, const split_blob_ack_t *ack) {
+    if (ack->checksum != crc8(&ack->payload, sizeof(ack->payload)) || ack->payload.seq != sender->seq || ack->payload.blob_checksum != sender->blob_checksum) {
+        return false;
+    }
+    sender->acked |= ack->payload.received & split_blob_all(sender->length);
+    return true;
+}
+
+bool split_blob_receive(split_blob_receiver_t *receiver, const split_blob_fragment_t *fragment, split_blob_ack_t *ack) {
+    bool completed = false;
+
+    if (fragment->checksum == crc8(&fragment->payload, sizeof(fragment->payload)) && fragment->payload.length <= SPLIT_BLOB_MAX_SIZE && fragment->payload.index < split_blob_fragments(fragment->payload.length)) {
+        // A fragment of another blob starts over
+        if (fragment->payload.seq != receiver->seq || fragment->payload.blob_checksum != receiver->blob_checksum || fragment->payload.length != receiver->length || fragment->payload.channel != receiver->channel || fragment->payload.flags != receiver->flags) {
+            receiver->seq           = fragment->payload.seq;
+            receiver->channel       = fragment->payload.channel;
+            receiver->flags         = fragment->payload.flags;
+            receiver->blob_checksum = fragment->payload.blob_checksum;
+            receiver->length        = fragment->payload.length;
+            receiver->received      = 0;
+            receiver->complete      = false;
+        }
+
+        uint32_t bit = (uint32_t)1 << fragment->payload.index;
+        if (!(receiver->received & bit)) {
+            uint16_t offset = fragment->payload.index * SPLIT_BLOB_FRAGMENT_SIZE;
+            if (offset < receiver->length) {
+                memcpy(&receiver->data[offset], fragment->payload.data, MIN(SPLIT_BLOB_FRAGMENT_SIZE, receiver->length - offset));
+            }
+            receiver->received |= bit;
+
+            // Checked whole as well, in case fragments of different blobs looked alike
+            if (receiver->received == split_blob_all(receiver->length)) {
+                receiver->complete = crc8(receiver->data, receiver->length) == receiver->blob_checksum;
+                if (!receiver->complete) {
+                    receiver->received = 0;
+                }
+                completed = receiver->complete;
+            }
+        }
+    }
+
+    ack->payload.seq           = receiver->seq;
+    ack->payload.blob_checksum = receiver->blob_checksum;
+    ack->payload.received      = receiver->received;
+    ack->checksum              = crc8(&ack->payload, sizeof(ack->payload));
+    return completed;
+}
+
+bool split_blob_read(const split_blob_receiver_t *receiver, uint8_t *data, uint16_t capacity, uint16_t *length) {
+    if (!receiver->complete) {
+        return false;
+    }
+
+    if (receiver->flags & SPLIT_BLOB_ENCODED) {
+        *length = split_blob_decode(receiver->data, receiver->length, data, capacity);
+        return *length > 0;
+    }
+
+    if (receiver->length > capacity) {
+        return false;
+    }
+    memcpy(data, receiver->data, receiver->length);
+    *length = receiver->length;
+    return true;
+}
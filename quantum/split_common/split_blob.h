@@ -0,0 +1,141 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "util.h"
+
+/*
+    Moves blobs larger than a single transaction from the master to the
+    slave, enabled with SPLIT_BLOB_ENABLE.
+
+    A blob is run-length encoded when that makes it smaller, and cut into
+    fragments sent one at a time, so no scan waits on more than one. The
+    slave answers each fragment with the set of fragments it holds, and the
+    master sends the ones missing again until it has them all. Fragments
+    carry a crc8 of their own, and the blob's identity, so fragments of an
+    older blob are never mixed in.
+
+    Nothing here depends on how fragments travel, the split transactions
+    only carry them.
+*/
+
+/* Largest blob, before encoding. */
+#ifndef SPLIT_BLOB_MAX_SIZE
+#    define SPLIT_BLOB_MAX_SIZE 128
+#endif
+
+/* Bytes of the blob each fragment carries. */
+#ifndef SPLIT_BLOB_FRAGMENT_SIZE
+#    define SPLIT_BLOB_FRAGMENT_SIZE 24
+#endif
+
+#define SPLIT_BLOB_MAX_FRAGMENTS CEILING(SPLIT_BLOB_MAX_SIZE, SPLIT_BLOB_FRAGMENT_SIZE)
+#if SPLIT_BLOB_MAX_FRAGMENTS > 32
+#    error "SPLIT_BLOB_MAX_SIZE is limited to 32 fragments, raise SPLIT_BLOB_FRAGMENT_SIZE"
+#endif
+
+#define SPLIT_BLOB_ENCODED 0x01
+
+typedef struct PACKED {
+    struct PACKED {
+        uint8_t  seq;           // tells blobs apart
+        uint8_t  channel;       // what the blob is, for the receiving side
+        uint8_t  flags;
+        uint8_t  blob_checksum; // crc8 of the whole blob as sent
+        uint16_t length;        // of the blob as sent
+        uint8_t  index;
+        uint8_t  data[SPLIT_BLOB_FRAGMENT_SIZE];
+    } payload;
+    uint8_t checksum;
+} split_blob_fragment_t;
+
+typedef struct PACKED {
+    struct PACKED {
+        uint8_t  seq;
+        uint8_t  blob_checksum;
+        uint32_t received; // bit per fragment held
+    } payload;
+    uint8_t checksum;
+} split_blob_ack_t;
+
+// What the sending side keeps while a blob is in flight
+typedef struct {
+    uint8_t  data[SPLIT_BLOB_MAX_SIZE];
+    uint16_t length;
+    uint8_t  seq;
+    uint8_t  channel;
+    uint8_t  flags;
+    uint8_t  blob_checksum;
+    uint8_t  next;  // fragment to consider sending next
+    uint32_t acked; // fragments the receiving side holds
+} split_blob_sender_t;
+
+// What the receiving side keeps while a blob comes in
+typedef struct {
+    uint8_t  data[SPLIT_BLOB_MAX_SIZE];
+    uint16_t length;
+    uint8_t  seq;
+    uint8_t  channel;
+    uint8_t  flags;
+    uint8_t  blob_checksum;
+    uint32_t received;
+    bool     complete;
+} split_blob_receiver_t;
+
+/**
+ * @brief Run-length encodes data.
+ *
+ * @return the encoded length, or 0 if it does not fit in capacity
+ */
+uint16_t split_blob_encode(const uint8_t *data, uint16_t length, uint8_t *encoded, uint16_t capacity);
+
+/**
+ * @brief Decodes run-length encoded data.
+ *
+ * @return the decoded length, or 0 if the data is malformed or does not fit in capacity
+ */
+uint16_t split_blob_decode(const uint8_t *encoded, uint16_t length, uint8_t *data, uint16_t capacity);
+
+/**
+ * @brief Starts sending a blob, replacing any still in flight.
+ *
+ * @return false if the blob is larger than SPLIT_BLOB_MAX_SIZE
+ */
+bool split_blob_start(split_blob_sender_t *sender, uint8_t channel, const void *data, uint16_t length);
+
+/**
+ * @brief Whether the receiving side still misses part of the blob.
+ */
+bool split_blob_pending(const split_blob_sender_t *sender);
+
+/**
+ * @brief Fills in the next fragment to send, going round the ones not acknowledged yet.
+ *
+ * @return false if nothing is left to send
+ */
+bool split_blob_next(split_blob_sender_t *sender, split_blob_fragment_t *fragment);
+
+/**
+ * @brief Takes in the receiving side's answer to a fragment.
+ *
+ * @return false if the answer is corrupt or about another blob
+ */
+bool split_blob_acknowledge(split_blob_sender_t *sender, const split_blob_ack_t *ack);
+
+/**
+ * @brief Takes in a fragment, and fills in the answer for the sending side.
+ *
+ * @return true once the blob just completed
+ */
+bool split_blob_receive(split_blob_receiver_t *receiver, const split_blob_fragment_t *fragment, split_blob_ack_t *ack);
+
+/**
+ * @brief Hands out a completed blob, decoded.
+ *
+ * @param length filled in with the length of the blob
+ * @return false if the blob is not complete, or could not be decoded into capacity
+ */
+bool split_blob_read(const split_blob_receiver_t *receiver, uint8_t *data, uint16_t capacity, uint16_t *length);
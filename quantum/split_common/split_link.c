@@ -0,0 +1,183 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "split_link.h"
+#include "transport.h"
+#include "transaction_id_define.h"
+#include "util.h"
+
+#if defined(SPLIT_LINK_STATS_ENABLE) || defined(SPLIT_LINK_BACKOFF)
+
+#    ifdef SPLIT_LINK_STATS_ENABLE
+#        include "print.h"
+#        include "timer.h"
+#        include "profiling.h"
+
+static split_link_stats_t link_stats[NUM_TOTAL_TRANSACTIONS];
+
+static void saturating_increment(uint16_t *counter) {
+    if (*counter < UINT16_MAX) {
+        (*counter)++;
+    }
+}
+
+static void stats_record(int8_t id, bool okay, uint32_t bytes, uint32_t rtt_us) {
+    split_link_stats_t *stats = &link_stats[id];
+
+    saturating_increment(&stats->attempts);
+    if (!okay) {
+        saturating_increment(&stats->timeouts);
+        return;
+    }
+    stats->bytes = bytes > UINT32_MAX - stats->bytes ? UINT32_MAX : stats->bytes + bytes;
+
+    uint8_t  bucket = 0;
+    uint32_t bound  = SPLIT_LINK_RTT_BASE_US;
+    while (bucket < SPLIT_LINK_RTT_BUCKETS - 1 && rtt_us >= bound) {
+        bucket++;
+        bound <<= 1;
+    }
+    saturating_increment(&stats->rtt[bucket]);
+}
+
+const split_link_stats_t *split_link_get_stats(int8_t id) {
+    return id >= 0 && id < NUM_TOTAL_TRANSACTIONS ? &link_stats[id] : NULL;
+}
+
+void split_link_dump(void) {
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        const split_link_stats_t *stats = &link_stats[id];
+        if (stats->attempts == 0) {
+            continue;
+        }
+        uprintf("split %d: n=%u timeouts=%u crc=%u bytes=%lu rtt=", id, stats->attempts, stats->timeouts, stats->crc_errors, (unsigned long)stats->bytes);
+        for (uint8_t b = 0; b < SPLIT_LINK_RTT_BUCKETS; b++) {
+            uprintf(b ? ",%u" : "%u", stats->rtt[b]);
+        }
+        uprintf("\n");
+    }
+#        ifdef SPLIT_LINK_BACKOFF
+    uprintf("split backoff: %s\n", split_link_backing_off() ? "on" : "off");
+#        endif
+}
+
+static uint8_t *write_u32(uint8_t *dst, uint32_t value) {
+    for (uint8_t i = 0; i < 4; i++) {
+        *dst++ = value >> (8 * i);
+    }
+    return dst;
+}
+
+bool split_link_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 20 || data[0] != SPLIT_LINK_RAW_HID_COMMAND) {
+        return false;
+    }
+
+    const split_link_stats_t *stats = split_link_get_stats((int8_t)data[1]);
+    memset(data + 2, 0, length - 2);
+    data[2] = NUM_TOTAL_TRANSACTIONS;
+    data[3] = SPLIT_LINK_RTT_BUCKETS;
+    if (stats == NULL) {
+        return true;
+    }
+
+    uint8_t *dst = write_u32(data + 4, stats->attempts);
+    dst          = write_u32(dst, stats->timeouts);
+    dst          = write_u32(dst, stats->crc_errors);
+    dst          = write_u32(dst, stats->bytes);
+    for (uint8_t b = 0; b < SPLIT_LINK_RTT_BUCKETS && dst + 2 <= data + length; b++) {
+        *dst++ = stats->rtt[b];
+        *dst++ = stats->rtt[b] >> 8;
+    }
+    return true;
+}
+
+void split_link_task(void) {
+#        ifdef SPLIT_LINK_DUMP_INTERVAL
+    static uint32_t last_dump = 0;
+    if (timer_elapsed32(last_dump) >= SPLIT_LINK_DUMP_INTERVAL) {
+        last_dump = timer_read32();
+        split_link_dump();
+    }
+#        endif
+}
+#    endif // SPLIT_LINK_STATS_ENABLE
+
+#    ifdef SPLIT_LINK_BACKOFF
+static uint8_t backoff_score    = 0;
+static uint8_t backoff_interval = 1; // scans between two sends
+static uint8_t backoff_wait     = 0; // scans left until the next send
+
+static void backoff_record(bool okay) {
+    if (okay) {
+        if (backoff_score > 0) {
+            backoff_score--;
+        }
+    } else {
+        backoff_score = MIN(backoff_score + SPLIT_LINK_BACKOFF_PENALTY, SPLIT_LINK_BACKOFF_MAX_SCORE);
+    }
+}
+
+bool split_link_backing_off(void) {
+    return backoff_score >= SPLIT_LINK_BACKOFF_THRESHOLD;
+}
+
+bool split_link_backoff_due(void) {
+    if (!split_link_backing_off()) {
+        backoff_interval = 1;
+        backoff_wait     = 0;
+        return true;
+    }
+    if (backoff_wait > 0) {
+        backoff_wait--;
+        return false;
+    }
+
+    // Every send that finds the link still backed off waits twice as long for the next
+    backoff_interval = MIN(backoff_interval * 2, SPLIT_LINK_BACKOFF_MAX_INTERVAL);
+    backoff_wait     = backoff_interval - 1;
+    return true;
+}
+#    endif // SPLIT_LINK_BACKOFF
+
+bool split_link_exchange(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+#    ifdef SPLIT_LINK_STATS_ENABLE
+    uint32_t start = profile_timestamp();
+#    endif
+    bool okay = transport_exchange(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+#    ifdef SPLIT_LINK_STATS_ENABLE
+    if (id >= 0 && id < NUM_TOTAL_TRANSACTIONS) {
+        stats_record(id, okay, (uint32_t)initiator2target_length + target2initiator_length, profile_ticks_to_us(profile_timestamp() - start));
+    }
+#    endif
+#    ifdef SPLIT_LINK_BACKOFF
+    backoff_record(okay);
+#    endif
+    return okay;
+}
+
+void split_link_crc_error(int8_t id) {
+#    ifdef SPLIT_LINK_STATS_ENABLE
+    if (id >= 0 && id < NUM_TOTAL_TRANSACTIONS) {
+        saturating_increment(&link_stats[id].crc_errors);
+    }
+#    endif
+#    ifdef SPLIT_LINK_BACKOFF
+    backoff_record(false);
+#    endif
+}
+
+void split_link_reset(void) {
+#    ifdef SPLIT_LINK_STATS_ENABLE
+    memset(link_stats, 0, sizeof(link_stats));
+#    endif
+#    ifdef SPLIT_LINK_BACKOFF
+    backoff_score    = 0;
+    backoff_interval = 1;
+    backoff_wait     = 0;
+#    endif
+}
+
+#endif // defined(SPLIT_LINK_STATS_ENABLE) || defined(SPLIT_LINK_BACKOFF)
@@ -0,0 +1,126 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Keeps an eye on the quality of the split link, for every exchange the
+    master starts over the transport.
+
+    SPLIT_LINK_STATS_ENABLE counts, per transaction, the exchanges started,
+    those the transport gave up on (no answer, or a garbled handshake),
+    those whose answer failed its checksum, the bytes moved and a histogram
+    of round trip times. They can be printed over console or read over Raw
+    HID, to tell how a cable holds up at a given baud rate.
+
+    SPLIT_LINK_BACKOFF keeps a score that rises with every failure and
+    decays with every success. While it is high, transactions that only
+    keep the slave's displays and lights up to date are sent on fewer and
+    fewer scans, with a single attempt each, so the matrix keeps what the
+    link can still carry.
+*/
+
+/* Number of round trip time histogram buckets per transaction. */
+#ifndef SPLIT_LINK_RTT_BUCKETS
+#    define SPLIT_LINK_RTT_BUCKETS 8
+#endif
+
+/* Upper bound of the first round trip time bucket, in microseconds, each following bucket doubles it. */
+#ifndef SPLIT_LINK_RTT_BASE_US
+#    define SPLIT_LINK_RTT_BASE_US 64
+#endif
+
+#ifndef SPLIT_LINK_RAW_HID_COMMAND
+#    define SPLIT_LINK_RAW_HID_COMMAND 0x51
+#endif
+
+/* Score at which the link is backed off. */
+#ifndef SPLIT_LINK_BACKOFF_THRESHOLD
+#    define SPLIT_LINK_BACKOFF_THRESHOLD 16
+#endif
+
+/* Score a failure adds, each success takes one off. */
+#ifndef SPLIT_LINK_BACKOFF_PENALTY
+#    define SPLIT_LINK_BACKOFF_PENALTY 4
+#endif
+
+/* Most scans between two sends of a backed off transaction. */
+#ifndef SPLIT_LINK_BACKOFF_MAX_INTERVAL
+#    define SPLIT_LINK_BACKOFF_MAX_INTERVAL 64
+#endif
+
+// Caps the score, so the link recovers soon after a burst of errors ends
+#define SPLIT_LINK_BACKOFF_MAX_SCORE (SPLIT_LINK_BACKOFF_THRESHOLD * 2)
+
+#if SPLIT_LINK_BACKOFF_MAX_SCORE > 255
+#    error "SPLIT_LINK_BACKOFF_THRESHOLD is limited to 127"
+#endif
+
+/**
+ * @brief Statistics of a single transaction. Counters saturate instead of wrapping.
+ *
+ * Histogram bucket 0 counts round trips shorter than SPLIT_LINK_RTT_BASE_US,
+ * every following bucket doubles the upper bound, and the last bucket counts
+ * everything longer. Only exchanges that went through are timed.
+ */
+typedef struct {
+    uint16_t attempts;
+    uint16_t timeouts;   // exchanges the transport gave up on
+    uint16_t crc_errors; // exchanges whose answer failed its checksum
+    uint32_t bytes;      // sent and received
+    uint16_t rtt[SPLIT_LINK_RTT_BUCKETS];
+} split_link_stats_t;
+
+/**
+ * @brief Runs an exchange over the transport, and records how it went.
+ *
+ * Called by transport_execute_transaction() when either feature is enabled,
+ * calls transport_exchange() to do the work.
+ */
+bool split_link_exchange(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length);
+
+#if defined(SPLIT_LINK_STATS_ENABLE) || defined(SPLIT_LINK_BACKOFF)
+/**
+ * @brief Records an exchange that went through, but whose answer failed its checksum.
+ */
+void split_link_crc_error(int8_t id);
+#else
+#    define split_link_crc_error(id)
+#endif
+
+/** @return the statistics of transaction `id`, or NULL if out of range */
+const split_link_stats_t *split_link_get_stats(int8_t id);
+
+/** @brief Clears the statistics of all transactions, and the backoff. */
+void split_link_reset(void);
+
+/** @brief Prints the statistics of all transactions started so far over console. */
+void split_link_dump(void);
+
+/**
+ * @brief Answers a raw HID split link request in place.
+ *
+ * Requests are `SPLIT_LINK_RAW_HID_COMMAND, id`. The reply overwrites `data` with
+ * `SPLIT_LINK_RAW_HID_COMMAND, id, NUM_TOTAL_TRANSACTIONS, SPLIT_LINK_RTT_BUCKETS`
+ * followed by attempts, timeouts, CRC errors and bytes as little-endian uint32_t,
+ * and as many little-endian uint16_t histogram buckets as fit.
+ *
+ * @return true if `data` was a split link request
+ */
+bool split_link_raw_hid_receive(uint8_t *data, uint8_t length);
+
+/** @brief Prints split_link_dump() every SPLIT_LINK_DUMP_INTERVAL ms, if defined. */
+void split_link_task(void);
+
+/**
+ * @brief Whether backed off transactions are sent on this scan, called once per scan.
+ */
+bool split_link_backoff_due(void);
+
+/**
+ * @brief Whether the link is backed off.
+ */
+bool split_link_backing_off(void);
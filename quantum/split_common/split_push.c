@@ -0,0 +1,81 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "split_push.h"
+#include "timer.h"
+#include "crc.h"
+
+void split_push_build(split_push_target_t *target, uint8_t row, matrix_row_t bits, uint16_t time, split_push_packet_t *packet) {
+    packet->marker       = SPLIT_PUSH_MARKER;
+    packet->payload.seq  = target->seq++;
+    packet->payload.row  = row;
+    packet->payload.bits = bits;
+    packet->payload.time = time;
+    packet->checksum     = crc8(&packet->payload, sizeof(packet->payload));
+}
+
+bool split_push_apply(split_push_initiator_t *initiator, matrix_row_t matrix[], const split_push_packet_t *packet) {
+    if (packet->marker != SPLIT_PUSH_MARKER || packet->checksum != crc8(&packet->payload, sizeof(packet->payload)) || packet->payload.row >= MATRIX_DELTA_HALF_ROWS) {
+        initiator->resync = SPLIT_PUSH_RESYNC_POLLS;
+        return false;
+    }
+
+    // A gap means a row may have changed without the master hearing of it
+    if (packet->payload.seq != initiator->seq) {
+        initiator->resync = SPLIT_PUSH_RESYNC_POLLS;
+    }
+    initiator->seq = packet->payload.seq + 1;
+
+    matrix[packet->payload.row]          = packet->payload.bits;
+    initiator->time[packet->payload.row] = packet->payload.time;
+    return true;
+}
+
+bool split_push_poll_due(const split_push_initiator_t *initiator, uint16_t now) {
+    return initiator->resync > 0 || TIMER_DIFF_16(now, initiator->polled) >= SPLIT_PUSH_RESYNC_INTERVAL;
+}
+
+void split_push_polled(split_push_initiator_t *initiator, const matrix_row_t before[], const matrix_row_t after[], uint16_t now) {
+    // Rows the poll changed were missed, the master only knows about them now
+    for (uint8_t row = 0; row < MATRIX_DELTA_HALF_ROWS; row++) {
+        if (before[row] != after[row]) {
+            initiator->time[row] = now;
+        }
+    }
+    if (initiator->resync > 0) {
+        initiator->resync--;
+    }
+    initiator->polled = now;
+}
+
+uint16_t split_push_event_time(split_push_initiator_t *initiator, uint8_t row, uint16_t now) {
+    uint16_t time = now;
+    // A time ahead of the master's wraps around to a large age, and is dropped as well
+    if (row < MATRIX_DELTA_HALF_ROWS && TIMER_DIFF_16(now, initiator->time[row]) <= SPLIT_PUSH_MAX_AGE) {
+        time = initiator->time[row];
+    }
+    if (TIMER_DIFF_16(now, time) > TIMER_DIFF_16(now, initiator->last_event)) {
+        time = initiator->last_event;
+    }
+    initiator->last_event = time;
+    return time;
+}
+
+bool split_push_enqueue(split_push_queue_t *queue, const split_push_packet_t *packet) {
+    if (queue->count >= ARRAY_SIZE(queue->packets)) {
+        return false;
+    }
+    queue->packets[(queue->head + queue->count) % ARRAY_SIZE(queue->packets)] = *packet;
+    queue->count++;
+    return true;
+}
+
+bool split_push_dequeue(split_push_queue_t *queue, split_push_packet_t *packet) {
+    if (queue->count == 0) {
+        return false;
+    }
+    *packet     = queue->packets[queue->head];
+    queue->head = (queue->head + 1) % ARRAY_SIZE(queue->packets);
+    queue->count--;
+    return true;
+}
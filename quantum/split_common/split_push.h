@@ -0,0 +1,127 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "matrix.h"
+#include "matrix_delta.h"
+#include "util.h"
+
+/*
+    Lets the slave send rows of its matrix as soon as debounce changes them,
+    on transports that can talk back on their own (full-duplex USART),
+    enabled with SPLIT_TRANSPORT_PUSH.
+
+    Each packet carries a whole row, a sequence number and the sync_timer
+    time the row changed at. The slave sends it before the row reaches the
+    shared memory, so anything it answers the master with afterwards is at
+    least as new, and the master only has to apply packets in the order they
+    arrived, after any matrix delta that came in the same exchange.
+
+    The master still polls the matrix delta every SPLIT_PUSH_RESYNC_INTERVAL,
+    and on every scan for a while after a packet went missing or arrived
+    corrupt.
+*/
+
+/* How often the master polls the slave matrix, in milliseconds, when nothing went missing. */
+#ifndef SPLIT_PUSH_RESYNC_INTERVAL
+#    define SPLIT_PUSH_RESYNC_INTERVAL 100
+#endif
+
+/* Key events older than this, in milliseconds, are timed when the master sees them instead. */
+#ifndef SPLIT_PUSH_MAX_AGE
+#    define SPLIT_PUSH_MAX_AGE 50
+#endif
+
+/* Packets the master holds between scans. */
+#ifndef SPLIT_PUSH_QUEUE_SIZE
+#    define SPLIT_PUSH_QUEUE_SIZE 8
+#endif
+
+// Starts every packet, and is never a transaction handshake
+#define SPLIT_PUSH_MARKER 0xA5
+
+// Scans the master polls for after a packet went missing, enough for the rolling refresh to cover the matrix
+#define SPLIT_PUSH_RESYNC_POLLS MATRIX_DELTA_HALF_ROWS
+
+typedef struct PACKED {
+    uint8_t marker;
+    struct PACKED {
+        uint8_t      seq;
+        uint8_t      row;
+        matrix_row_t bits;
+        uint16_t     time;
+    } payload;
+    uint8_t checksum;
+} split_push_packet_t;
+
+// What the slave keeps between packets
+typedef struct {
+    uint8_t seq;
+} split_push_target_t;
+
+// What the master keeps between packets
+typedef struct {
+    uint16_t time[MATRIX_DELTA_HALF_ROWS]; // when each row last changed, on the master's clock
+    uint16_t polled;                       // when the matrix was last polled
+    uint16_t last_event;                   // time of the last key event handed out
+    uint8_t  seq;                          // sequence number of the next packet
+    uint8_t  resync;                       // scans left to poll the matrix on
+} split_push_initiator_t;
+
+typedef struct {
+    split_push_packet_t packets[SPLIT_PUSH_QUEUE_SIZE];
+    uint8_t             head;
+    uint8_t             count;
+} split_push_queue_t;
+
+/**
+ * @brief Builds the packet the slave sends for a row that changed.
+ *
+ * @param target the slave state
+ * @param row the row of the slave matrix
+ * @param bits the new state of the row
+ * @param time sync_timer time of the change
+ * @param packet the packet to send
+ */
+void split_push_build(split_push_target_t *target, uint8_t row, matrix_row_t bits, uint16_t time, split_push_packet_t *packet);
+
+/**
+ * @brief Applies a packet received by the master to its copy of the slave matrix.
+ *
+ * @return false if the packet is corrupt, in which case nothing was applied
+ */
+bool split_push_apply(split_push_initiator_t *initiator, matrix_row_t matrix[], const split_push_packet_t *packet);
+
+/**
+ * @brief Whether the master should poll the slave matrix on this scan.
+ */
+bool split_push_poll_due(const split_push_initiator_t *initiator, uint16_t now);
+
+/**
+ * @brief Records a successful poll, which changed the matrix from before to after.
+ */
+void split_push_polled(split_push_initiator_t *initiator, const matrix_row_t before[], const matrix_row_t after[], uint16_t now);
+
+/**
+ * @brief Returns the time of a key event on a row, for the master.
+ *
+ * Times never go backwards from one event to the next, so tapping decisions
+ * see events in the order they are handed out.
+ *
+ * @param row the row of the slave matrix, or MATRIX_DELTA_HALF_ROWS for a key on the master
+ * @param now the master's time
+ */
+uint16_t split_push_event_time(split_push_initiator_t *initiator, uint8_t row, uint16_t now);
+
+/**
+ * @brief Queues a packet the master received, false if the queue is full.
+ */
+bool split_push_enqueue(split_push_queue_t *queue, const split_push_packet_t *packet);
+
+/**
+ * @brief Takes the oldest queued packet, false if there is none.
+ */
+bool split_push_dequeue(split_push_queue_t *queue, split_push_packet_t *packet);
@@ -0,0 +1,22 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/* Just enough of ChibiOS to build serial_protocol.c for the split_push suite,
+ * which runs its slave thread as a host thread. */
+
+#include <stddef.h>
+
+#define likely(x) __builtin_expect(!!(x), 1)
+#define unlikely(x) __builtin_expect(!!(x), 0)
+
+#define HIGHPRIO 0
+
+#define THD_WORKING_AREA(s, n) char s[n]
+#define THD_FUNCTION(tname, arg) void tname(void *arg)
+
+typedef void (*tfunc_t)(void *arg);
+
+void  chRegSetThreadName(const char *name);
+void *chThdCreateStatic(void *wsp, size_t size, int prio, tfunc_t pf, void *arg);
@@ -0,0 +1,159 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix_delta.h"
+#include "crc.h"
+}
+
+/* Both halves joined by a loopback transport: the master sends its ack, the
+ * slave answers with a delta, and either direction can be lost or corrupted. */
+class MatrixDelta : public ::testing::Test {
+   protected:
+    matrix_row_t             slave[MATRIX_DELTA_HALF_ROWS] = {0};
+    matrix_delta_target_t    target                        = {};
+    matrix_delta_initiator_t initiator                     = {};
+
+    enum fault_t { NONE, DROP_REQUEST, DROP_RESPONSE, CORRUPT_RESPONSE };
+
+    bool exchange(fault_t fault = NONE) {
+        uint8_t ack = initiator.ack;
+        if (fault == DROP_REQUEST) return false;
+
+        matrix_delta_t delta;
+        matrix_delta_build(&target, slave, ack, &delta);
+        if (fault == DROP_RESPONSE) return false;
+        if (fault == CORRUPT_RESPONSE) delta.payload.rows[0].bits ^= 0x04;
+
+        return matrix_delta_apply(&initiator, &delta);
+    }
+
+    // The slave answers before it reads the ack, as the AVR bitbang serial does
+    uint8_t late_ack = 0;
+
+    bool exchange_late_ack(void) {
+        matrix_delta_t delta;
+        matrix_delta_build(&target, slave, late_ack, &delta);
+        late_ack = initiator.ack;
+        return matrix_delta_apply(&initiator, &delta);
+    }
+
+    bool in_sync(void) {
+        return memcmp(initiator.matrix, slave, sizeof(slave)) == 0;
+    }
+};
+
+TEST_F(MatrixDelta, ChangeArrivesInOneExchange) {
+    slave[3] = 0x21;
+    EXPECT_TRUE(exchange());
+    EXPECT_TRUE(in_sync());
+}
+
+TEST_F(MatrixDelta, ChangedRowsGoFirst) {
+    slave[4] = 0x01;
+    slave[1] = 0x02;
+
+    matrix_delta_t delta;
+    matrix_delta_build(&target, slave, initiator.ack, &delta);
+    EXPECT_EQ(delta.payload.rows[0].row, 1);
+    EXPECT_EQ(delta.payload.rows[1].row, 4);
+}
+
+TEST_F(MatrixDelta, MoreChangesThanSlotsTakeSeveralExchanges) {
+    for (uint8_t row = 0; row < MATRIX_DELTA_HALF_ROWS; row++) {
+        slave[row] = row + 1;
+    }
+    int exchanges = 0;
+    while (!in_sync()) {
+        ASSERT_TRUE(exchange());
+        ASSERT_LE(++exchanges, (MATRIX_DELTA_HALF_ROWS + MATRIX_DELTA_SLOTS - 1) / MATRIX_DELTA_SLOTS);
+    }
+}
+
+TEST_F(MatrixDelta, LostResponseIsSentAgain) {
+    slave[2] = 0x10;
+    EXPECT_FALSE(exchange(DROP_RESPONSE));
+    EXPECT_FALSE(in_sync());
+    EXPECT_TRUE(exchange());
+    EXPECT_TRUE(in_sync());
+}
+
+TEST_F(MatrixDelta, LostAckIsHarmless) {
+    slave[2] = 0x10;
+    EXPECT_TRUE(exchange());
+    slave[0] = 0x01;
+    EXPECT_FALSE(exchange(DROP_REQUEST));
+    EXPECT_TRUE(exchange());
+    EXPECT_TRUE(in_sync());
+}
+
+TEST_F(MatrixDelta, CorruptResponseIsRejected) {
+    slave[1] = 0x08;
+    matrix_row_t before[MATRIX_DELTA_HALF_ROWS];
+    memcpy(before, initiator.matrix, sizeof(before));
+
+    EXPECT_FALSE(exchange(CORRUPT_RESPONSE));
+    EXPECT_EQ(memcmp(before, initiator.matrix, sizeof(before)), 0);
+    EXPECT_TRUE(exchange());
+    EXPECT_TRUE(in_sync());
+}
+
+TEST_F(MatrixDelta, OutOfRangeRowIsRejected) {
+    matrix_delta_t delta;
+    matrix_delta_build(&target, slave, initiator.ack, &delta);
+    delta.payload.rows[0].row = MATRIX_DELTA_HALF_ROWS;
+    delta.checksum            = crc8(&delta.payload, sizeof(delta.payload));
+    EXPECT_FALSE(matrix_delta_apply(&initiator, &delta));
+}
+
+TEST_F(MatrixDelta, RestartedMasterResyncs) {
+    slave[0] = 0x01;
+    slave[3] = 0x08;
+    slave[4] = 0x10;
+    while (!in_sync()) {
+        ASSERT_TRUE(exchange());
+    }
+
+    // The master starts over with nothing, and the slave sees nothing changed
+    initiator = {};
+    for (int i = 0; i < (MATRIX_DELTA_HALF_ROWS + MATRIX_DELTA_SLOTS - 1) / MATRIX_DELTA_SLOTS + 1; i++) {
+        EXPECT_TRUE(exchange());
+    }
+    EXPECT_TRUE(in_sync());
+}
+
+TEST_F(MatrixDelta, StaysInSyncOverALossyLink) {
+    uint32_t seed = 1;
+    auto     next = [&seed]() {
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 16) & 0x7FFF;
+    };
+
+    for (int scan = 0; scan < 2000; scan++) {
+        if (next() % 4 == 0) {
+            slave[next() % MATRIX_DELTA_HALF_ROWS] ^= 1 << (next() % MATRIX_COLS);
+        }
+        exchange((fault_t)(next() % 8 < 4 ? NONE : next() % 4));
+    }
+
+    // Once the link is clean again the master catches up
+    for (int i = 0; i < MATRIX_DELTA_HALF_ROWS; i++) {
+        exchange();
+    }
+    EXPECT_TRUE(in_sync());
+}
+
+TEST_F(MatrixDelta, LateAckStillSettles) {
+    slave[1] = 0x02;
+    slave[2] = 0x04;
+    for (int i = 0; i < 4; i++) {
+        EXPECT_TRUE(exchange_late_ack());
+    }
+    EXPECT_TRUE(in_sync());
+
+    // The slave learnt what the master has, so the rows are no longer sent as changes
+    EXPECT_EQ(memcmp(target.known, slave, sizeof(slave)), 0);
+}
@@ -0,0 +1,65 @@
+matrix_delta_DEFS := -DMATRIX_ROWS=10 -DMATRIX_COLS=6
+matrix_delta_INC := $(QUANTUM_PATH)/split_common
+
+matrix_delta_SRC := \
+	$(QUANTUM_PATH)/split_common/tests/matrix_delta_tests.cpp \
+	$(QUANTUM_PATH)/split_common/matrix_delta.c \
+	$(QUANTUM_PATH)/crc.c
+
+split_push_DEFS := -DMATRIX_ROWS=10 -DMATRIX_COLS=6 -DSPLIT_KEYBOARD -DSPLIT_TRANSPORT_PUSH -DPLATFORM_SUPPORTS_SYNCHRONIZATION
+split_push_INC := $(QUANTUM_PATH)/split_common $(QUANTUM_PATH)/split_common/tests $(PLATFORM_PATH)/chibios/drivers
+
+split_push_SRC := \
+	$(QUANTUM_PATH)/split_common/tests/split_push_tests.cpp \
+	$(QUANTUM_PATH)/split_common/split_push.c \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/transport.c \
+	$(QUANTUM_PATH)/split_common/matrix_delta.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(PLATFORM_PATH)/chibios/drivers/serial_protocol.c \
+	$(PLATFORM_PATH)/synchronization_util.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+transport_batch_DEFS := -DMATRIX_ROWS=10 -DMATRIX_COLS=6 -DSPLIT_TRANSPORT_BATCH -DSPLIT_TRANSPORT_BATCH_SIZE=16 -DSPLIT_TRANSACTION_IDS_USER=USER_PUT,USER_PUT2,USER_PUT3,USER_GET,USER_BIG
+transport_batch_INC := $(QUANTUM_PATH)/split_common
+
+transport_batch_SRC := \
+	$(QUANTUM_PATH)/split_common/tests/transport_batch_tests.cpp \
+	$(QUANTUM_PATH)/split_common/transport_batch.c \
+	$(QUANTUM_PATH)/crc.c
+
+split_blob_DEFS := -DMATRIX_ROWS=10 -DMATRIX_COLS=6
+split_blob_INC := $(QUANTUM_PATH)/split_common
+
+split_blob_SRC := \
+	$(QUANTUM_PATH)/split_common/tests/split_blob_tests.cpp \
+	$(QUANTUM_PATH)/split_common/split_blob.c \
+	$(QUANTUM_PATH)/crc.c
+
+split_link_DEFS := -DMATRIX_ROWS=10 -DMATRIX_COLS=6 -DSPLIT_KEYBOARD -DSPLIT_LINK_STATS_ENABLE -DSPLIT_LINK_BACKOFF -DWPM_ENABLE -DSPLIT_WPM_ENABLE -DDISABLE_SYNC_TIMER -DSPLIT_TRANSACTION_IDS_USER=USER_OLED
+split_link_INC := $(QUANTUM_PATH)/split_common
+
+split_link_SRC := \
+	$(QUANTUM_PATH)/split_common/tests/split_link_tests.cpp \
+	$(QUANTUM_PATH)/split_common/split_link.c \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/transport.c \
+	$(QUANTUM_PATH)/split_common/matrix_delta.c \
+	$(QUANTUM_PATH)/profiling.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+split_batch_DEFS := -DMATRIX_ROWS=10 -DMATRIX_COLS=6 -DSPLIT_KEYBOARD -DSPLIT_TRANSPORT_BATCH -DENCODER_ENABLE -DNUM_ENCODERS_LEFT=1 -DNUM_ENCODERS_RIGHT=1 -DDISABLE_SYNC_TIMER
+split_batch_INC := $(QUANTUM_PATH)/split_common
+
+split_batch_SRC := \
+	$(QUANTUM_PATH)/split_common/tests/split_batch_tests.cpp \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/transport.c \
+	$(QUANTUM_PATH)/split_common/transport_batch.c \
+	$(QUANTUM_PATH)/split_common/matrix_delta.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
@@ -0,0 +1,124 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <functional>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "transactions.h"
+#include "transport.h"
+#include "transaction_id_define.h"
+#include "encoder.h"
+#include "serial.h"
+}
+
+/* A stub serial driver, looping transactions back to the slave side. The
+ * test picks transactions to fail, whether they are sent on their own or
+ * inside a batch frame. */
+static struct {
+    std::function<bool(int8_t id)> fails;
+    int                             transactions;
+    uint32_t                        bytes;
+} wire;
+
+static bool wire_fails(int8_t id) {
+    if (!wire.fails) return false;
+    if (id != EXCHANGE_BATCH) return wire.fails(id);
+
+    const split_batch_frame_t *frame = &split_shmem->batch.request;
+    for (uint16_t offset = 0; offset < frame->length;) {
+        const split_batch_record_t *record = (const split_batch_record_t *)&frame->data[offset];
+        if (wire.fails(record->id)) return true;
+        offset += sizeof(*record) + record->initiator2target_length;
+    }
+    return false;
+}
+
+extern "C" {
+void soft_serial_initiator_init(void) {}
+void soft_serial_target_init(void) {}
+
+bool soft_serial_transaction(int sstd_index) {
+    split_transaction_desc_t *trans = &split_transaction_table[sstd_index];
+
+    // The id and its handshake, then both buffers in full
+    wire.transactions++;
+    wire.bytes += 2 + trans->initiator2target_buffer_size + trans->target2initiator_buffer_size;
+    if (wire_fails(sstd_index)) {
+        return false;
+    }
+
+    if (trans->slave_callback) {
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+    }
+    return true;
+}
+
+bool is_transport_connected(void) {
+    return true;
+}
+
+void split_shared_memory_lock(void) {}
+void split_shared_memory_unlock(void) {}
+
+// The slave has no encoder events to report
+void encoder_retrieve_events(encoder_events_t *events) {
+    memset(events, 0, sizeof(*events));
+}
+bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bool *clockwise) {
+    return false;
+}
+bool encoder_queue_event(uint8_t index, bool clockwise) {
+    return true;
+}
+void encoder_signal_queue_drain(void) {}
+}
+
+class SplitBatch : public ::testing::Test {
+   protected:
+    matrix_row_t slave_keys[MATRIX_ROWS / 2]   = {0}; // what the slave scans
+    matrix_row_t slave_matrix[MATRIX_ROWS / 2] = {0}; // what the master gets
+
+    void SetUp() override {
+        wire = {};
+        memset(split_shmem, 0, sizeof(*split_shmem));
+    }
+
+    // A scan on each half, the slave first
+    bool scan(void) {
+        matrix_row_t master_matrix[MATRIX_ROWS / 2] = {0};
+        transactions_slave(master_matrix, slave_keys);
+        return transactions_master(master_matrix, slave_matrix);
+    }
+};
+
+TEST_F(SplitBatch, FailedReadDoesNotKeepTheMatrixFromSyncing) {
+    wire.fails    = [](int8_t id) { return id == GET_ENCODERS_CHECKSUM; };
+    slave_keys[1] = 0x05;
+
+    // The encoders fail the scan, but the slave matrix read at its end still goes through
+    EXPECT_FALSE(scan());
+    EXPECT_EQ(slave_matrix[1], 0x05);
+
+    slave_keys[1] = 0x00;
+    EXPECT_FALSE(scan());
+    EXPECT_EQ(slave_matrix[1], 0x00);
+
+    wire.fails = nullptr;
+    EXPECT_TRUE(scan());
+}
+
+TEST_F(SplitBatch, IdleScanMovesWhatItWouldUnbatched) {
+    scan();
+
+    // The encoders and the slave matrix are polled, each alone in its frame, so each goes on its own
+    wire = {};
+    for (int i = 0; i < 10; i++) {
+        EXPECT_TRUE(scan());
+    }
+    split_transaction_desc_t *encoders = &split_transaction_table[GET_ENCODERS_CHECKSUM];
+    split_transaction_desc_t *matrix   = &split_transaction_table[GET_SLAVE_MATRIX_DELTA];
+    EXPECT_EQ(wire.transactions, 10 * 2);
+    EXPECT_EQ(wire.bytes, 10u * (2 + encoders->target2initiator_buffer_size + 2 + matrix->initiator2target_buffer_size + matrix->target2initiator_buffer_size));
+}
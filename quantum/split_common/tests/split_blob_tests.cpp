@@ -0,0 +1,250 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "split_blob.h"
+}
+
+static std::vector<uint8_t> round_trip(const std::vector<uint8_t> &data) {
+    uint8_t encoded[512];
+    uint8_t decoded[512];
+
+    uint16_t encoded_length = split_blob_encode(data.data(), data.size(), encoded, sizeof(encoded));
+    uint16_t decoded_length = split_blob_decode(encoded, encoded_length, decoded, sizeof(decoded));
+    return std::vector<uint8_t>(decoded, decoded + decoded_length);
+}
+
+TEST(SplitBlobEncode, RunsShrink) {
+    std::vector<uint8_t> data(100, 0x42);
+    uint8_t              encoded[16];
+
+    EXPECT_EQ(split_blob_encode(data.data(), data.size(), encoded, sizeof(encoded)), 2);
+    EXPECT_EQ(round_trip(data), data);
+}
+
+TEST(SplitBlobEncode, LongRunsAreSplit) {
+    std::vector<uint8_t> data(300, 0x00);
+    uint8_t              encoded[16];
+
+    EXPECT_EQ(split_blob_encode(data.data(), data.size(), encoded, sizeof(encoded)), 6);
+    EXPECT_EQ(round_trip(data), data);
+}
+
+TEST(SplitBlobEncode, LiteralsAndRunsMix) {
+    std::vector<uint8_t> data = {1, 2, 3, 3, 4, 4, 4, 4, 5, 6, 6, 6, 7};
+    EXPECT_EQ(round_trip(data), data);
+}
+
+TEST(SplitBlobEncode, IncompressibleDataRoundTrips) {
+    std::vector<uint8_t> data;
+    for (int i = 0; i < 300; i++) {
+        data.push_back(i * 7 + (i >> 3));
+    }
+    EXPECT_EQ(round_trip(data), data);
+}
+
+TEST(SplitBlobEncode, OverflowIsRefused) {
+    std::vector<uint8_t> data = {1, 2, 3, 4, 5, 6};
+    uint8_t              encoded[7];
+    uint8_t              decoded[4];
+
+    EXPECT_EQ(split_blob_encode(data.data(), data.size(), encoded, 6), 0);
+    EXPECT_EQ(split_blob_encode(data.data(), data.size(), encoded, sizeof(encoded)), 7);
+    EXPECT_EQ(split_blob_decode(encoded, 7, decoded, sizeof(decoded)), 0);
+}
+
+TEST(SplitBlobEncode, MalformedDataIsRefused) {
+    uint8_t decoded[64];
+    uint8_t truncated_literal[] = {4, 1, 2};
+    uint8_t truncated_run[]     = {0x85};
+
+    EXPECT_EQ(split_blob_decode(truncated_literal, sizeof(truncated_literal), decoded, sizeof(decoded)), 0);
+    EXPECT_EQ(split_blob_decode(truncated_run, sizeof(truncated_run), decoded, sizeof(decoded)), 0);
+}
+
+/* A master sending to a slave over a simulated link, one fragment and its
+ * answer per exchange, as the split transactions carry them. */
+class SplitBlob : public ::testing::Test {
+   protected:
+    enum fault_t { NONE, DROP_FRAGMENT, DROP_ACK, CORRUPT_FRAGMENT, CORRUPT_ACK };
+
+    split_blob_sender_t   sender    = {};
+    split_blob_receiver_t receiver  = {};
+    int                   exchanges = 0;
+    int                   completed = 0;
+
+    // Returns false once there is nothing left to send
+    bool exchange(fault_t fault = NONE) {
+        split_blob_fragment_t fragment;
+        split_blob_ack_t      ack = {};
+
+        if (!split_blob_next(&sender, &fragment)) {
+            return false;
+        }
+        exchanges++;
+        if (fault == DROP_FRAGMENT) return true;
+        if (fault == CORRUPT_FRAGMENT) fragment.payload.data[3] ^= 0x10;
+
+        if (split_blob_receive(&receiver, &fragment, &ack)) {
+            completed++;
+        }
+        if (fault == DROP_ACK) return true;
+        if (fault == CORRUPT_ACK) ack.payload.received ^= 0x01;
+
+        split_blob_acknowledge(&sender, &ack);
+        return true;
+    }
+
+    std::vector<uint8_t> received(void) {
+        uint8_t  data[SPLIT_BLOB_MAX_SIZE];
+        uint16_t length = 0;
+        if (!split_blob_read(&receiver, data, sizeof(data), &length)) {
+            return {};
+        }
+        return std::vector<uint8_t>(data, data + length);
+    }
+
+    static std::vector<uint8_t> noise(size_t length) {
+        std::vector<uint8_t> data;
+        for (size_t i = 0; i < length; i++) {
+            data.push_back(i * 37 + 11);
+        }
+        return data;
+    }
+};
+
+TEST_F(SplitBlob, SendsAFragmentPerExchange) {
+    auto data = noise(SPLIT_BLOB_MAX_SIZE);
+    ASSERT_TRUE(split_blob_start(&sender, 3, data.data(), data.size()));
+
+    while (exchange()) {
+    }
+    EXPECT_EQ(exchanges, SPLIT_BLOB_MAX_FRAGMENTS);
+    EXPECT_EQ(completed, 1);
+    EXPECT_EQ(receiver.channel, 3);
+    EXPECT_EQ(received(), data);
+    EXPECT_FALSE(split_blob_pending(&sender));
+}
+
+TEST_F(SplitBlob, EncodingSavesFragments) {
+    std::vector<uint8_t> data(SPLIT_BLOB_MAX_SIZE, 0xFF);
+    data[10] = 0x00;
+    ASSERT_TRUE(split_blob_start(&sender, 0, data.data(), data.size()));
+    EXPECT_EQ(sender.flags, SPLIT_BLOB_ENCODED);
+
+    while (exchange()) {
+    }
+    EXPECT_EQ(exchanges, 1);
+    EXPECT_EQ(received(), data);
+}
+
+TEST_F(SplitBlob, EmptyBlobArrives) {
+    ASSERT_TRUE(split_blob_start(&sender, 5, nullptr, 0));
+    while (exchange()) {
+    }
+    EXPECT_EQ(exchanges, 1);
+    EXPECT_EQ(completed, 1);
+    EXPECT_TRUE(receiver.complete);
+    EXPECT_TRUE(received().empty());
+}
+
+TEST_F(SplitBlob, OversizedBlobIsRefused) {
+    std::vector<uint8_t> data(SPLIT_BLOB_MAX_SIZE + 1, 0);
+    EXPECT_FALSE(split_blob_start(&sender, 0, data.data(), data.size()));
+    EXPECT_FALSE(split_blob_pending(&sender));
+}
+
+TEST_F(SplitBlob, LostFragmentIsSentAgain) {
+    auto data = noise(SPLIT_BLOB_MAX_SIZE);
+    ASSERT_TRUE(split_blob_start(&sender, 0, data.data(), data.size()));
+
+    exchange(DROP_FRAGMENT);
+    while (exchange()) {
+    }
+    EXPECT_EQ(exchanges, SPLIT_BLOB_MAX_FRAGMENTS + 1);
+    EXPECT_EQ(received(), data);
+}
+
+TEST_F(SplitBlob, LostAnswerIsCoveredByTheNext) {
+    auto data = noise(SPLIT_BLOB_MAX_SIZE);
+    ASSERT_TRUE(split_blob_start(&sender, 0, data.data(), data.size()));
+
+    exchange(DROP_ACK);
+    exchange(CORRUPT_ACK);
+    while (exchange()) {
+    }
+    // Each answer holds every fragment the slave has, nothing is sent twice
+    EXPECT_EQ(exchanges, SPLIT_BLOB_MAX_FRAGMENTS);
+    EXPECT_EQ(completed, 1);
+    EXPECT_EQ(received(), data);
+}
+
+TEST_F(SplitBlob, LastAnswerLostSendsTheFragmentAgain) {
+    auto data = noise(SPLIT_BLOB_MAX_SIZE);
+    ASSERT_TRUE(split_blob_start(&sender, 0, data.data(), data.size()));
+
+    for (int i = 1; i < SPLIT_BLOB_MAX_FRAGMENTS; i++) {
+        exchange();
+    }
+    exchange(DROP_ACK);
+    EXPECT_TRUE(split_blob_pending(&sender));
+    while (exchange()) {
+    }
+    EXPECT_EQ(exchanges, SPLIT_BLOB_MAX_FRAGMENTS + 1);
+    EXPECT_EQ(completed, 1);
+    EXPECT_EQ(received(), data);
+}
+
+TEST_F(SplitBlob, CorruptFragmentIsRejected) {
+    auto data = noise(SPLIT_BLOB_MAX_SIZE);
+    ASSERT_TRUE(split_blob_start(&sender, 0, data.data(), data.size()));
+
+    exchange(CORRUPT_FRAGMENT);
+    EXPECT_EQ(receiver.received, 0u);
+    while (exchange()) {
+    }
+    EXPECT_EQ(received(), data);
+}
+
+TEST_F(SplitBlob, NewBlobReplacesOneInFlight) {
+    auto first  = noise(SPLIT_BLOB_MAX_SIZE);
+    auto second = noise(SPLIT_BLOB_MAX_SIZE / 2);
+    ASSERT_TRUE(split_blob_start(&sender, 1, first.data(), first.size()));
+    exchange();
+    exchange();
+
+    ASSERT_TRUE(split_blob_start(&sender, 2, second.data(), second.size()));
+    while (exchange()) {
+    }
+    EXPECT_EQ(completed, 1);
+    EXPECT_EQ(receiver.channel, 2);
+    EXPECT_EQ(received(), second);
+}
+
+TEST_F(SplitBlob, ArrivesOverALossyLink) {
+    uint32_t seed = 1;
+    auto     next = [&seed]() {
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 16) & 0x7FFF;
+    };
+
+    for (int round = 0; round < 200; round++) {
+        std::vector<uint8_t> data(next() % (SPLIT_BLOB_MAX_SIZE + 1));
+        for (auto &byte : data) {
+            // Some blobs compress, some do not
+            byte = round % 2 ? next() : next() % 3 == 0;
+        }
+        ASSERT_TRUE(split_blob_start(&sender, round, data.data(), data.size()));
+
+        int tries = 0;
+        while (exchange((fault_t)(next() % 3 == 0 ? next() % 5 : NONE))) {
+            ASSERT_LT(++tries, 1000);
+        }
+        EXPECT_EQ(completed, round + 1);
+        EXPECT_EQ(received(), data);
+    }
+}
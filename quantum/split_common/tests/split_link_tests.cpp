@@ -0,0 +1,265 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "split_link.h"
+#include "transactions.h"
+#include "transport.h"
+#include "transaction_id_define.h"
+#include "serial.h"
+}
+
+/* A stub serial driver, looping transactions back to the slave side and failing the ones the test picks. */
+static struct {
+    std::function<bool(int8_t id)> fails;
+    uint32_t                       delay_us;
+    int                            exchanges[NUM_TOTAL_TRANSACTIONS];
+} wire;
+
+static uint8_t wpm;
+
+static void busy_wait_us(uint32_t us) {
+    struct timespec start, now;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+    } while ((now.tv_sec - start.tv_sec) * 1000000L + (now.tv_nsec - start.tv_nsec) / 1000 < (long)us);
+}
+
+extern "C" {
+void soft_serial_initiator_init(void) {}
+void soft_serial_target_init(void) {}
+
+bool soft_serial_transaction(int sstd_index) {
+    wire.exchanges[sstd_index]++;
+    busy_wait_us(wire.delay_us);
+    if (wire.fails && wire.fails(sstd_index)) {
+        return false;
+    }
+
+    split_transaction_desc_t *trans = &split_transaction_table[sstd_index];
+    if (trans->slave_callback) {
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+    }
+    return true;
+}
+
+bool is_transport_connected(void) {
+    return true;
+}
+
+void split_shared_memory_lock(void) {}
+void split_shared_memory_unlock(void) {}
+
+// Changes on every scan, so the WPM transaction is sent on every scan it is due
+uint8_t get_current_wpm(void) {
+    return ++wpm;
+}
+void set_current_wpm(uint8_t new_wpm) {}
+}
+
+class SplitLink : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        wire = {};
+        wpm  = 0;
+        split_link_reset();
+    }
+
+    bool exchange(int8_t id, uint16_t sent = 4, uint16_t received = 4) {
+        uint8_t buffer[16] = {0};
+        return split_link_exchange(id, buffer, sent, buffer, received);
+    }
+
+    // The slave matrix, and WPM as the only background transaction
+    bool scan(void) {
+        matrix_row_t master_matrix[MATRIX_ROWS / 2] = {0};
+        matrix_row_t slave_matrix[MATRIX_ROWS / 2]  = {0};
+        return transactions_master(master_matrix, slave_matrix);
+    }
+
+    static uint32_t rtt_total(const split_link_stats_t *stats, uint8_t from = 0) {
+        uint32_t total = 0;
+        for (uint8_t b = from; b < SPLIT_LINK_RTT_BUCKETS; b++) {
+            total += stats->rtt[b];
+        }
+        return total;
+    }
+};
+
+TEST_F(SplitLink, CountsExchanges) {
+    exchange(USER_OLED, 6, 2);
+    exchange(USER_OLED, 6, 0);
+    exchange(GET_SLAVE_MATRIX_DELTA, 1, 10);
+
+    const split_link_stats_t *stats = split_link_get_stats(USER_OLED);
+    ASSERT_NE(stats, nullptr);
+    EXPECT_EQ(stats->attempts, 2);
+    EXPECT_EQ(stats->timeouts, 0);
+    EXPECT_EQ(stats->crc_errors, 0);
+    EXPECT_EQ(stats->bytes, 14u);
+    EXPECT_EQ(rtt_total(stats), 2u);
+    EXPECT_EQ(split_link_get_stats(GET_SLAVE_MATRIX_DELTA)->attempts, 1);
+    EXPECT_EQ(split_link_get_stats(NUM_TOTAL_TRANSACTIONS), nullptr);
+}
+
+TEST_F(SplitLink, FailuresAreNotTimedNorCounted) {
+    wire.fails = [](int8_t) { return true; };
+    EXPECT_FALSE(exchange(USER_OLED));
+
+    const split_link_stats_t *stats = split_link_get_stats(USER_OLED);
+    EXPECT_EQ(stats->attempts, 1);
+    EXPECT_EQ(stats->timeouts, 1);
+    EXPECT_EQ(stats->bytes, 0u);
+    EXPECT_EQ(rtt_total(stats), 0u);
+}
+
+TEST_F(SplitLink, CrcErrorsAreCounted) {
+    exchange(GET_SLAVE_MATRIX_DELTA);
+    split_link_crc_error(GET_SLAVE_MATRIX_DELTA);
+
+    const split_link_stats_t *stats = split_link_get_stats(GET_SLAVE_MATRIX_DELTA);
+    EXPECT_EQ(stats->attempts, 1);
+    EXPECT_EQ(stats->crc_errors, 1);
+    EXPECT_EQ(stats->timeouts, 0);
+}
+
+TEST_F(SplitLink, SlowRoundTripsLandInLaterBuckets) {
+    // Between 8 and 16 times the first bound
+    wire.delay_us = SPLIT_LINK_RTT_BASE_US * 9;
+    exchange(USER_OLED);
+    EXPECT_EQ(rtt_total(split_link_get_stats(USER_OLED), 4), 1u);
+}
+
+TEST_F(SplitLink, CountersSaturate) {
+    for (uint32_t i = 0; i < UINT16_MAX + 10; i++) {
+        split_link_crc_error(USER_OLED);
+    }
+    EXPECT_EQ(split_link_get_stats(USER_OLED)->crc_errors, UINT16_MAX);
+}
+
+TEST_F(SplitLink, RawHidReportsStats) {
+    wire.fails = [](int8_t) { return true; };
+    exchange(USER_OLED);
+    wire.fails = nullptr;
+    exchange(USER_OLED, 3, 2);
+    split_link_crc_error(USER_OLED);
+
+    // Room for every bucket, a 32 byte report holds as many as fit
+    uint8_t data[20 + 2 * SPLIT_LINK_RTT_BUCKETS] = {SPLIT_LINK_RAW_HID_COMMAND, USER_OLED};
+    ASSERT_TRUE(split_link_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[0], SPLIT_LINK_RAW_HID_COMMAND);
+    EXPECT_EQ(data[1], USER_OLED);
+    EXPECT_EQ(data[2], NUM_TOTAL_TRANSACTIONS);
+    EXPECT_EQ(data[3], SPLIT_LINK_RTT_BUCKETS);
+
+    uint32_t counters[4];
+    memcpy(counters, &data[4], sizeof(counters));
+    EXPECT_EQ(counters[0], 2u);
+    EXPECT_EQ(counters[1], 1u);
+    EXPECT_EQ(counters[2], 1u);
+    EXPECT_EQ(counters[3], 5u);
+
+    uint16_t rtt[SPLIT_LINK_RTT_BUCKETS];
+    memcpy(rtt, &data[20], sizeof(rtt));
+    uint32_t total = 0;
+    for (auto count : rtt) total += count;
+    EXPECT_EQ(total, 1u);
+}
+
+TEST_F(SplitLink, RawHidLeavesOtherRequests) {
+    uint8_t data[32] = {0x42, USER_OLED};
+    EXPECT_FALSE(split_link_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[0], 0x42);
+
+    uint8_t out_of_range[32] = {SPLIT_LINK_RAW_HID_COMMAND, NUM_TOTAL_TRANSACTIONS};
+    EXPECT_TRUE(split_link_raw_hid_receive(out_of_range, sizeof(out_of_range)));
+    EXPECT_EQ(out_of_range[2], NUM_TOTAL_TRANSACTIONS);
+    EXPECT_EQ(out_of_range[4], 0);
+}
+
+TEST_F(SplitLink, IsolatedErrorsDoNotBackOff) {
+    int count  = 0;
+    wire.fails = [&count](int8_t) { return ++count % 8 == 0; };
+    for (int i = 0; i < 500; i++) {
+        EXPECT_TRUE(scan());
+        EXPECT_FALSE(split_link_backing_off());
+    }
+    EXPECT_EQ(wire.exchanges[GET_SLAVE_MATRIX_DELTA] + wire.exchanges[PUT_WPM], count);
+}
+
+TEST_F(SplitLink, FailedBackgroundTransactionDoesNotAbortTheScan) {
+    wire.fails = [](int8_t id) { return id == PUT_WPM; };
+
+    // Until the link backs off, WPM is retried and its failure fails the scan
+    EXPECT_FALSE(scan());
+    EXPECT_EQ(wire.exchanges[PUT_WPM], 10);
+    ASSERT_TRUE(split_link_backing_off());
+
+    // Then the matrix is still synced on every scan, and WPM gets a single attempt on the 1st, 3rd and 7th
+    for (int i = 0; i < 10; i++) {
+        EXPECT_TRUE(scan());
+        ASSERT_TRUE(split_link_backing_off());
+    }
+    EXPECT_EQ(wire.exchanges[GET_SLAVE_MATRIX_DELTA], 11);
+    EXPECT_EQ(wire.exchanges[PUT_WPM], 10 + 3);
+}
+
+TEST_F(SplitLink, IntervalDoublesWhileBackedOff) {
+    for (int i = 0; i < SPLIT_LINK_BACKOFF_MAX_SCORE; i++) {
+        split_link_crc_error(USER_OLED);
+    }
+    ASSERT_TRUE(split_link_backing_off());
+
+    int last = 0;
+    int gap  = 2;
+    for (int scan = 1; scan < 1000; scan++) {
+        if (split_link_backoff_due() && last > 0) {
+            EXPECT_EQ(scan - last, gap);
+            gap = gap < SPLIT_LINK_BACKOFF_MAX_INTERVAL ? gap * 2 : gap;
+            last = scan;
+        } else if (last == 0) {
+            last = scan;
+        }
+    }
+    EXPECT_EQ(gap, SPLIT_LINK_BACKOFF_MAX_INTERVAL);
+}
+
+TEST_F(SplitLink, ErrorBurstKeepsTheMatrixGoing) {
+    uint32_t seed  = 1;
+    bool     burst = true;
+    wire.fails     = [&](int8_t) {
+        seed = seed * 1103515245 + 12345;
+        // A noisy cable drops a third of the exchanges
+        return burst && ((seed >> 16) & 0x7FFF) % 3 == 0;
+    };
+
+    const int scans  = 1000;
+    int       synced = 0;
+    for (int i = 0; i < scans; i++) {
+        synced += scan();
+    }
+    EXPECT_TRUE(split_link_backing_off());
+    // Every scan still polls the matrix, and nearly every poll goes through on retries
+    EXPECT_GE(wire.exchanges[GET_SLAVE_MATRIX_DELTA], scans);
+    EXPECT_EQ(synced, scans);
+    // Background transactions stay out of the way
+    EXPECT_LT(wire.exchanges[PUT_WPM], scans / 10);
+
+    // Once the cable behaves, everything runs on every scan again
+    burst = false;
+    for (int i = 0; i < SPLIT_LINK_BACKOFF_MAX_SCORE; i++) {
+        scan();
+    }
+    EXPECT_FALSE(split_link_backing_off());
+    int before = wire.exchanges[PUT_WPM];
+    for (int i = 0; i < 10; i++) {
+        EXPECT_TRUE(scan());
+    }
+    EXPECT_EQ(wire.exchanges[PUT_WPM] - before, 10);
+}
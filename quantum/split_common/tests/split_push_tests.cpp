@@ -0,0 +1,452 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "split_push.h"
+#include "transactions.h"
+#include "transport.h"
+#include "transaction_id_define.h"
+#include "serial.h"
+#include "serial_protocol.h"
+#include "timer.h"
+#include "ch.h"
+
+void set_time(uint32_t t);
+}
+
+/* A stub serial driver joining both halves in one process, with a queue of
+ * bytes each way, under the real serial_protocol.c and transactions.c. The
+ * slave thread of serial_protocol.c runs as a host thread and answers the
+ * transactions; the test scans the slave half on its own thread in between,
+ * or from hooks while the master waits for an answer. */
+enum fault_t { NONE, DROP, CORRUPT };
+
+typedef std::function<void()> hook_t;
+
+// Never destroyed, the slave thread still waits on them when the tests exit
+static std::mutex              &wire_mutex   = *new std::mutex;
+static std::condition_variable &wire_changed = *new std::condition_variable;
+static std::deque<uint8_t>     &to_slave     = *new std::deque<uint8_t>;
+static std::deque<uint8_t>     &to_master    = *new std::deque<uint8_t>;
+static int                      held; // the master does not see the slave's bytes while a hook runs
+
+static thread_local bool on_slave;       // on the slave half, as its thread or a slave scan
+static thread_local bool slave_scanning; // sends are pushed packets
+
+static fault_t  fault;
+static hook_t   before_answer, after_answer;
+static int      polls;
+static uint16_t slave_clock;
+
+// What the slave thread is doing, the handshake and then the answer of a poll
+static bool answering;
+static int  answer_sends;
+
+// Each half locks its own shared memory
+static std::recursive_mutex &master_shmem = *new std::recursive_mutex;
+static std::recursive_mutex &slave_shmem  = *new std::recursive_mutex;
+
+static void run_hook(hook_t &hook) {
+    if (hook) {
+        hook_t run = hook;
+        hook       = nullptr;
+        run();
+    }
+}
+
+extern "C" {
+volatile bool isLeftHand = true;
+
+bool is_keyboard_master(void) {
+    return !on_slave;
+}
+
+bool is_transport_connected(void) {
+    return true;
+}
+
+uint16_t sync_timer_read(void) {
+    return on_slave ? slave_clock : timer_read();
+}
+uint32_t sync_timer_read32(void) {
+    return on_slave ? slave_clock : timer_read32();
+}
+void sync_timer_update(uint32_t time) {}
+
+void split_shared_memory_lock(void) {
+    (on_slave ? slave_shmem : master_shmem).lock();
+}
+void split_shared_memory_unlock(void) {
+    (on_slave ? slave_shmem : master_shmem).unlock();
+}
+
+void chRegSetThreadName(const char *name) {}
+
+void *chThdCreateStatic(void *wsp, size_t size, int prio, tfunc_t pf, void *arg) {
+    std::thread([pf, arg] {
+        on_slave = true;
+        pf(arg);
+    }).detach();
+    return wsp;
+}
+
+void serial_transport_driver_slave_init(void) {}
+void serial_transport_driver_master_init(void) {}
+
+void serial_transport_driver_clear(void) {
+    std::lock_guard<std::mutex> lock(wire_mutex);
+    (on_slave ? to_slave : to_master).clear();
+}
+
+static bool receive_ready(size_t size) {
+    return on_slave ? to_slave.size() >= size : held == 0 && to_master.size() >= size;
+}
+
+static void receive_take(uint8_t *destination, size_t size) {
+    std::deque<uint8_t> &wire = on_slave ? to_slave : to_master;
+    std::copy(wire.begin(), wire.begin() + size, destination);
+    wire.erase(wire.begin(), wire.begin() + size);
+}
+
+bool serial_transport_receive(uint8_t *destination, const size_t size) {
+    std::unique_lock<std::mutex> lock(wire_mutex);
+    if (!wire_changed.wait_for(lock, std::chrono::milliseconds(500), [size] { return receive_ready(size); })) {
+        return false;
+    }
+    receive_take(destination, size);
+    return true;
+}
+
+bool serial_transport_receive_immediate(uint8_t *destination, const size_t size) {
+    std::lock_guard<std::mutex> lock(wire_mutex);
+    if (!receive_ready(size)) {
+        return false;
+    }
+    receive_take(destination, size);
+    return true;
+}
+
+// Only the slave thread waits for the next transaction
+bool serial_transport_receive_blocking(uint8_t *destination, const size_t size) {
+    {
+        std::unique_lock<std::mutex> lock(wire_mutex);
+        wire_changed.wait(lock, [size] { return receive_ready(size); });
+        receive_take(destination, size);
+    }
+    if (destination[0] == GET_SLAVE_MATRIX_DELTA) {
+        polls++;
+        answering    = true;
+        answer_sends = 0;
+        // The slave scans before it takes the shared memory for the answer
+        run_hook(before_answer);
+    }
+    return true;
+}
+
+bool serial_transport_send(const uint8_t *source, const size_t size) {
+    std::deque<uint8_t> bytes(source, source + size);
+    if (slave_scanning) {
+        fault_t packet_fault = fault;
+        fault                = NONE;
+        if (packet_fault == DROP) return true;
+        if (packet_fault == CORRUPT) bytes[offsetof(split_push_packet_t, payload) + 2] ^= 0x02;
+    }
+
+    // The slave scans again as soon as the answer is out, before the master read it
+    bool answer = on_slave && !slave_scanning && answering && ++answer_sends == 2;
+    {
+        std::lock_guard<std::mutex> lock(wire_mutex);
+        std::deque<uint8_t>        &wire = on_slave ? to_master : to_slave;
+        wire.insert(wire.end(), bytes.begin(), bytes.end());
+        if (answer) held++;
+    }
+    wire_changed.notify_all();
+
+    if (answer) {
+        answering = false;
+        run_hook(after_answer);
+        {
+            std::lock_guard<std::mutex> lock(wire_mutex);
+            held--;
+        }
+        wire_changed.notify_all();
+    }
+    return true;
+}
+}
+
+class SplitPush : public ::testing::Test {
+   protected:
+    matrix_row_t slave[MATRIX_DELTA_HALF_ROWS]  = {0}; // what the slave scans
+    matrix_row_t master[MATRIX_DELTA_HALF_ROWS] = {0}; // what the master got
+    uint32_t     epoch                          = 0;   // master time the test starts at, right after a poll
+    uint16_t     now                            = 0;   // since the epoch
+
+    // Once for all the tests, as there is only one slave thread
+    static void SetUpTestSuite() {
+        static bool started = false;
+        if (!started) {
+            soft_serial_initiator_init();
+            soft_serial_target_init();
+            started = true;
+        }
+    }
+
+    void SetUp() override {
+        fault = NONE;
+        settle();
+        polls = 0;
+    }
+
+    /* The halves keep their state from one test to the next, this brings them in
+     * step: no key down, matching sequence numbers, nothing to catch up on, and
+     * a poll just done. */
+    void settle(void) {
+        epoch = timer_read32() + 1000;
+        now   = 0;
+
+        // A packet brings the sequence numbers in line
+        memset(slave, 0, sizeof(slave));
+        slave[0] = 0x01;
+        slave_scan(now);
+        master_scan();
+        slave[0] = 0x00;
+        slave_scan(now);
+        master_scan();
+
+        for (int i = 0; i < SPLIT_PUSH_RESYNC_POLLS; i++) {
+            master_scan();
+        }
+        now = SPLIT_PUSH_RESYNC_INTERVAL;
+        master_scan();
+        ASSERT_TRUE(in_sync());
+
+        epoch += SPLIT_PUSH_RESYNC_INTERVAL;
+        now = 0;
+        transactions_key_event_time(0, epoch);
+    }
+
+    uint16_t at(uint16_t time) {
+        return epoch + time;
+    }
+
+    // A scan on the slave, the rows it changes are pushed
+    void slave_scan(uint16_t time) {
+        matrix_row_t master_matrix[MATRIX_DELTA_HALF_ROWS] = {0};
+        bool         was_slave                             = on_slave;
+
+        slave_clock    = at(time);
+        on_slave       = true;
+        slave_scanning = true;
+        transactions_slave(master_matrix, slave);
+        slave_scanning = false;
+        on_slave       = was_slave;
+    }
+
+    // A scan on the master, with hooks for the slave scanning while a poll is under way
+    bool master_scan(hook_t before = nullptr, hook_t after = nullptr) {
+        matrix_row_t master_matrix[MATRIX_DELTA_HALF_ROWS] = {0};
+
+        set_time(at(now));
+        before_answer = before;
+        after_answer  = after;
+        bool okay     = transactions_master(master_matrix, master);
+        before_answer = nullptr;
+        after_answer  = nullptr;
+        return okay;
+    }
+
+    bool in_sync(void) {
+        return memcmp(master, slave, sizeof(slave)) == 0;
+    }
+
+    uint16_t event_time(uint8_t slave_row) {
+        return transactions_key_event_time(MATRIX_DELTA_HALF_ROWS + slave_row, at(now));
+    }
+};
+
+TEST_F(SplitPush, ChangeArrivesWithoutAPoll) {
+    slave[2] = 0x05;
+    slave_scan(now);
+    EXPECT_TRUE(master_scan());
+    EXPECT_TRUE(in_sync());
+    EXPECT_EQ(polls, 0);
+}
+
+TEST_F(SplitPush, PollsOnlyEveryInterval) {
+    for (now = 0; now < SPLIT_PUSH_RESYNC_INTERVAL * 3; now++) {
+        EXPECT_TRUE(master_scan());
+    }
+    EXPECT_EQ(polls, 2);
+}
+
+TEST_F(SplitPush, LostPacketIsCaughtUpOn) {
+    fault    = DROP;
+    slave[1] = 0x01;
+    slave_scan(now);
+    EXPECT_TRUE(master_scan());
+    EXPECT_FALSE(in_sync());
+
+    // The next packet shows the gap, and the master polls until it caught up
+    slave[4] = 0x10;
+    slave_scan(now);
+    for (int i = 0; i < SPLIT_PUSH_RESYNC_POLLS; i++) {
+        EXPECT_TRUE(master_scan());
+    }
+    EXPECT_TRUE(in_sync());
+    EXPECT_EQ(polls, SPLIT_PUSH_RESYNC_POLLS);
+
+    EXPECT_TRUE(master_scan());
+    EXPECT_EQ(polls, SPLIT_PUSH_RESYNC_POLLS);
+}
+
+TEST_F(SplitPush, LastPacketLostIsCaughtUpOnAtTheNextPoll) {
+    fault    = DROP;
+    slave[3] = 0x08;
+    slave_scan(now);
+    for (now = 0; now <= SPLIT_PUSH_RESYNC_INTERVAL; now++) {
+        EXPECT_TRUE(master_scan());
+    }
+    EXPECT_TRUE(in_sync());
+}
+
+TEST_F(SplitPush, CorruptPacketIsRejected) {
+    fault    = CORRUPT;
+    slave[0] = 0x04;
+    slave_scan(now);
+
+    // Dropped for its checksum, and polled for right away
+    EXPECT_TRUE(master_scan());
+    EXPECT_EQ(polls, 1);
+    EXPECT_TRUE(in_sync());
+}
+
+TEST_F(SplitPush, PushesBeforeTheAnswerAreApplied) {
+    now = SPLIT_PUSH_RESYNC_INTERVAL;
+    EXPECT_TRUE(master_scan([&] {
+        slave[2] = 0x03;
+        slave_scan(now);
+    }));
+    EXPECT_EQ(polls, 1);
+    EXPECT_TRUE(in_sync());
+}
+
+TEST_F(SplitPush, PushesAfterTheAnswerAreNotUndone) {
+    slave[2] = 0x03;
+    slave_scan(now);
+    now = SPLIT_PUSH_RESYNC_INTERVAL;
+
+    // The answer still has the row pressed, the release is pushed right behind it
+    EXPECT_TRUE(master_scan(nullptr, [&] {
+        slave[2] = 0x00;
+        slave_scan(now);
+    }));
+    EXPECT_EQ(polls, 1);
+    EXPECT_TRUE(in_sync());
+}
+
+TEST_F(SplitPush, StaysInSyncOverALossyLink) {
+    uint32_t seed = 1;
+    auto     next = [&seed]() {
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 16) & 0x7FFF;
+    };
+
+    for (now = 0; now < 5000; now++) {
+        if (next() % 4 == 0) {
+            slave[next() % MATRIX_DELTA_HALF_ROWS] ^= 1 << (next() % MATRIX_COLS);
+            fault = (fault_t)(next() % 8 < 6 ? NONE : next() % 3);
+        }
+        auto scan = [&] { slave_scan(now); };
+        switch (next() % 3) {
+            case 0:
+                slave_scan(now);
+                master_scan();
+                break;
+            case 1:
+                master_scan(scan);
+                break;
+            default:
+                master_scan(nullptr, scan);
+                break;
+        }
+    }
+
+    // Once the slave stops changing, the master catches up by the next poll
+    for (int i = 0; i <= SPLIT_PUSH_RESYNC_INTERVAL + MATRIX_DELTA_HALF_ROWS; i++, now++) {
+        slave_scan(now);
+        master_scan();
+    }
+    EXPECT_TRUE(in_sync());
+}
+
+TEST_F(SplitPush, EventsTakeTheTimeTheSlaveSaw) {
+    now      = 1000;
+    slave[1] = 0x01;
+    slave_scan(996);
+    master_scan();
+
+    EXPECT_EQ(event_time(1), at(996));
+    // Keys on the master are timed when the master sees them
+    EXPECT_EQ(transactions_key_event_time(0, at(now)), at(1000));
+}
+
+TEST_F(SplitPush, EventTimesNeverGoBackwards) {
+    now      = 1000;
+    slave[1] = 0x01;
+    slave_scan(990);
+    master_scan();
+
+    EXPECT_EQ(transactions_key_event_time(0, at(995)), at(995));
+    EXPECT_EQ(event_time(1), at(995));
+}
+
+TEST_F(SplitPush, OutOfRangeTimesAreNotTrusted) {
+    slave[1] = 0x01;
+    slave_scan(1000 - SPLIT_PUSH_MAX_AGE - 1);
+    slave[2] = 0x01;
+    slave_scan(1010);
+    now = 1000;
+    master_scan();
+
+    // Too old, and ahead of the master
+    EXPECT_EQ(event_time(1), at(1000));
+    EXPECT_EQ(event_time(2), at(1000));
+}
+
+TEST_F(SplitPush, PolledRowsAreTimedWhenPolled) {
+    fault    = DROP;
+    slave[1] = 0x01;
+    slave_scan(100);
+    for (now = 0; now <= SPLIT_PUSH_RESYNC_INTERVAL; now++) {
+        master_scan();
+    }
+    EXPECT_TRUE(in_sync());
+    EXPECT_EQ(event_time(1), at(SPLIT_PUSH_RESYNC_INTERVAL));
+}
+
+TEST_F(SplitPush, QueueKeepsOrderAndLimit) {
+    split_push_target_t target = {};
+    split_push_queue_t  queue  = {};
+    split_push_packet_t packet;
+    for (uint8_t row = 0; row < SPLIT_PUSH_QUEUE_SIZE; row++) {
+        split_push_build(&target, row % MATRIX_DELTA_HALF_ROWS, row, row, &packet);
+        EXPECT_TRUE(split_push_enqueue(&queue, &packet));
+    }
+    EXPECT_FALSE(split_push_enqueue(&queue, &packet));
+
+    for (uint8_t i = 0; i < SPLIT_PUSH_QUEUE_SIZE; i++) {
+        ASSERT_TRUE(split_push_dequeue(&queue, &packet));
+        EXPECT_EQ(packet.payload.seq, i);
+    }
+    EXPECT_FALSE(split_push_dequeue(&queue, &packet));
+}
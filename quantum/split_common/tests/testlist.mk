@@ -0,0 +1 @@
+TEST_LIST += matrix_delta split_push transport_batch split_blob split_link split_batch
@@ -0,0 +1,405 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "transactions.h"
+#include "transport_batch.h"
+#include "crc.h"
+
+split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS];
+
+static split_shared_memory_t shared_memory;
+split_shared_memory_t *const split_shmem = &shared_memory;
+bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length);
+}
+
+enum fault_t { NONE, DROP, CORRUPT_REQUEST, CORRUPT_RESPONSE };
+
+struct slave_run_t {
+    int8_t   id;
+    uint32_t value;
+};
+
+/* Both halves joined by a simulated serial wire. Each transaction copies the
+ * master's buffer into the slave's shared memory, runs the slave callback
+ * there and copies the answer back, as transport.c does over the wire. */
+static struct {
+    split_shared_memory_t    slave;
+    std::vector<int8_t>      ids;
+    std::vector<slave_run_t> runs;
+    fault_t                  fault;
+    uint32_t                 counter;
+    uint32_t                 bytes;
+    int                      resizes; // kept apart from the ids, and never hit by a fault
+} wire;
+
+static uint8_t *shmem_at(split_shared_memory_t *shmem, uint16_t offset) {
+    return (uint8_t *)shmem + offset;
+}
+
+bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    if (initiator2target_length > trans->initiator2target_buffer_size) initiator2target_length = trans->initiator2target_buffer_size;
+    if (target2initiator_length > trans->target2initiator_buffer_size) target2initiator_length = trans->target2initiator_buffer_size;
+
+    // The serial protocol sends the id and reads back its handshake, then moves both buffers in full
+    wire.bytes += 2 + trans->initiator2target_buffer_size + trans->target2initiator_buffer_size;
+    fault_t fault = NONE;
+    if (id == PUT_BATCH_SIZE) {
+        wire.resizes++;
+    } else {
+        wire.ids.push_back(id);
+        fault      = wire.fault;
+        wire.fault = NONE;
+    }
+    if (fault == DROP) return false;
+
+    memcpy(shmem_at(&shared_memory, trans->initiator2target_offset), initiator2target_buf, initiator2target_length);
+    memcpy(shmem_at(&wire.slave, trans->initiator2target_offset), initiator2target_buf, initiator2target_length);
+    if (fault == CORRUPT_REQUEST) shmem_at(&wire.slave, trans->initiator2target_offset)[2] ^= 0x10;
+
+    // Run the callback with the slave's memory in place
+    split_shared_memory_t master = shared_memory;
+    shared_memory                = wire.slave;
+    if (trans->slave_callback) {
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+    }
+    wire.slave    = shared_memory;
+    shared_memory = master;
+
+    memcpy(target2initiator_buf, shmem_at(&wire.slave, trans->target2initiator_offset), target2initiator_length);
+    if (fault == CORRUPT_RESPONSE) ((uint8_t *)target2initiator_buf)[2] ^= 0x10;
+    return true;
+}
+
+// Records what each write carried
+#define SLAVE_PUT_CALLBACK(name, trans_id)                                                                                                                              \
+    static void name(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {   \
+        uint32_t value = 0;                                                                                                                                              \
+        memcpy(&value, initiator2target_buffer, initiator2target_buffer_size < sizeof(value) ? initiator2target_buffer_size : sizeof(value));                            \
+        wire.runs.push_back({trans_id, value});                                                                                                                          \
+    }
+
+SLAVE_PUT_CALLBACK(slave_put_a, USER_PUT)
+SLAVE_PUT_CALLBACK(slave_put_b, USER_PUT2)
+SLAVE_PUT_CALLBACK(slave_put_c, USER_PUT3)
+SLAVE_PUT_CALLBACK(slave_put_big, USER_BIG)
+
+// Answers with a counter, so every run on the slave is told apart
+static void slave_get(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    uint32_t value = ++wire.counter;
+    memcpy(target2initiator_buffer, &value, sizeof(value));
+    wire.runs.push_back({USER_GET, value});
+}
+
+static split_transaction_desc_t trans_desc(uint8_t initiator2target_size, uint16_t initiator2target_offset, uint8_t target2initiator_size, uint16_t target2initiator_offset, slave_callback_t cb) {
+    return {initiator2target_size, initiator2target_offset, target2initiator_size, target2initiator_offset, cb};
+}
+
+class TransportBatch : public ::testing::Test {
+   protected:
+    TransportBatch() {
+        const uint16_t m2s = offsetof(split_shared_memory_t, rpc_m2s_buffer);
+        const uint16_t s2m = offsetof(split_shared_memory_t, rpc_s2m_buffer);
+
+        memset(split_transaction_table, 0, sizeof(split_transaction_table));
+        split_transaction_table[PUT_BATCH_SIZE] = trans_desc(sizeof(split_batch_size_t), offsetof(split_shared_memory_t, batch.size), 0, 0, transport_batch_size_callback);
+        split_transaction_table[EXCHANGE_BATCH] = trans_desc(sizeof(split_batch_frame_t), offsetof(split_shared_memory_t, batch.request), sizeof(split_batch_frame_t), offsetof(split_shared_memory_t, batch.response), transport_batch_slave_callback);
+        split_transaction_table[USER_PUT]       = trans_desc(4, m2s + 0, 0, 0, slave_put_a);
+        split_transaction_table[USER_PUT2]      = trans_desc(2, m2s + 4, 0, 0, slave_put_b);
+        split_transaction_table[USER_PUT3]      = trans_desc(4, m2s + 6, 0, 0, slave_put_c);
+        split_transaction_table[USER_GET]       = trans_desc(1, m2s + 10, 4, s2m, slave_get);
+        split_transaction_table[USER_BIG]       = trans_desc(RPC_M2S_BUFFER_SIZE, m2s, 0, 0, slave_put_big);
+
+        // Start from an empty queue, whatever an earlier test left behind
+        wire.fault = NONE;
+        transport_batch_flush();
+        wire.ids.clear();
+        wire.runs.clear();
+        wire.bytes   = 0;
+        wire.resizes = 0;
+    }
+
+    bool put(int8_t id, uint32_t value) {
+        return transport_batch_execute(id, &value, split_transaction_table[id].initiator2target_buffer_size, NULL, 0);
+    }
+
+    bool get(uint32_t *value) {
+        uint8_t arg = 0;
+        return transport_batch_execute(USER_GET, &arg, sizeof(arg), value, sizeof(*value));
+    }
+};
+
+TEST_F(TransportBatch, WritesWaitForARead) {
+    uint32_t value = 0;
+    EXPECT_TRUE(put(USER_PUT, 0x11223344));
+    EXPECT_TRUE(put(USER_PUT2, 0x5566));
+    EXPECT_TRUE(wire.ids.empty());
+
+    EXPECT_TRUE(get(&value));
+    ASSERT_EQ(wire.ids.size(), 1u);
+    EXPECT_EQ(wire.ids[0], EXCHANGE_BATCH);
+
+    // The slave ran them in order, and the read got the answer of its own run
+    ASSERT_EQ(wire.runs.size(), 3u);
+    EXPECT_EQ(wire.runs[0].id, USER_PUT);
+    EXPECT_EQ(wire.runs[0].value, 0x11223344u);
+    EXPECT_EQ(wire.runs[1].id, USER_PUT2);
+    EXPECT_EQ(wire.runs[1].value, 0x5566u);
+    EXPECT_EQ(wire.runs[2].id, USER_GET);
+    EXPECT_EQ(value, wire.runs[2].value);
+}
+
+TEST_F(TransportBatch, ScanTakesOneTransaction) {
+    const int scans = 10;
+    uint32_t  value;
+
+    for (int scan = 0; scan < scans; scan++) {
+        EXPECT_TRUE(put(USER_PUT, scan));
+        EXPECT_TRUE(put(USER_PUT2, scan));
+        EXPECT_TRUE(get(&value));
+    }
+    size_t   batched       = wire.ids.size();
+    uint32_t batched_bytes = wire.bytes;
+
+    wire.ids.clear();
+    wire.bytes = 0;
+    for (int scan = 0; scan < scans; scan++) {
+        EXPECT_TRUE(transport_execute_transaction(USER_PUT, &scan, 4, NULL, 0));
+        EXPECT_TRUE(transport_execute_transaction(USER_PUT2, &scan, 2, NULL, 0));
+        EXPECT_TRUE(transport_execute_transaction(USER_GET, &scan, 1, &value, sizeof(value)));
+    }
+
+    // The frame sizes are sent once, then each scan is a single exchange
+    EXPECT_EQ(wire.resizes, 1);
+    EXPECT_EQ(batched, (size_t)scans);
+    EXPECT_EQ(wire.ids.size(), (size_t)scans * 3);
+
+    // Frames carry only the three records and the answer, at 3 bytes of header per record and 2 per frame
+    const uint32_t request  = 2 + (3 + 4) + (3 + 2) + (3 + 1);
+    const uint32_t response = 2 + 4;
+    EXPECT_EQ(batched_bytes, (2 + sizeof(split_batch_size_t)) + scans * (2 + request + response));
+    EXPECT_EQ(wire.bytes, scans * (3 * 2 + 4 + 2 + 1 + 4));
+}
+
+TEST_F(TransportBatch, IdleScanMovesWhatItWouldUnbatched) {
+    const int scans = 10;
+    uint32_t  value;
+
+    for (int scan = 0; scan < scans; scan++) {
+        EXPECT_TRUE(get(&value));
+    }
+    size_t   batched       = wire.ids.size();
+    uint32_t batched_bytes = wire.bytes;
+
+    wire.ids.clear();
+    wire.bytes = 0;
+    for (int scan = 0; scan < scans; scan++) {
+        EXPECT_TRUE(transport_execute_transaction(USER_GET, &scan, 1, &value, sizeof(value)));
+    }
+
+    EXPECT_EQ(batched, wire.ids.size());
+    EXPECT_EQ(batched_bytes, wire.bytes);
+    EXPECT_EQ(value, wire.runs.back().value);
+}
+
+TEST_F(TransportBatch, FrameSizesFollowTheLoad) {
+    uint32_t value;
+
+    // A loaded scan grows the frames
+    EXPECT_TRUE(put(USER_PUT, 1));
+    EXPECT_TRUE(put(USER_PUT2, 2));
+    EXPECT_TRUE(get(&value));
+    EXPECT_EQ(wire.resizes, 1);
+    EXPECT_EQ(split_transaction_table[EXCHANGE_BATCH].initiator2target_buffer_size, 2 + 16);
+
+    // The same again fits them, so they are kept
+    EXPECT_TRUE(put(USER_PUT, 3));
+    EXPECT_TRUE(put(USER_PUT2, 4));
+    EXPECT_TRUE(get(&value));
+    EXPECT_EQ(wire.resizes, 1);
+
+    // A much lighter one shrinks them
+    EXPECT_TRUE(put(USER_PUT2, 5));
+    EXPECT_TRUE(get(&value));
+    EXPECT_EQ(wire.resizes, 2);
+    EXPECT_EQ(split_transaction_table[EXCHANGE_BATCH].initiator2target_buffer_size, 2 + (3 + 2) + (3 + 1));
+    EXPECT_EQ(value, wire.runs.back().value);
+}
+
+TEST_F(TransportBatch, FrameSizesAreSentAgainAfterAFailure) {
+    uint32_t value;
+    EXPECT_TRUE(put(USER_PUT, 1));
+    EXPECT_TRUE(get(&value));
+
+    // A lost exchange may have left the halves out of step
+    EXPECT_TRUE(put(USER_PUT, 2));
+    wire.fault = DROP;
+    EXPECT_FALSE(get(&value));
+
+    // So the sizes are sent again before the retry
+    wire.resizes = 0;
+    EXPECT_TRUE(get(&value));
+    EXPECT_EQ(wire.resizes, 1);
+    ASSERT_EQ(wire.runs.size(), 4u);
+    EXPECT_EQ(wire.runs[2].value, 2u);
+    EXPECT_EQ(value, wire.runs[3].value);
+}
+
+TEST_F(TransportBatch, SlaveIgnoresBadFrameSizes) {
+    split_transaction_desc_t before = split_transaction_table[EXCHANGE_BATCH];
+    split_batch_size_t       size   = {0, 8, 8};
+    transport_batch_size_callback(sizeof(size), &size, 0, NULL);
+    EXPECT_EQ(split_transaction_table[EXCHANGE_BATCH].initiator2target_buffer_size, before.initiator2target_buffer_size);
+
+    size.request  = sizeof(split_batch_frame_t) + 1;
+    size.checksum = crc8(&size.request, 2);
+    transport_batch_size_callback(sizeof(size), &size, 0, NULL);
+    EXPECT_EQ(split_transaction_table[EXCHANGE_BATCH].initiator2target_buffer_size, before.initiator2target_buffer_size);
+
+    size.request  = 8;
+    size.checksum = crc8(&size.request, 2);
+    transport_batch_size_callback(sizeof(size), &size, 0, NULL);
+    EXPECT_EQ(split_transaction_table[EXCHANGE_BATCH].initiator2target_buffer_size, 8);
+    EXPECT_EQ(split_transaction_table[EXCHANGE_BATCH].target2initiator_buffer_size, 8);
+}
+
+TEST_F(TransportBatch, RepeatedWriteSendsTheLatest) {
+    EXPECT_TRUE(put(USER_PUT, 1));
+    EXPECT_TRUE(put(USER_PUT, 2));
+    EXPECT_TRUE(transport_batch_flush());
+
+    ASSERT_EQ(wire.runs.size(), 1u);
+    EXPECT_EQ(wire.runs[0].value, 2u);
+}
+
+TEST_F(TransportBatch, FlushWithNothingQueuedSendsNothing) {
+    EXPECT_TRUE(transport_batch_flush());
+    EXPECT_TRUE(wire.ids.empty());
+}
+
+TEST_F(TransportBatch, FullFrameIsSentFirst) {
+    EXPECT_TRUE(put(USER_PUT, 1));
+    EXPECT_TRUE(put(USER_PUT2, 2));
+    EXPECT_TRUE(wire.ids.empty());
+
+    // Does not fit in what is left of the frame
+    EXPECT_TRUE(put(USER_PUT3, 3));
+    EXPECT_EQ(wire.ids.size(), 1u);
+    EXPECT_TRUE(transport_batch_flush());
+
+    ASSERT_EQ(wire.runs.size(), 3u);
+    EXPECT_EQ(wire.runs[2].id, USER_PUT3);
+    EXPECT_EQ(wire.ids.size(), 2u);
+}
+
+TEST_F(TransportBatch, OversizedTransactionIsSentOnItsOwn) {
+    uint8_t big[RPC_M2S_BUFFER_SIZE];
+    memset(big, 0xFF, sizeof(big));
+
+    EXPECT_TRUE(put(USER_PUT, 1));
+    EXPECT_TRUE(transport_batch_execute(USER_BIG, big, sizeof(big), NULL, 0));
+
+    // The write queued before it is alone, so it goes on its own too
+    ASSERT_EQ(wire.ids.size(), 2u);
+    EXPECT_EQ(wire.ids[0], USER_PUT);
+    EXPECT_EQ(wire.ids[1], USER_BIG);
+    ASSERT_EQ(wire.runs.size(), 2u);
+    EXPECT_EQ(wire.runs[0].id, USER_PUT);
+    EXPECT_EQ(wire.runs[1].id, USER_BIG);
+}
+
+TEST_F(TransportBatch, CorruptRequestRunsNothing) {
+    uint32_t value;
+    EXPECT_TRUE(put(USER_PUT, 7));
+    wire.fault = CORRUPT_REQUEST;
+    EXPECT_FALSE(get(&value));
+    EXPECT_TRUE(wire.runs.empty());
+
+    // The queue is kept, so the retry still carries the write
+    EXPECT_TRUE(get(&value));
+    ASSERT_EQ(wire.runs.size(), 2u);
+    EXPECT_EQ(wire.runs[0].value, 7u);
+    EXPECT_EQ(value, wire.runs[1].value);
+}
+
+TEST_F(TransportBatch, CorruptResponseIsRejected) {
+    uint32_t value = 0;
+    EXPECT_TRUE(put(USER_PUT, 7));
+    wire.fault = CORRUPT_RESPONSE;
+    EXPECT_FALSE(get(&value));
+    EXPECT_EQ(value, 0u);
+
+    EXPECT_TRUE(get(&value));
+    EXPECT_EQ(value, wire.runs.back().value);
+}
+
+TEST_F(TransportBatch, LostExchangeIsRetried) {
+    uint32_t value;
+    EXPECT_TRUE(put(USER_PUT2, 9));
+    wire.fault = DROP;
+    EXPECT_FALSE(get(&value));
+    EXPECT_TRUE(get(&value));
+
+    ASSERT_EQ(wire.runs.size(), 2u);
+    EXPECT_EQ(wire.runs[0].value, 9u);
+}
+
+TEST_F(TransportBatch, FailedReadIsNotLeftInTheQueue) {
+    uint32_t value = 0xDEADBEEF;
+    EXPECT_TRUE(put(USER_PUT, 1));
+    wire.fault = DROP;
+    EXPECT_FALSE(get(&value));
+
+    // A write queued behind the failed read, the next read still gets its own answer
+    EXPECT_TRUE(put(USER_PUT2, 2));
+    EXPECT_TRUE(get(&value));
+    ASSERT_EQ(wire.runs.size(), 3u);
+    EXPECT_EQ(wire.runs[0].id, USER_PUT);
+    EXPECT_EQ(wire.runs[1].id, USER_PUT2);
+    EXPECT_EQ(wire.runs[2].id, USER_GET);
+    EXPECT_EQ(value, wire.runs[2].value);
+}
+
+TEST_F(TransportBatch, FailedReadIsNotRunWithAFullFrame) {
+    uint32_t value;
+    EXPECT_TRUE(put(USER_PUT, 1));
+    wire.fault = DROP;
+    EXPECT_FALSE(get(&value));
+
+    EXPECT_TRUE(put(USER_PUT2, 2));
+    // Does not fit in what is left of the frame
+    EXPECT_TRUE(put(USER_PUT3, 3));
+    EXPECT_TRUE(transport_batch_flush());
+
+    for (auto &run : wire.runs) {
+        EXPECT_NE(run.id, USER_GET);
+    }
+    EXPECT_EQ(wire.runs.size(), 3u);
+}
+
+TEST_F(TransportBatch, SlaveRejectsForeignRecords) {
+    split_batch_frame_t request = {}, response = {};
+
+    auto run = [&](int8_t id, uint8_t initiator2target_length, uint8_t length) {
+        split_batch_record_t record = {id, initiator2target_length, 0};
+        memcpy(request.data, &record, sizeof(record));
+        request.length   = length;
+        request.checksum = crc8(&request.length, sizeof(request.length) + request.length);
+        transport_batch_slave_callback(sizeof(request), &request, sizeof(response), &response);
+        return response.checksum == crc8(&response.length, sizeof(response.length) + response.length);
+    };
+
+    EXPECT_TRUE(run(USER_PUT2, 2, sizeof(split_batch_record_t) + 2));
+    EXPECT_FALSE(run(EXCHANGE_BATCH, 0, sizeof(split_batch_record_t)));
+    EXPECT_FALSE(run(PUT_BATCH_SIZE, 0, sizeof(split_batch_record_t)));
+    EXPECT_FALSE(run(NUM_TOTAL_TRANSACTIONS, 0, sizeof(split_batch_record_t)));
+    EXPECT_FALSE(run(USER_PUT2, 3, sizeof(split_batch_record_t) + 3));
+    EXPECT_FALSE(run(USER_PUT2, 2, sizeof(split_batch_record_t) + 1));
+    EXPECT_FALSE(run(USER_PUT2, 2, 2));
+}
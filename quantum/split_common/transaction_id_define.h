@@ -23,8 +23,12 @@ enum serial_transaction_id {
     I2C_EXECUTE_CALLBACK,
 #endif // USE_I2C
 
-    GET_SLAVE_MATRIX_CHECKSUM,
-    GET_SLAVE_MATRIX_DATA,
+    GET_SLAVE_MATRIX_DELTA,
+
+#ifdef SPLIT_TRANSPORT_BATCH
+    PUT_BATCH_SIZE,
+    EXCHANGE_BATCH,
+#endif // SPLIT_TRANSPORT_BATCH
 
 #ifdef SPLIT_TRANSPORT_MIRROR
     PUT_MASTER_MATRIX,
@@ -67,6 +71,7 @@ enum serial_transaction_id {
 
 #if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
     PUT_RGB_MATRIX,
+    PUT_RGB_MATRIX_HITS,
 #endif // defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
 
 #if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
@@ -99,6 +104,10 @@ enum serial_transaction_id {
     PUT_ACTIVITY,
 #endif // SPLIT_ACTIVITY_ENABLE
 
+#if defined(SPLIT_BLOB_ENABLE)
+    PUT_BLOB_FRAGMENT,
+#endif // SPLIT_BLOB_ENABLE
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
     PUT_RPC_INFO,
     PUT_RPC_REQ_DATA,
@@ -27,6 +27,8 @@
 #include "wait.h"
 #include "transactions.h"
 #include "transport.h"
+#include "transport_batch.h"
+#include "split_link.h"
 #include "transaction_id_define.h"
 #include "split_util.h"
 #include "synchronization_util.h"
@@ -81,12 +83,21 @@
     { 0, 0, sizeof_member(split_shared_memory_t, member), offsetof(split_shared_memory_t, member), cb }
 #define trans_target2initiator_initializer(member) trans_target2initiator_initializer_cb(member, NULL)
 
+#define trans_bidirectional_initializer_cb(initiator2target_member, target2initiator_member, cb) \
+    { sizeof_member(split_shared_memory_t, initiator2target_member), offsetof(split_shared_memory_t, initiator2target_member), sizeof_member(split_shared_memory_t, target2initiator_member), offsetof(split_shared_memory_t, target2initiator_member), cb }
+
 #define trans_initiator2target_cb(cb) \
     { 0, 0, 0, 0, cb }
 
-#define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
-#define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
-#define transport_exec(id) transport_execute_transaction(id, NULL, 0, NULL, 0)
+#ifdef SPLIT_TRANSPORT_BATCH
+#    define transport_transaction(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length) transport_batch_execute(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length)
+#else
+#    define transport_transaction(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length) transport_execute_transaction(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length)
+#endif // SPLIT_TRANSPORT_BATCH
+
+#define transport_write(id, data, length) transport_transaction(id, data, length, NULL, 0)
+#define transport_read(id, data, length) transport_transaction(id, NULL, 0, data, length)
+#define transport_exec(id) transport_transaction(id, NULL, 0, NULL, 0)
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 // Forward-declare the RPC callback handlers
@@ -97,8 +108,8 @@ void slave_rpc_exec_callback(uint8_t initiator2target_buffer_size, const void *i
 ////////////////////////////////////////////////////
 // Helpers
 
-static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[], const char *prefix, bool (*handler)(matrix_row_t master_matrix[], matrix_row_t slave_matrix[])) {
-    int num_retries = is_transport_connected() ? 10 : 1;
+static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[], const char *prefix, bool retry, bool (*handler)(matrix_row_t master_matrix[], matrix_row_t slave_matrix[])) {
+    int num_retries = retry && is_transport_connected() ? 10 : 1;
     for (int iter = 1; iter <= num_retries; ++iter) {
         if (iter > 1) {
             for (int i = 0; i < iter * iter; ++i) {
@@ -113,10 +124,40 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
     return false;
 }
 
-#define TRANSACTION_HANDLER_MASTER(prefix)                                                                              \
-    do {                                                                                                                \
-        if (!transaction_handler_master(master_matrix, slave_matrix, #prefix, &prefix##_handlers_master)) return false; \
-    } while (0)
+#ifdef SPLIT_TRANSPORT_BATCH
+// The slave matrix is read last, so a failure earlier on is only noted, to not keep the matrix from being synced
+#    define TRANSACTION_HANDLER_MASTER(prefix)                                                                                                 \
+        do {                                                                                                                                   \
+            if (!transaction_handler_master(master_matrix, slave_matrix, #prefix, true, &prefix##_handlers_master)) transactions_okay = false; \
+        } while (0)
+#else
+#    define TRANSACTION_HANDLER_MASTER(prefix)                                                                                    \
+        do {                                                                                                                      \
+            if (!transaction_handler_master(master_matrix, slave_matrix, #prefix, true, &prefix##_handlers_master)) return false; \
+        } while (0)
+#endif // SPLIT_TRANSPORT_BATCH
+
+#ifdef SPLIT_LINK_BACKOFF
+// Whether backed off transactions are sent on this scan
+static bool background_due = true;
+
+/**
+ * @brief Constructs a transaction handler for transactions the slave can do
+ * without for a while, such as keeping its displays and lights up to date.
+ * While the link is backed off, they are only sent on some scans, with a
+ * single attempt, and a failure does not keep the matrix from being synced.
+ */
+#    define TRANSACTION_HANDLER_MASTER_BACKGROUND(prefix)                                                           \
+        do {                                                                                                        \
+            if (!split_link_backing_off()) {                                                                        \
+                TRANSACTION_HANDLER_MASTER(prefix);                                                                 \
+            } else if (background_due) {                                                                            \
+                transaction_handler_master(master_matrix, slave_matrix, #prefix, false, &prefix##_handlers_master); \
+            }                                                                                                       \
+        } while (0)
+#else
+#    define TRANSACTION_HANDLER_MASTER_BACKGROUND(prefix) TRANSACTION_HANDLER_MASTER(prefix)
+#endif // SPLIT_LINK_BACKOFF
 
 /**
  * @brief Constructs a transaction handler that doesn't acquire a lock to the
@@ -178,32 +219,102 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
 ////////////////////////////////////////////////////
 // Slave matrix
 
-static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t     last_update                    = 0;
-    static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
-    matrix_row_t        temp_matrix[(MATRIX_ROWS) / 2];       // holding area while we test whether or not checksum is correct
+static bool slave_matrix_poll(matrix_delta_initiator_t *state) {
+    matrix_delta_t delta;
+
+    // A single round trip acknowledges the last delta and fetches the next one
+    bool okay = transport_transaction(GET_SLAVE_MATRIX_DELTA, &state->ack, sizeof(state->ack), &delta, sizeof(delta));
+    if (okay && !matrix_delta_apply(state, &delta)) {
+        split_link_crc_error(GET_SLAVE_MATRIX_DELTA);
+        return false;
+    }
+    return okay;
+}
 
-    bool okay = read_if_checksum_mismatch(GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA, &last_update, temp_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+#ifdef SPLIT_TRANSPORT_PUSH
+
+#    ifdef DISABLE_SYNC_TIMER
+#        error "SPLIT_TRANSPORT_PUSH needs the sync timer, as key events are timed by the slave"
+#    endif
+
+static split_push_initiator_t slave_matrix_push = {0};
+
+static void slave_matrix_receive_pushes(matrix_row_t matrix[]) {
+    split_push_packet_t packet;
+    while (transport_receive_push(&packet)) {
+        split_push_apply(&slave_matrix_push, matrix, &packet);
+    }
+}
+
+static bool slave_matrix_push_poll(matrix_delta_initiator_t *state) {
+    // The slave pushes rows as they change, the matrix is only polled to catch up on any that went missing
+    slave_matrix_receive_pushes(state->matrix);
+    if (!split_push_poll_due(&slave_matrix_push, timer_read())) {
+        return true;
+    }
+
+    matrix_row_t before[MATRIX_DELTA_HALF_ROWS];
+    memcpy(before, state->matrix, sizeof(before));
+    bool okay = slave_matrix_poll(state);
     if (okay) {
-        // Checksum matches the received data, save as the last matrix state
-        memcpy(last_matrix, temp_matrix, sizeof(temp_matrix));
+        split_push_polled(&slave_matrix_push, before, state->matrix, timer_read());
     }
+
+    // Anything pushed while waiting for the delta is at least as new, so it goes on top
+    slave_matrix_receive_pushes(state->matrix);
+    return okay;
+}
+
+uint16_t transactions_key_event_time(uint8_t row, uint16_t now) {
+    // Rows of the other half come from the slave
+    uint8_t slave_row = MATRIX_DELTA_HALF_ROWS;
+    if ((row >= MATRIX_DELTA_HALF_ROWS) == isLeftHand) {
+        slave_row = row % MATRIX_DELTA_HALF_ROWS;
+    }
+    return split_push_event_time(&slave_matrix_push, slave_row, now);
+}
+
+#endif // SPLIT_TRANSPORT_PUSH
+
+static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static matrix_delta_initiator_t state = {0}; // last successfully-applied matrix, so we can replicate if there are errors
+
+#ifdef SPLIT_TRANSPORT_PUSH
+    bool okay = slave_matrix_push_poll(&state);
+#else
+    bool okay = slave_matrix_poll(&state);
+#endif // SPLIT_TRANSPORT_PUSH
+
     // Copy out the last-known-good matrix state to the slave matrix
-    memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
+    memcpy(slave_matrix, state.matrix, sizeof(state.matrix));
     return okay;
 }
 
 static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+#ifdef SPLIT_TRANSPORT_PUSH
+    // Push changed rows before they reach the shared memory, so no answer to the master is ever newer than what it was pushed
+    static split_push_target_t push = {0};
+    for (uint8_t row = 0; row < MATRIX_DELTA_HALF_ROWS; row++) {
+        if (slave_matrix[row] != split_shmem->smatrix.matrix[row]) {
+            split_push_packet_t packet;
+            split_push_build(&push, row, slave_matrix[row], sync_timer_read(), &packet);
+            transport_push(&packet);
+        }
+    }
+#endif // SPLIT_TRANSPORT_PUSH
     memcpy(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix));
-    split_shmem->smatrix.checksum = crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+}
+
+static void slave_matrix_delta_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    static matrix_delta_target_t state = {0};
+    matrix_delta_build(&state, split_shmem->smatrix.matrix, split_shmem->smatrix.ack, &split_shmem->smatrix.delta);
 }
 
 // clang-format off
 #define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
-    [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
-    [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
+    [GET_SLAVE_MATRIX_DELTA] = trans_bidirectional_initializer_cb(smatrix.ack, smatrix.delta, slave_matrix_delta_callback),
 // clang-format on
 
 ////////////////////////////////////////////////////
@@ -481,7 +592,7 @@ static void backlight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
     backlight_level_noeeprom(backlight_level);
 }
 
-#    define TRANSACTIONS_BACKLIGHT_MASTER() TRANSACTION_HANDLER_MASTER(backlight)
+#    define TRANSACTIONS_BACKLIGHT_MASTER() TRANSACTION_HANDLER_MASTER_BACKGROUND(backlight)
 #    define TRANSACTIONS_BACKLIGHT_SLAVE() TRANSACTION_HANDLER_SLAVE(backlight)
 #    define TRANSACTIONS_BACKLIGHT_REGISTRATIONS [PUT_BACKLIGHT] = trans_initiator2target_initializer(backlight_level),
 
@@ -523,7 +634,7 @@ static void rgblight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
     }
 }
 
-#    define TRANSACTIONS_RGBLIGHT_MASTER() TRANSACTION_HANDLER_MASTER(rgblight)
+#    define TRANSACTIONS_RGBLIGHT_MASTER() TRANSACTION_HANDLER_MASTER_BACKGROUND(rgblight)
 #    define TRANSACTIONS_RGBLIGHT_SLAVE() TRANSACTION_HANDLER_SLAVE(rgblight)
 #    define TRANSACTIONS_RGBLIGHT_REGISTRATIONS [PUT_RGBLIGHT] = trans_initiator2target_initializer(rgblight_sync),
 
@@ -557,7 +668,7 @@ static void led_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
     led_matrix_set_suspend_state(led_suspend_state);
 }
 
-#    define TRANSACTIONS_LED_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(led_matrix)
+#    define TRANSACTIONS_LED_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER_BACKGROUND(led_matrix)
 #    define TRANSACTIONS_LED_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(led_matrix)
 #    define TRANSACTIONS_LED_MATRIX_REGISTRATIONS [PUT_LED_MATRIX] = trans_initiator2target_initializer(led_matrix_sync),
 
@@ -574,26 +685,62 @@ static void led_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 
 #if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
+// The master sends its key events at least every FORCED_SYNC_THROTTLE_MS, going longer without means it may have been reset
+#    ifndef RGB_MATRIX_SPLIT_HITS_GAP_MS
+#        define RGB_MATRIX_SPLIT_HITS_GAP_MS (FORCED_SYNC_THROTTLE_MS * 5)
+#    endif
+
+static bool rgb_matrix_hits_received = false;
+
 static bool rgb_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t   last_update = 0;
+    static uint32_t   last_update      = 0;
+    static uint32_t   last_hits_update = 0;
     rgb_matrix_sync_t rgb_matrix_sync;
+    rgb_matrix_hits_t rgb_matrix_hits;
     memcpy(&rgb_matrix_sync.rgb_matrix, &rgb_matrix_config, sizeof(rgb_config_t));
     rgb_matrix_sync.rgb_suspend_state = rgb_matrix_get_suspend_state();
-    return send_if_data_mismatch(PUT_RGB_MATRIX, &last_update, &rgb_matrix_sync, &split_shmem->rgb_matrix_sync, sizeof(rgb_matrix_sync));
+    rgb_matrix_get_split_hits(&rgb_matrix_hits);
+
+    bool okay = send_if_data_mismatch(PUT_RGB_MATRIX, &last_update, &rgb_matrix_sync, &split_shmem->rgb_matrix_sync, sizeof(rgb_matrix_sync));
+    if (okay) {
+        // Only the key events, the slave renders its own half from them
+        okay &= send_if_data_mismatch(PUT_RGB_MATRIX_HITS, &last_hits_update, &rgb_matrix_hits, &split_shmem->rgb_matrix_hits, sizeof(rgb_matrix_hits));
+    }
+    return okay;
 }
 
 static void rgb_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint32_t   last_hits_update = 0;
+    rgb_matrix_hits_t rgb_matrix_hits;
     split_shared_memory_lock();
     memcpy(&rgb_matrix_config, &split_shmem->rgb_matrix_sync.rgb_matrix, sizeof(rgb_config_t));
-    bool rgb_suspend_state = split_shmem->rgb_matrix_sync.rgb_suspend_state;
+    bool rgb_suspend_state   = split_shmem->rgb_matrix_sync.rgb_suspend_state;
+    bool hits_received       = rgb_matrix_hits_received;
+    rgb_matrix_hits_received = false;
+    memcpy(&rgb_matrix_hits, &split_shmem->rgb_matrix_hits, sizeof(rgb_matrix_hits));
     split_shared_memory_unlock();
 
     rgb_matrix_set_suspend_state(rgb_suspend_state);
+    if (hits_received) {
+        if (timer_elapsed32(last_hits_update) >= RGB_MATRIX_SPLIT_HITS_GAP_MS) {
+            rgb_matrix_resync_split_hits();
+        }
+        last_hits_update = timer_read32();
+        rgb_matrix_set_split_hits(&rgb_matrix_hits);
+    }
 }
 
-#    define TRANSACTIONS_RGB_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(rgb_matrix)
+static void rgb_matrix_hits_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    rgb_matrix_hits_received = true;
+}
+
+// clang-format off
+#    define TRANSACTIONS_RGB_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER_BACKGROUND(rgb_matrix)
 #    define TRANSACTIONS_RGB_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(rgb_matrix)
-#    define TRANSACTIONS_RGB_MATRIX_REGISTRATIONS [PUT_RGB_MATRIX] = trans_initiator2target_initializer(rgb_matrix_sync),
+#    define TRANSACTIONS_RGB_MATRIX_REGISTRATIONS \
+    [PUT_RGB_MATRIX]      = trans_initiator2target_initializer(rgb_matrix_sync), \
+    [PUT_RGB_MATRIX_HITS] = trans_initiator2target_initializer_cb(rgb_matrix_hits, rgb_matrix_hits_callback),
+// clang-format on
 
 #else // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
@@ -618,7 +765,7 @@ static void wpm_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_
     set_current_wpm(split_shmem->current_wpm);
 }
 
-#    define TRANSACTIONS_WPM_MASTER() TRANSACTION_HANDLER_MASTER(wpm)
+#    define TRANSACTIONS_WPM_MASTER() TRANSACTION_HANDLER_MASTER_BACKGROUND(wpm)
 #    define TRANSACTIONS_WPM_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(wpm)
 #    define TRANSACTIONS_WPM_REGISTRATIONS [PUT_WPM] = trans_initiator2target_initializer(current_wpm),
 
@@ -653,7 +800,7 @@ static void oled_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
     }
 }
 
-#    define TRANSACTIONS_OLED_MASTER() TRANSACTION_HANDLER_MASTER(oled)
+#    define TRANSACTIONS_OLED_MASTER() TRANSACTION_HANDLER_MASTER_BACKGROUND(oled)
 #    define TRANSACTIONS_OLED_SLAVE() TRANSACTION_HANDLER_SLAVE(oled)
 #    define TRANSACTIONS_OLED_REGISTRATIONS [PUT_OLED] = trans_initiator2target_initializer(current_oled_state),
 
@@ -688,7 +835,7 @@ static void st7565_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
     }
 }
 
-#    define TRANSACTIONS_ST7565_MASTER() TRANSACTION_HANDLER_MASTER(st7565)
+#    define TRANSACTIONS_ST7565_MASTER() TRANSACTION_HANDLER_MASTER_BACKGROUND(st7565)
 #    define TRANSACTIONS_ST7565_SLAVE() TRANSACTION_HANDLER_SLAVE(st7565)
 #    define TRANSACTIONS_ST7565_REGISTRATIONS [PUT_ST7565] = trans_initiator2target_initializer(current_st7565_state),
 
@@ -844,7 +991,7 @@ static void haptic_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
 }
 
 // clang-format off
-#    define TRANSACTIONS_HAPTIC_MASTER() TRANSACTION_HANDLER_MASTER(haptic)
+#    define TRANSACTIONS_HAPTIC_MASTER() TRANSACTION_HANDLER_MASTER_BACKGROUND(haptic)
 #    define TRANSACTIONS_HAPTIC_SLAVE() TRANSACTION_HANDLER_SLAVE(haptic)
 #    define TRANSACTIONS_HAPTIC_REGISTRATIONS [PUT_HAPTIC] = trans_initiator2target_initializer(haptic_sync),
 // clang-format on
@@ -873,7 +1020,7 @@ static void activity_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 }
 
 // clang-format off
-#    define TRANSACTIONS_ACTIVITY_MASTER() TRANSACTION_HANDLER_MASTER(activity)
+#    define TRANSACTIONS_ACTIVITY_MASTER() TRANSACTION_HANDLER_MASTER_BACKGROUND(activity)
 #    define TRANSACTIONS_ACTIVITY_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(activity)
 #    define TRANSACTIONS_ACTIVITY_REGISTRATIONS [PUT_ACTIVITY] = trans_initiator2target_initializer(activity_sync),
 // clang-format on
@@ -886,6 +1033,89 @@ static void activity_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 
 #endif // defined(SPLIT_ACTIVITY_ENABLE)
 
+////////////////////////////////////////////////////
+// Blobs
+
+#if defined(SPLIT_BLOB_ENABLE)
+
+static split_blob_sender_t   blob_sender   = {0};
+static split_blob_receiver_t blob_receiver = {0};
+static bool                  blob_received = false;
+
+bool transaction_blob_send(uint8_t channel, const void *data, uint16_t length) {
+    return split_blob_start(&blob_sender, channel, data, length);
+}
+
+bool transaction_blob_pending(void) {
+    return split_blob_pending(&blob_sender);
+}
+
+__attribute__((weak)) void split_blob_received_user(uint8_t channel, const void *data, uint16_t length) {}
+
+__attribute__((weak)) void split_blob_received_kb(uint8_t channel, const void *data, uint16_t length) {
+    split_blob_received_user(channel, data, length);
+}
+
+static bool blob_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    split_blob_fragment_t fragment;
+    split_blob_ack_t      ack;
+
+    // A fragment per scan, so a large blob never holds a scan up for long
+    if (!split_blob_next(&blob_sender, &fragment)) {
+        return true;
+    }
+    bool okay = transport_transaction(PUT_BLOB_FRAGMENT, &fragment, sizeof(fragment), &ack, sizeof(ack));
+    if (okay) {
+        // An answer that does not match leaves the fragment to be sent again
+        split_blob_acknowledge(&blob_sender, &ack);
+    }
+    return okay;
+}
+
+static void blob_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    uint8_t  data[SPLIT_BLOB_MAX_SIZE];
+    uint16_t length  = 0;
+    uint8_t  channel = 0;
+    bool     okay    = false;
+
+    split_shared_memory_lock();
+    if (blob_received) {
+        blob_received = false;
+        channel       = blob_receiver.channel;
+        okay          = split_blob_read(&blob_receiver, data, sizeof(data), &length);
+    }
+    split_shared_memory_unlock();
+
+    // Handed out here rather than from the transaction, so it runs without holding up the transport
+    if (okay) {
+        split_blob_received_kb(channel, data, length);
+    }
+}
+
+static void blob_fragment_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const split_blob_fragment_t *fragment = initiator2target_buffer;
+
+    // The next blob waits until the last one was handed out, the master sees its fragments go unacknowledged
+    if (blob_received && fragment->payload.seq != blob_receiver.seq) {
+        return;
+    }
+    if (split_blob_receive(&blob_receiver, fragment, target2initiator_buffer)) {
+        blob_received = true;
+    }
+}
+
+#    define TRANSACTIONS_BLOB_MASTER() TRANSACTION_HANDLER_MASTER_BACKGROUND(blob)
+#    define TRANSACTIONS_BLOB_SLAVE() TRANSACTION_HANDLER_SLAVE(blob)
+#    define TRANSACTIONS_BLOB_REGISTRATIONS [PUT_BLOB_FRAGMENT] = trans_bidirectional_initializer_cb(blob.fragment, blob.ack, blob_fragment_callback),
+
+#else // defined(SPLIT_BLOB_ENABLE)
+
+#    define TRANSACTIONS_BLOB_MASTER()
+#    define TRANSACTIONS_BLOB_SLAVE()
+#    define TRANSACTIONS_BLOB_REGISTRATIONS
+
+#endif // defined(SPLIT_BLOB_ENABLE)
+
 ////////////////////////////////////////////////////
 // Detected OS
 
@@ -902,7 +1132,7 @@ static void detected_os_handlers_slave(matrix_row_t master_matrix[], matrix_row_
     slave_update_detected_host_os(split_shmem->detected_os);
 }
 
-#    define TRANSACTIONS_DETECTED_OS_MASTER() TRANSACTION_HANDLER_MASTER(detected_os)
+#    define TRANSACTIONS_DETECTED_OS_MASTER() TRANSACTION_HANDLER_MASTER_BACKGROUND(detected_os)
 #    define TRANSACTIONS_DETECTED_OS_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(detected_os)
 #    define TRANSACTIONS_DETECTED_OS_REGISTRATIONS [PUT_DETECTED_OS] = trans_initiator2target_initializer(detected_os),
 
@@ -924,6 +1154,11 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     [I2C_EXECUTE_CALLBACK] = trans_initiator2target_initializer(transaction_id),
 #endif // USE_I2C
 
+#ifdef SPLIT_TRANSPORT_BATCH
+    [PUT_BATCH_SIZE] = trans_initiator2target_initializer_cb(batch.size, transport_batch_size_callback),
+    [EXCHANGE_BATCH] = trans_bidirectional_initializer_cb(batch.request, batch.response, transport_batch_slave_callback),
+#endif // SPLIT_TRANSPORT_BATCH
+
     // clang-format off
     TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS
     TRANSACTIONS_MASTER_MATRIX_REGISTRATIONS
@@ -943,6 +1178,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_WATCHDOG_REGISTRATIONS
     TRANSACTIONS_HAPTIC_REGISTRATIONS
     TRANSACTIONS_ACTIVITY_REGISTRATIONS
+    TRANSACTIONS_BLOB_REGISTRATIONS
     TRANSACTIONS_DETECTED_OS_REGISTRATIONS
 // clang-format on
 
@@ -955,7 +1191,15 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 };
 
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+#ifdef SPLIT_TRANSPORT_BATCH
+    bool transactions_okay = true;
+#endif // SPLIT_TRANSPORT_BATCH
+#ifdef SPLIT_LINK_BACKOFF
+    background_due = split_link_backoff_due();
+#endif // SPLIT_LINK_BACKOFF
+#ifndef SPLIT_TRANSPORT_BATCH
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
+#endif // SPLIT_TRANSPORT_BATCH
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
     TRANSACTIONS_SYNC_TIMER_MASTER();
@@ -973,8 +1217,17 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_WATCHDOG_MASTER();
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
+    TRANSACTIONS_BLOB_MASTER();
     TRANSACTIONS_DETECTED_OS_MASTER();
+#ifdef SPLIT_TRANSPORT_BATCH
+    // Reading the slave matrix last sends everything queued above in the same frame
+    TRANSACTIONS_SLAVE_MATRIX_MASTER();
+    // Sends what is still queued on scans the slave matrix is not polled on
+    if (!transport_batch_flush()) transactions_okay = false;
+    return transactions_okay;
+#else
     return true;
+#endif // SPLIT_TRANSPORT_BATCH
 }
 
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -996,6 +1249,7 @@ void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[
     TRANSACTIONS_WATCHDOG_SLAVE();
     TRANSACTIONS_HAPTIC_SLAVE();
     TRANSACTIONS_ACTIVITY_SLAVE();
+    TRANSACTIONS_BLOB_SLAVE();
     TRANSACTIONS_DETECTED_OS_SLAVE();
 }
 
@@ -1047,6 +1301,12 @@ bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer
     if (!transport_read(GET_RPC_RESP_DATA, target2initiator_buffer, target2initiator_buffer_size)) {
         return false;
     }
+#ifdef SPLIT_TRANSPORT_BATCH
+    // An RPC without a response is still queued, make sure it ran before returning
+    if (!transport_batch_flush()) {
+        return false;
+    }
+#endif // SPLIT_TRANSPORT_BATCH
     return true;
 }
 
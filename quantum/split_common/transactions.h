@@ -45,6 +45,22 @@ extern split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS];
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 
+#ifdef SPLIT_BLOB_ENABLE
+// starts sending a blob of up to SPLIT_BLOB_MAX_SIZE bytes to the slave, replacing any still in flight
+bool transaction_blob_send(uint8_t channel, const void *data, uint16_t length);
+// whether the slave is still missing part of the last blob sent
+bool transaction_blob_pending(void);
+
+// called on the slave with each blob the master sent
+void split_blob_received_kb(uint8_t channel, const void *data, uint16_t length);
+void split_blob_received_user(uint8_t channel, const void *data, uint16_t length);
+#endif // SPLIT_BLOB_ENABLE
+
+#ifdef SPLIT_TRANSPORT_PUSH
+// returns the time of a key event on a matrix row, as timed by the half it came from
+uint16_t transactions_key_event_time(uint8_t row, uint16_t now);
+#endif // SPLIT_TRANSPORT_PUSH
+
 void transaction_register_rpc(int8_t transaction_id, slave_callback_t callback);
 
 bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
@@ -21,10 +21,15 @@
 #include "transactions.h"
 #include "transport.h"
 #include "transaction_id_define.h"
+#include "split_link.h"
 #include "atomic_util.h"
 
 #ifdef USE_I2C
 
+#    ifdef SPLIT_TRANSPORT_PUSH
+#        error "SPLIT_TRANSPORT_PUSH is not supported over I2C, the slave cannot start a transfer"
+#    endif
+
 #    ifndef SLAVE_I2C_TIMEOUT
 #        define SLAVE_I2C_TIMEOUT 100
 #    endif // SLAVE_I2C_TIMEOUT
@@ -60,7 +65,7 @@ i2c_status_t transport_trigger_callback(int8_t id) {
     return i2c_write_register(SLAVE_I2C_ADDRESS, trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size, SLAVE_I2C_TIMEOUT);
 }
 
-bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+bool transport_exchange(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
     i2c_status_t              status;
     split_transaction_desc_t *trans = &split_transaction_table[id];
     if (initiator2target_length > 0) {
@@ -101,7 +106,7 @@ void transport_slave_init(void) {
     soft_serial_target_init();
 }
 
-bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+bool transport_exchange(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
     split_transaction_desc_t *trans = &split_transaction_table[id];
     if (initiator2target_length > 0) {
         size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
@@ -120,8 +125,26 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
     return true;
 }
 
+#    ifdef SPLIT_TRANSPORT_PUSH
+bool transport_push(const split_push_packet_t *packet) {
+    return soft_serial_push(packet);
+}
+
+bool transport_receive_push(split_push_packet_t *packet) {
+    return soft_serial_receive_push(packet);
+}
+#    endif // SPLIT_TRANSPORT_PUSH
+
 #endif // USE_I2C
 
+bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+#if defined(SPLIT_LINK_STATS_ENABLE) || defined(SPLIT_LINK_BACKOFF)
+    return split_link_exchange(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+#else
+    return transport_exchange(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+#endif
+}
+
 bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     return transactions_master(master_matrix, slave_matrix);
 }
@@ -22,6 +22,10 @@
 #include "progmem.h"
 #include "action_layer.h"
 #include "matrix.h"
+#include "matrix_delta.h"
+#include "transport_batch.h"
+#include "split_push.h"
+#include "split_blob.h"
 
 #ifndef RPC_M2S_BUFFER_SIZE
 #    define RPC_M2S_BUFFER_SIZE 32
@@ -39,6 +43,15 @@ bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[])
 void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 
 bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length);
+// moves the buffers of a transaction over the wire, transport_execute_transaction() adds the link bookkeeping on top
+bool transport_exchange(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length);
+
+#ifdef SPLIT_TRANSPORT_PUSH
+// sends a packet from the slave outside of a transaction
+bool transport_push(const split_push_packet_t *packet);
+// takes a packet the slave pushed, false if there is none
+bool transport_receive_push(split_push_packet_t *packet);
+#endif // SPLIT_TRANSPORT_PUSH
 
 #ifdef ENCODER_ENABLE
 #    include "encoder.h"
@@ -53,10 +66,19 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 #endif // RGBLIGHT_ENABLE
 
 typedef struct _split_slave_matrix_sync_t {
-    uint8_t      checksum;
-    matrix_row_t matrix[(MATRIX_ROWS) / 2];
+    uint8_t        ack;
+    matrix_delta_t delta;
+    matrix_row_t   matrix[(MATRIX_ROWS) / 2];
 } split_slave_matrix_sync_t;
 
+#ifdef SPLIT_TRANSPORT_BATCH
+typedef struct _split_batch_sync_t {
+    split_batch_size_t  size;
+    split_batch_frame_t request;
+    split_batch_frame_t response;
+} split_batch_sync_t;
+#endif // SPLIT_TRANSPORT_BATCH
+
 #ifdef SPLIT_TRANSPORT_MIRROR
 typedef struct _split_master_matrix_sync_t {
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
@@ -132,6 +154,13 @@ typedef struct _split_slave_activity_sync_t {
 } split_slave_activity_sync_t;
 #endif // defined(SPLIT_ACTIVITY_ENABLE)
 
+#if defined(SPLIT_BLOB_ENABLE)
+typedef struct _split_blob_sync_t {
+    split_blob_fragment_t fragment;
+    split_blob_ack_t      ack;
+} split_blob_sync_t;
+#endif // defined(SPLIT_BLOB_ENABLE)
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 typedef struct _rpc_sync_info_t {
     uint8_t checksum;
@@ -154,6 +183,10 @@ typedef struct _split_shared_memory_t {
 
     split_slave_matrix_sync_t smatrix;
 
+#ifdef SPLIT_TRANSPORT_BATCH
+    split_batch_sync_t batch;
+#endif // SPLIT_TRANSPORT_BATCH
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     split_master_matrix_sync_t mmatrix;
 #endif // SPLIT_TRANSPORT_MIRROR
@@ -192,6 +225,7 @@ typedef struct _split_shared_memory_t {
 
 #if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
     rgb_matrix_sync_t rgb_matrix_sync;
+    rgb_matrix_hits_t rgb_matrix_hits;
 #endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
 #if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
@@ -222,6 +256,10 @@ typedef struct _split_shared_memory_t {
     split_slave_activity_sync_t activity_sync;
 #endif // defined(SPLIT_ACTIVITY_ENABLE)
 
+#if defined(SPLIT_BLOB_ENABLE)
+    split_blob_sync_t blob;
+#endif // defined(SPLIT_BLOB_ENABLE)
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
     rpc_sync_info_t rpc_info;
     uint8_t         rpc_m2s_buffer[RPC_M2S_BUFFER_SIZE];
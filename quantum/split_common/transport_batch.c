@@ -0,0 +1,219 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stddef.h>
+#include <string.h>
+
+#include "transport_batch.h"
+#include "transactions.h"
+#include "transport.h"
+#include "split_link.h"
+#include "crc.h"
+
+#ifdef SPLIT_TRANSPORT_BATCH
+
+// The frame the master is filling
+static split_batch_frame_t batch_request = {0};
+// Whether the slave is known to use the frame sizes in the master's table
+static bool batch_size_agreed = false;
+
+#define BATCH_FRAME_HEADER offsetof(split_batch_frame_t, data)
+
+static uint8_t batch_checksum(const split_batch_frame_t *frame) {
+    return crc8(&frame->length, sizeof(frame->length) + frame->length);
+}
+
+static split_batch_record_t *batch_record(split_batch_frame_t *frame, uint16_t offset) {
+    return (split_batch_record_t *)&frame->data[offset];
+}
+
+static uint8_t batch_record_size(const split_batch_record_t *record) {
+    return sizeof(split_batch_record_t) + record->initiator2target_length;
+}
+
+// What the slave answers the queued transactions with, and where the answer of the last one starts
+static uint8_t batch_response_length(uint8_t *last_response) {
+    uint8_t length = 0;
+    for (uint16_t offset = 0; offset < batch_request.length;) {
+        split_batch_record_t *record = batch_record(&batch_request, offset);
+        *last_response               = length;
+        length += record->target2initiator_length;
+        offset += batch_record_size(record);
+    }
+    return length;
+}
+
+static uint8_t batch_size_checksum(const split_batch_size_t *size) {
+    return crc8(&size->request, sizeof(*size) - offsetof(split_batch_size_t, request));
+}
+
+// Has both halves size the frames for an exchange, unless the sizes in use fit it with less padding than resizing costs
+static bool batch_resize(uint8_t request_size, uint8_t response_size) {
+    split_transaction_desc_t *trans = &split_transaction_table[EXCHANGE_BATCH];
+    if (batch_size_agreed && request_size <= trans->initiator2target_buffer_size && response_size <= trans->target2initiator_buffer_size && trans->initiator2target_buffer_size - request_size + trans->target2initiator_buffer_size - response_size <= sizeof(split_batch_size_t)) {
+        return true;
+    }
+
+    split_batch_size_t size = {.request = request_size, .response = response_size};
+    size.checksum           = batch_size_checksum(&size);
+    if (!transport_execute_transaction(PUT_BATCH_SIZE, &size, sizeof(size), NULL, 0)) {
+        return false;
+    }
+    trans->initiator2target_buffer_size = request_size;
+    trans->target2initiator_buffer_size = response_size;
+    batch_size_agreed                   = true;
+    return true;
+}
+
+static bool batch_exchange(void *target2initiator_buf) {
+    split_batch_frame_t response;
+    uint8_t             last_response = 0;
+
+    // A transaction alone gains nothing from a frame
+    split_batch_record_t *first = batch_record(&batch_request, 0);
+    if (batch_record_size(first) == batch_request.length) {
+        if (!transport_execute_transaction(first->id, first + 1, first->initiator2target_length, target2initiator_buf, first->target2initiator_length)) {
+            return false;
+        }
+        batch_request.length = 0;
+        return true;
+    }
+
+    uint8_t response_length = batch_response_length(&last_response);
+    if (!batch_resize(BATCH_FRAME_HEADER + batch_request.length, BATCH_FRAME_HEADER + response_length)) {
+        return false;
+    }
+
+    batch_request.checksum = batch_checksum(&batch_request);
+    bool okay              = transport_execute_transaction(EXCHANGE_BATCH, &batch_request, BATCH_FRAME_HEADER + batch_request.length, &response, BATCH_FRAME_HEADER + response_length);
+    if (okay && (response.length != response_length || response.checksum != batch_checksum(&response))) {
+        split_link_crc_error(EXCHANGE_BATCH);
+        okay = false;
+    }
+    if (!okay) {
+        // The halves may disagree on the frame sizes, send them again before the next frame
+        batch_size_agreed = false;
+        return false;
+    }
+
+    if (target2initiator_buf) {
+        memcpy(target2initiator_buf, &response.data[last_response], response.length - last_response);
+    }
+    batch_request.length = 0;
+    return true;
+}
+
+// Takes the last record off the queue
+static void batch_drop_last(void) {
+    uint16_t last = 0;
+    for (uint16_t offset = 0; offset < batch_request.length; offset += batch_record_size(batch_record(&batch_request, offset))) {
+        last = offset;
+    }
+    batch_request.length = last;
+}
+
+static bool batch_add(int8_t id, const void *initiator2target_buf, uint8_t initiator2target_length, uint8_t target2initiator_length) {
+    // A write queued again before the frame went out only needs its latest data, reads always go last as their answer is taken from there
+    split_batch_record_t *record = NULL;
+    for (uint16_t offset = 0; target2initiator_length == 0 && offset < batch_request.length; offset += batch_record_size(record)) {
+        record = batch_record(&batch_request, offset);
+        if (record->id == id && record->initiator2target_length == initiator2target_length && record->target2initiator_length == 0) {
+            memcpy(record + 1, initiator2target_buf, initiator2target_length);
+            return true;
+        }
+    }
+
+    uint8_t size = sizeof(split_batch_record_t) + initiator2target_length;
+    uint8_t last_response;
+    if ((batch_request.length + size > sizeof(batch_request.data) || batch_response_length(&last_response) + target2initiator_length > sizeof(batch_request.data)) && !transport_batch_flush()) {
+        return false;
+    }
+
+    record                          = batch_record(&batch_request, batch_request.length);
+    record->id                      = id;
+    record->initiator2target_length = initiator2target_length;
+    record->target2initiator_length = target2initiator_length;
+    memcpy(record + 1, initiator2target_buf, initiator2target_length);
+    batch_request.length += size;
+    return true;
+}
+
+bool transport_batch_execute(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    if (initiator2target_length > trans->initiator2target_buffer_size) initiator2target_length = trans->initiator2target_buffer_size;
+    if (target2initiator_length > trans->target2initiator_buffer_size) target2initiator_length = trans->target2initiator_buffer_size;
+
+    // Too large for a frame, send it on its own after what is queued
+    if (sizeof(split_batch_record_t) + initiator2target_length > sizeof(batch_request.data) || target2initiator_length > sizeof(batch_request.data)) {
+        return transport_batch_flush() && transport_execute_transaction(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+    }
+
+    // Keep the local copy in step, as the handlers compare against it
+    if (initiator2target_length > 0) {
+        memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, initiator2target_length);
+    }
+
+    if (!batch_add(id, initiator2target_buf, initiator2target_length, target2initiator_length)) {
+        return false;
+    }
+    // Only transactions that answer send the frame right away
+    if (target2initiator_length == 0) {
+        return true;
+    }
+    if (!batch_exchange(target2initiator_buf)) {
+        // The writes are kept for the next attempt, the caller asks again if it still needs the answer
+        batch_drop_last();
+        return false;
+    }
+    return true;
+}
+
+bool transport_batch_flush(void) {
+    return batch_request.length == 0 || batch_exchange(NULL);
+}
+
+void transport_batch_size_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const split_batch_size_t *size = initiator2target_buffer;
+    if (size->checksum != batch_size_checksum(size) || size->request < BATCH_FRAME_HEADER || size->request > sizeof(split_batch_frame_t) || size->response < BATCH_FRAME_HEADER || size->response > sizeof(split_batch_frame_t)) {
+        return;
+    }
+
+    split_transaction_desc_t *trans     = &split_transaction_table[EXCHANGE_BATCH];
+    trans->initiator2target_buffer_size = size->request;
+    trans->target2initiator_buffer_size = size->response;
+}
+
+void transport_batch_slave_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const split_batch_frame_t *request  = initiator2target_buffer;
+    split_batch_frame_t       *response = target2initiator_buffer;
+    uint8_t                    room     = target2initiator_buffer_size - BATCH_FRAME_HEADER;
+    response->length                    = 0;
+
+    // Only as much of the frame as the sizes in use was received
+    bool okay = BATCH_FRAME_HEADER + request->length <= initiator2target_buffer_size && request->checksum == batch_checksum(request);
+    for (uint16_t offset = 0; okay && offset < request->length;) {
+        const split_batch_record_t *record = (const split_batch_record_t *)&request->data[offset];
+        okay                               = offset + sizeof(split_batch_record_t) <= request->length;
+        if (!okay) break;
+        offset += batch_record_size(record);
+
+        // Sizes are checked as each transaction runs, an earlier one may have changed them (as for RPCs)
+        okay = offset <= request->length && record->id >= 0 && record->id < NUM_TOTAL_TRANSACTIONS && record->id != EXCHANGE_BATCH && record->id != PUT_BATCH_SIZE;
+        if (!okay) break;
+        split_transaction_desc_t *trans = &split_transaction_table[record->id];
+        okay                            = record->initiator2target_length <= trans->initiator2target_buffer_size && record->target2initiator_length <= trans->target2initiator_buffer_size && response->length + record->target2initiator_length <= room;
+        if (!okay) break;
+
+        memcpy(split_trans_initiator2target_buffer(trans), record + 1, record->initiator2target_length);
+        if (trans->slave_callback) {
+            trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+        }
+        memcpy(&response->data[response->length], split_trans_target2initiator_buffer(trans), record->target2initiator_length);
+        response->length += record->target2initiator_length;
+    }
+
+    // A frame that failed its checks is answered with one that fails too
+    response->checksum = batch_checksum(response) ^ (okay ? 0 : 0xFF);
+}
+
+#endif // SPLIT_TRANSPORT_BATCH
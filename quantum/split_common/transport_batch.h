@@ -0,0 +1,78 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Packs the transactions of a scan into frames sent over the split link in
+    a single EXCHANGE_BATCH transaction, enabled with SPLIT_TRANSPORT_BATCH.
+
+    Transactions that only send are queued. One the master needs an answer
+    from sends the frame, so everything queued before it travels in the same
+    exchange. The slave checks the frame, runs each transaction in order
+    as if it had arrived on its own, and answers with their responses in a
+    frame of its own. Each frame carries a crc8.
+
+    The transports only move buffers of a size both halves agree on, so
+    before a frame that does not fit the sizes in use, or would mostly be
+    padding, the master sends the new sizes with PUT_BATCH_SIZE. They are
+    sent again after any failed exchange, in case the halves fell out of
+    step. A transaction alone in the queue is sent on its own, so a scan
+    that only polls the slave matrix costs what it does without batching.
+*/
+
+/* Bytes of transactions a frame holds. */
+#ifndef SPLIT_TRANSPORT_BATCH_SIZE
+#    define SPLIT_TRANSPORT_BATCH_SIZE 32
+#endif
+// A whole frame has to fit the 8-bit buffer sizes of a transaction
+#if SPLIT_TRANSPORT_BATCH_SIZE > 253
+#    error "SPLIT_TRANSPORT_BATCH_SIZE is limited to 253 bytes"
+#endif
+
+typedef struct {
+    uint8_t checksum; // crc8 of the length and the data used
+    uint8_t length;
+    uint8_t data[SPLIT_TRANSPORT_BATCH_SIZE];
+} split_batch_frame_t;
+
+// The sizes of the frames EXCHANGE_BATCH moves, header included
+typedef struct {
+    uint8_t checksum; // crc8 of the sizes
+    uint8_t request;
+    uint8_t response;
+} split_batch_size_t;
+
+// Each transaction in a request frame starts with this header, followed by what the master sends
+typedef struct {
+    int8_t  id;
+    uint8_t initiator2target_length;
+    uint8_t target2initiator_length;
+} split_batch_record_t;
+
+/**
+ * @brief Adds a transaction to the frame, and sends the frame if the transaction answers.
+ *
+ * Transactions too large for a frame are sent on their own, after the frame.
+ *
+ * @return false if the exchange failed, the queued writes are kept for the next attempt
+ */
+bool transport_batch_execute(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length);
+
+/**
+ * @brief Sends what is queued, if anything.
+ */
+bool transport_batch_flush(void);
+
+/**
+ * @brief Takes the frame sizes the master sent on the slave, registered for PUT_BATCH_SIZE.
+ */
+void transport_batch_size_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
+
+/**
+ * @brief Runs the transactions of a request frame on the slave, registered for EXCHANGE_BATCH.
+ */
+void transport_batch_slave_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
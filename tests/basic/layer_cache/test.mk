@@ -0,0 +1,5 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Run the basic tests again with the resolved layer cache enabled
+SRC += $(wildcard tests/basic/*.cpp)
@@ -0,0 +1,112 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <iostream>
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+class LayerLookup : public TestFixture {
+   protected:
+    static constexpr uint8_t deep_layers = 16;
+
+    /**
+     * @brief Maps `key` on layer 0 and KC_TRNS at the same position on all
+     * layers above it, then turns all of those layers on.
+     */
+    void set_deep_transparent_stack(std::initializer_list<KeymapKey> keys) {
+        set_keymap(keys);
+        for (const KeymapKey& key : keys) {
+            for (uint8_t layer = 1; layer < deep_layers; layer++) {
+                add_key(KeymapKey(layer, key.position.col, key.position.row, KC_TRANSPARENT));
+            }
+        }
+        layer_state_set(((layer_state_t)1 << deep_layers) - 2);
+    }
+};
+
+TEST_F(LayerLookup, KeyFallsThroughDeepTransparentStack) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_deep_transparent_stack({key});
+    EXPECT_EQ(layer_switch_get_layer(key.position), 0);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerLookup, LayerChangeIsPickedUp) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(1, 0, 0, KC_B);
+
+    set_keymap({key_a, key_b});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 1);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_b);
+
+    layer_off(1);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerLookup, DefaultLayerChangeIsPickedUp) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(2, 0, 0, KC_B);
+
+    set_keymap({key_a, key_b});
+
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+    default_layer_set((layer_state_t)1 << 2);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 2);
+    default_layer_set((layer_state_t)1 << 0);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerLookup, BenchmarkDeepLayerStack) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+    auto       key_c = KeymapKey(0, 2, 1, KC_C);
+
+    set_deep_transparent_stack({key_a, key_b, key_c});
+
+    constexpr unsigned taps  = 2000;
+    auto               start = std::chrono::steady_clock::now();
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    for (unsigned i = 0; i < taps; i++) {
+        tap_keys(key_a, key_b, key_c);
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    VERIFY_AND_CLEAR(driver);
+
+    double events_per_second = (taps * 3 * 2) / (elapsed.count() / 1e9);
+    RecordProperty("events_per_second", std::to_string(static_cast<uint64_t>(events_per_second)));
+#if defined(LAYER_CACHE_ENABLE)
+    const char* mode = "with layer cache";
+#else
+    const char* mode = "without layer cache";
+#endif
+    std::cout << "[ BENCH    ] " << +deep_layers << " layers " << mode << ": " << static_cast<uint64_t>(events_per_second) << " events/s" << std::endl;
+}
@@ -0,0 +1,32 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#undef MATRIX_ROWS
+#undef MATRIX_COLS
+#define MATRIX_ROWS 6
+#define MATRIX_COLS 18
+
+#define RGB_MATRIX_LED_COUNT 108
+#define RGB_MATRIX_KEYPRESSES
+#define RGB_MATRIX_DEFAULT_SPD 127
+
+#define ENABLE_RGB_MATRIX_CYCLE_LEFT_RIGHT
+#define ENABLE_RGB_MATRIX_CYCLE_OUT_IN
+#define ENABLE_RGB_MATRIX_CYCLE_PINWHEEL
+#define ENABLE_RGB_MATRIX_CYCLE_SPIRAL
+#define ENABLE_RGB_MATRIX_BAND_PINWHEEL_SAT
+#define ENABLE_RGB_MATRIX_BAND_SPIRAL_VAL
+#define ENABLE_RGB_MATRIX_RAINBOW_PINWHEELS
+#define ENABLE_RGB_MATRIX_SOLID_REACTIVE_MULTIWIDE
+#define ENABLE_RGB_MATRIX_SOLID_REACTIVE_MULTINEXUS
+#define ENABLE_RGB_MATRIX_MULTISPLASH
+
+#define RGB_MATRIX_FRAMEBUFFER_EFFECTS
+#define ENABLE_RGB_MATRIX_TYPING_HEATMAP
+#define RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP 32
+#define RGB_MATRIX_TYPING_HEATMAP_SPREAD 40
+#define RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT 16
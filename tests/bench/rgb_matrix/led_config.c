@@ -0,0 +1,251 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// LED layout of a 108 key board on a staggered 6x18 grid, as generated by
+// `qmk generate-keyboard-c` from its info.json.
+
+#ifdef RGB_MATRIX_ENABLE
+#include "rgb_matrix.h"
+__attribute__ ((weak)) led_config_t g_led_config = {
+  {
+    { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17 },
+    { 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35 },
+    { 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53 },
+    { 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71 },
+    { 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89 },
+    { 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107 },
+  },
+  { {0, 0}, {12, 0}, {25, 0}, {38, 0}, {50, 0}, {62, 0}, {75, 0}, {88, 0}, {100, 0}, {112, 0}, {125, 0}, {138, 0}, {150, 0}, {162, 0}, {175, 0}, {188, 0}, {200, 0}, {212, 0}, {2, 13}, {14, 13}, {26, 13}, {39, 13}, {52, 13}, {64, 13}, {76, 13}, {89, 13}, {102, 13}, {114, 13}, {126, 13}, {139, 13}, {152, 13}, {164, 13}, {176, 13}, {189, 13}, {202, 13}, {214, 13}, {3, 26}, {16, 26}, {28, 26}, {40, 26}, {53, 26}, {66, 26}, {78, 26}, {90, 26}, {103, 26}, {116, 26}, {128, 26}, {140, 26}, {153, 26}, {166, 26}, {178, 26}, {190, 26}, {203, 26}, {216, 26}, {4, 38}, {17, 38}, {30, 38}, {42, 38}, {54, 38}, {67, 38}, {80, 38}, {92, 38}, {104, 38}, {117, 38}, {130, 38}, {142, 38}, {154, 38}, {167, 38}, {180, 38}, {192, 38}, {204, 38}, {217, 38}, {6, 51}, {18, 51}, {31, 51}, {44, 51}, {56, 51}, {68, 51}, {81, 51}, {94, 51}, {106, 51}, {118, 51}, {131, 51}, {144, 51}, {156, 51}, {168, 51}, {181, 51}, {194, 51}, {206, 51}, {218, 51}, {8, 64}, {20, 64}, {32, 64}, {45, 64}, {58, 64}, {70, 64}, {82, 64}, {95, 64}, {108, 64}, {120, 64}, {132, 64}, {145, 64}, {158, 64}, {170, 64}, {182, 64}, {195, 64}, {208, 64}, {220, 64} },
+  { 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4 },
+};
+#ifdef RGB_MATRIX_GEOMETRY_TABLES
+__attribute__ ((weak)) const led_point_t k_rgb_matrix_center = { 112, 32 };
+__attribute__ ((weak)) const uint8_t PROGMEM g_rgb_matrix_center_dist[] = { 116, 104, 92, 80, 69, 59, 48, 40, 34, 32, 34, 41, 49, 59, 70, 82, 93, 104, 111, 99, 88, 75, 62, 51, 40, 29, 21, 19, 23, 33, 44, 55, 66, 79, 91, 103, 109, 96, 84, 72, 59, 46, 34, 22, 10, 7, 17, 28, 41, 54, 66, 78, 91, 104, 108, 95, 82, 70, 58, 45, 32, 20, 10, 7, 18, 30, 42, 55, 68, 80, 92, 105, 107, 95, 83, 70, 59, 47, 36, 26, 19, 19, 26, 37, 47, 59, 71, 84, 95, 107, 108, 97, 86, 74, 62, 52, 43, 36, 32, 32, 37, 45, 56, 66, 76, 88, 101, 112 };
+__attribute__ ((weak)) const uint8_t PROGMEM g_rgb_matrix_center_angle[] = { 143, 144, 146, 148, 150, 153, 158, 164, 174, 192, 211, 221, 226, 231, 234, 237, 238, 240, 138, 139, 140, 142, 144, 147, 151, 157, 169, 199, 220, 229, 235, 238, 241, 243, 244, 245, 132, 132, 133, 133, 134, 136, 138, 142, 154, 218, 238, 244, 247, 249, 250, 251, 252, 252, 124, 124, 123, 122, 122, 120, 117, 113, 100, 34, 16, 11, 8, 7, 6, 5, 4, 4, 118, 117, 115, 114, 111, 108, 103, 96, 80, 48, 32, 24, 20, 17, 14, 13, 11, 10, 112, 111, 109, 107, 104, 100, 95, 87, 72, 51, 39, 32, 27, 23, 21, 18, 16, 15 };
+#if defined(RGB_MATRIX_FRAMEBUFFER_EFFECTS) && defined(ENABLE_RGB_MATRIX_TYPING_HEATMAP)
+__attribute__ ((weak)) const uint16_t PROGMEM g_rgb_matrix_neighbor_offsets[] = { 0, 11, 26, 44, 65, 85, 105, 125, 146, 166, 186, 206, 227, 247, 267, 287, 306, 322, 335, 351, 371, 395, 421, 448, 474, 501, 527, 554, 580, 607, 633, 660, 686, 713, 737, 757, 773, 792, 817, 847, 879, 911, 943, 975, 1007, 1039, 1071, 1103, 1135, 1167, 1199, 1231, 1261, 1285, 1304, 1323, 1347, 1377, 1409, 1441, 1473, 1505, 1537, 1569, 1601, 1633, 1665, 1697, 1729, 1761, 1791, 1816, 1835, 1851, 1871, 1895, 1922, 1948, 1975, 2001, 2028, 2054, 2081, 2107, 2134, 2160, 2187, 2213, 2237, 2257, 2273, 2286, 2302, 2321, 2341, 2361, 2381, 2402, 2422, 2442, 2462, 2483, 2503, 2523, 2543, 2564, 2582, 2597, 2608 };
+__attribute__ ((weak)) const led_neighbor_t PROGMEM g_rgb_matrix_neighbors[] = {
+  {0, 0, 0}, {0, 1, 12}, {0, 2, 25}, {0, 3, 38}, {1, 0, 13}, {1, 1, 19}, {1, 2, 29}, {2, 0, 26}, {2, 1, 30}, {2, 2, 38}, {3, 0, 38},
+  {0, 0, 12}, {0, 1, 0}, {0, 2, 13}, {0, 3, 26}, {0, 4, 38}, {1, 0, 16}, {1, 1, 13}, {1, 2, 19}, {1, 3, 29}, {2, 0, 27}, {2, 1, 26}, {2, 2, 30}, {2, 3, 38}, {3, 0, 38}, {3, 1, 38},
+  {0, 0, 25}, {0, 1, 13}, {0, 2, 0}, {0, 3, 13}, {0, 4, 25}, {0, 5, 37}, {1, 0, 26}, {1, 1, 17}, {1, 2, 13}, {1, 3, 19}, {1, 4, 29}, {2, 0, 34}, {2, 1, 27}, {2, 2, 26}, {2, 3, 30}, {2, 4, 38}, {3, 1, 38}, {3, 2, 38},
+  {0, 0, 38}, {0, 1, 26}, {0, 2, 13}, {0, 3, 0}, {0, 4, 12}, {0, 5, 24}, {0, 6, 37}, {1, 0, 38}, {1, 1, 27}, {1, 2, 17}, {1, 3, 13}, {1, 4, 19}, {1, 5, 29}, {1, 6, 40}, {2, 1, 34}, {2, 2, 27}, {2, 3, 26}, {2, 4, 30}, {2, 5, 38}, {3, 2, 38}, {3, 3, 38},
+  {0, 1, 38}, {0, 2, 25}, {0, 3, 12}, {0, 4, 0}, {0, 5, 12}, {0, 6, 25}, {0, 7, 38}, {1, 1, 38}, {1, 2, 27}, {1, 3, 17}, {1, 4, 13}, {1, 5, 19}, {1, 6, 29}, {2, 2, 34}, {2, 3, 27}, {2, 4, 26}, {2, 5, 30}, {2, 6, 38}, {3, 3, 38}, {3, 4, 38},
+  {0, 2, 37}, {0, 3, 24}, {0, 4, 12}, {0, 5, 0}, {0, 6, 13}, {0, 7, 26}, {0, 8, 38}, {1, 2, 38}, {1, 3, 26}, {1, 4, 16}, {1, 5, 13}, {1, 6, 19}, {1, 7, 29}, {2, 3, 34}, {2, 4, 27}, {2, 5, 26}, {2, 6, 30}, {2, 7, 38}, {3, 4, 38}, {3, 5, 38},
+  {0, 3, 37}, {0, 4, 25}, {0, 5, 13}, {0, 6, 0}, {0, 7, 13}, {0, 8, 25}, {0, 9, 37}, {1, 3, 38}, {1, 4, 26}, {1, 5, 17}, {1, 6, 13}, {1, 7, 19}, {1, 8, 29}, {2, 4, 34}, {2, 5, 27}, {2, 6, 26}, {2, 7, 30}, {2, 8, 38}, {3, 5, 38}, {3, 6, 38},
+  {0, 4, 38}, {0, 5, 26}, {0, 6, 13}, {0, 7, 0}, {0, 8, 12}, {0, 9, 24}, {0, 10, 37}, {1, 4, 38}, {1, 5, 27}, {1, 6, 17}, {1, 7, 13}, {1, 8, 19}, {1, 9, 29}, {1, 10, 40}, {2, 5, 34}, {2, 6, 27}, {2, 7, 26}, {2, 8, 30}, {2, 9, 38}, {3, 6, 38}, {3, 7, 38},
+  {0, 5, 38}, {0, 6, 25}, {0, 7, 12}, {0, 8, 0}, {0, 9, 12}, {0, 10, 25}, {0, 11, 38}, {1, 5, 38}, {1, 6, 27}, {1, 7, 17}, {1, 8, 13}, {1, 9, 19}, {1, 10, 29}, {2, 6, 34}, {2, 7, 27}, {2, 8, 26}, {2, 9, 30}, {2, 10, 38}, {3, 7, 38}, {3, 8, 38},
+  {0, 6, 37}, {0, 7, 24}, {0, 8, 12}, {0, 9, 0}, {0, 10, 13}, {0, 11, 26}, {0, 12, 38}, {1, 6, 38}, {1, 7, 26}, {1, 8, 16}, {1, 9, 13}, {1, 10, 19}, {1, 11, 29}, {2, 7, 34}, {2, 8, 27}, {2, 9, 26}, {2, 10, 30}, {2, 11, 38}, {3, 8, 38}, {3, 9, 38},
+  {0, 7, 37}, {0, 8, 25}, {0, 9, 13}, {0, 10, 0}, {0, 11, 13}, {0, 12, 25}, {0, 13, 37}, {1, 7, 38}, {1, 8, 26}, {1, 9, 17}, {1, 10, 13}, {1, 11, 19}, {1, 12, 29}, {2, 8, 34}, {2, 9, 27}, {2, 10, 26}, {2, 11, 30}, {2, 12, 38}, {3, 9, 38}, {3, 10, 38},
+  {0, 8, 38}, {0, 9, 26}, {0, 10, 13}, {0, 11, 0}, {0, 12, 12}, {0, 13, 24}, {0, 14, 37}, {1, 8, 38}, {1, 9, 27}, {1, 10, 17}, {1, 11, 13}, {1, 12, 19}, {1, 13, 29}, {1, 14, 40}, {2, 9, 34}, {2, 10, 27}, {2, 11, 26}, {2, 12, 30}, {2, 13, 38}, {3, 10, 38}, {3, 11, 38},
+  {0, 9, 38}, {0, 10, 25}, {0, 11, 12}, {0, 12, 0}, {0, 13, 12}, {0, 14, 25}, {0, 15, 38}, {1, 9, 38}, {1, 10, 27}, {1, 11, 17}, {1, 12, 13}, {1, 13, 19}, {1, 14, 29}, {2, 10, 34}, {2, 11, 27}, {2, 12, 26}, {2, 13, 30}, {2, 14, 38}, {3, 11, 38}, {3, 12, 38},
+  {0, 10, 37}, {0, 11, 24}, {0, 12, 12}, {0, 13, 0}, {0, 14, 13}, {0, 15, 26}, {0, 16, 38}, {1, 10, 38}, {1, 11, 26}, {1, 12, 16}, {1, 13, 13}, {1, 14, 19}, {1, 15, 29}, {2, 11, 34}, {2, 12, 27}, {2, 13, 26}, {2, 14, 30}, {2, 15, 38}, {3, 12, 38}, {3, 13, 38},
+  {0, 11, 37}, {0, 12, 25}, {0, 13, 13}, {0, 14, 0}, {0, 15, 13}, {0, 16, 25}, {0, 17, 37}, {1, 11, 38}, {1, 12, 26}, {1, 13, 17}, {1, 14, 13}, {1, 15, 19}, {1, 16, 29}, {2, 12, 34}, {2, 13, 27}, {2, 14, 26}, {2, 15, 30}, {2, 16, 38}, {3, 13, 38}, {3, 14, 38},
+  {0, 12, 38}, {0, 13, 26}, {0, 14, 13}, {0, 15, 0}, {0, 16, 12}, {0, 17, 24}, {1, 12, 38}, {1, 13, 27}, {1, 14, 17}, {1, 15, 13}, {1, 16, 19}, {1, 17, 29}, {2, 13, 34}, {2, 14, 27}, {2, 15, 26}, {2, 16, 30}, {2, 17, 38}, {3, 14, 38}, {3, 15, 38},
+  {0, 13, 38}, {0, 14, 25}, {0, 15, 12}, {0, 16, 0}, {0, 17, 12}, {1, 13, 38}, {1, 14, 27}, {1, 15, 17}, {1, 16, 13}, {1, 17, 19}, {2, 14, 34}, {2, 15, 27}, {2, 16, 26}, {2, 17, 30}, {3, 15, 38}, {3, 16, 38},
+  {0, 14, 37}, {0, 15, 24}, {0, 16, 12}, {0, 17, 0}, {1, 14, 38}, {1, 15, 26}, {1, 16, 16}, {1, 17, 13}, {2, 15, 34}, {2, 16, 27}, {2, 17, 26}, {3, 16, 38}, {3, 17, 38},
+  {0, 0, 13}, {0, 1, 16}, {0, 2, 26}, {0, 3, 38}, {1, 0, 0}, {1, 1, 12}, {1, 2, 24}, {1, 3, 37}, {2, 0, 13}, {2, 1, 19}, {2, 2, 29}, {2, 3, 40}, {3, 0, 25}, {3, 1, 29}, {3, 2, 37}, {4, 0, 38},
+  {0, 0, 19}, {0, 1, 13}, {0, 2, 17}, {0, 3, 27}, {0, 4, 38}, {1, 0, 12}, {1, 1, 0}, {1, 2, 12}, {1, 3, 25}, {1, 4, 38}, {2, 0, 17}, {2, 1, 13}, {2, 2, 19}, {2, 3, 29}, {3, 0, 26}, {3, 1, 25}, {3, 2, 29}, {3, 3, 37}, {4, 0, 38}, {4, 1, 38},
+  {0, 0, 29}, {0, 1, 19}, {0, 2, 13}, {0, 3, 17}, {0, 4, 27}, {0, 5, 38}, {1, 0, 24}, {1, 1, 12}, {1, 2, 0}, {1, 3, 13}, {1, 4, 26}, {1, 5, 38}, {2, 0, 26}, {2, 1, 16}, {2, 2, 13}, {2, 3, 19}, {2, 4, 29}, {3, 0, 33}, {3, 1, 26}, {3, 2, 25}, {3, 3, 29}, {3, 4, 37}, {4, 1, 38}, {4, 2, 38},
+  {0, 1, 29}, {0, 2, 19}, {0, 3, 13}, {0, 4, 17}, {0, 5, 26}, {0, 6, 38}, {1, 0, 37}, {1, 1, 25}, {1, 2, 13}, {1, 3, 0}, {1, 4, 13}, {1, 5, 25}, {1, 6, 37}, {2, 0, 38}, {2, 1, 26}, {2, 2, 17}, {2, 3, 13}, {2, 4, 19}, {2, 5, 29}, {3, 1, 33}, {3, 2, 26}, {3, 3, 25}, {3, 4, 29}, {3, 5, 37}, {4, 2, 38}, {4, 3, 38},
+  {0, 2, 29}, {0, 3, 19}, {0, 4, 13}, {0, 5, 16}, {0, 6, 26}, {0, 7, 38}, {1, 1, 38}, {1, 2, 26}, {1, 3, 13}, {1, 4, 0}, {1, 5, 12}, {1, 6, 24}, {1, 7, 37}, {2, 1, 38}, {2, 2, 27}, {2, 3, 17}, {2, 4, 13}, {2, 5, 19}, {2, 6, 29}, {2, 7, 40}, {3, 2, 33}, {3, 3, 26}, {3, 4, 25}, {3, 5, 29}, {3, 6, 37}, {4, 3, 38}, {4, 4, 38},
+  {0, 3, 29}, {0, 4, 19}, {0, 5, 13}, {0, 6, 17}, {0, 7, 27}, {0, 8, 38}, {1, 2, 38}, {1, 3, 25}, {1, 4, 12}, {1, 5, 0}, {1, 6, 12}, {1, 7, 25}, {1, 8, 38}, {2, 2, 38}, {2, 3, 27}, {2, 4, 17}, {2, 5, 13}, {2, 6, 19}, {2, 7, 29}, {3, 3, 33}, {3, 4, 26}, {3, 5, 25}, {3, 6, 29}, {3, 7, 37}, {4, 4, 38}, {4, 5, 38},
+  {0, 3, 40}, {0, 4, 29}, {0, 5, 19}, {0, 6, 13}, {0, 7, 17}, {0, 8, 27}, {0, 9, 38}, {1, 3, 37}, {1, 4, 24}, {1, 5, 12}, {1, 6, 0}, {1, 7, 13}, {1, 8, 26}, {1, 9, 38}, {2, 3, 38}, {2, 4, 26}, {2, 5, 16}, {2, 6, 13}, {2, 7, 19}, {2, 8, 29}, {3, 4, 33}, {3, 5, 26}, {3, 6, 25}, {3, 7, 29}, {3, 8, 37}, {4, 5, 38}, {4, 6, 38},
+  {0, 5, 29}, {0, 6, 19}, {0, 7, 13}, {0, 8, 17}, {0, 9, 26}, {0, 10, 38}, {1, 4, 37}, {1, 5, 25}, {1, 6, 13}, {1, 7, 0}, {1, 8, 13}, {1, 9, 25}, {1, 10, 37}, {2, 4, 38}, {2, 5, 26}, {2, 6, 17}, {2, 7, 13}, {2, 8, 19}, {2, 9, 29}, {3, 5, 33}, {3, 6, 26}, {3, 7, 25}, {3, 8, 29}, {3, 9, 37}, {4, 6, 38}, {4, 7, 38},
+  {0, 6, 29}, {0, 7, 19}, {0, 8, 13}, {0, 9, 16}, {0, 10, 26}, {0, 11, 38}, {1, 5, 38}, {1, 6, 26}, {1, 7, 13}, {1, 8, 0}, {1, 9, 12}, {1, 10, 24}, {1, 11, 37}, {2, 5, 38}, {2, 6, 27}, {2, 7, 17}, {2, 8, 13}, {2, 9, 19}, {2, 10, 29}, {2, 11, 40}, {3, 6, 33}, {3, 7, 26}, {3, 8, 25}, {3, 9, 29}, {3, 10, 37}, {4, 7, 38}, {4, 8, 38},
+  {0, 7, 29}, {0, 8, 19}, {0, 9, 13}, {0, 10, 17}, {0, 11, 27}, {0, 12, 38}, {1, 6, 38}, {1, 7, 25}, {1, 8, 12}, {1, 9, 0}, {1, 10, 12}, {1, 11, 25}, {1, 12, 38}, {2, 6, 38}, {2, 7, 27}, {2, 8, 17}, {2, 9, 13}, {2, 10, 19}, {2, 11, 29}, {3, 7, 33}, {3, 8, 26}, {3, 9, 25}, {3, 10, 29}, {3, 11, 37}, {4, 8, 38}, {4, 9, 38},
+  {0, 7, 40}, {0, 8, 29}, {0, 9, 19}, {0, 10, 13}, {0, 11, 17}, {0, 12, 27}, {0, 13, 38}, {1, 7, 37}, {1, 8, 24}, {1, 9, 12}, {1, 10, 0}, {1, 11, 13}, {1, 12, 26}, {1, 13, 38}, {2, 7, 38}, {2, 8, 26}, {2, 9, 16}, {2, 10, 13}, {2, 11, 19}, {2, 12, 29}, {3, 8, 33}, {3, 9, 26}, {3, 10, 25}, {3, 11, 29}, {3, 12, 37}, {4, 9, 38}, {4, 10, 38},
+  {0, 9, 29}, {0, 10, 19}, {0, 11, 13}, {0, 12, 17}, {0, 13, 26}, {0, 14, 38}, {1, 8, 37}, {1, 9, 25}, {1, 10, 13}, {1, 11, 0}, {1, 12, 13}, {1, 13, 25}, {1, 14, 37}, {2, 8, 38}, {2, 9, 26}, {2, 10, 17}, {2, 11, 13}, {2, 12, 19}, {2, 13, 29}, {3, 9, 33}, {3, 10, 26}, {3, 11, 25}, {3, 12, 29}, {3, 13, 37}, {4, 10, 38}, {4, 11, 38},
+  {0, 10, 29}, {0, 11, 19}, {0, 12, 13}, {0, 13, 16}, {0, 14, 26}, {0, 15, 38}, {1, 9, 38}, {1, 10, 26}, {1, 11, 13}, {1, 12, 0}, {1, 13, 12}, {1, 14, 24}, {1, 15, 37}, {2, 9, 38}, {2, 10, 27}, {2, 11, 17}, {2, 12, 13}, {2, 13, 19}, {2, 14, 29}, {2, 15, 40}, {3, 10, 33}, {3, 11, 26}, {3, 12, 25}, {3, 13, 29}, {3, 14, 37}, {4, 11, 38}, {4, 12, 38},
+  {0, 11, 29}, {0, 12, 19}, {0, 13, 13}, {0, 14, 17}, {0, 15, 27}, {0, 16, 38}, {1, 10, 38}, {1, 11, 25}, {1, 12, 12}, {1, 13, 0}, {1, 14, 12}, {1, 15, 25}, {1, 16, 38}, {2, 10, 38}, {2, 11, 27}, {2, 12, 17}, {2, 13, 13}, {2, 14, 19}, {2, 15, 29}, {3, 11, 33}, {3, 12, 26}, {3, 13, 25}, {3, 14, 29}, {3, 15, 37}, {4, 12, 38}, {4, 13, 38},
+  {0, 11, 40}, {0, 12, 29}, {0, 13, 19}, {0, 14, 13}, {0, 15, 17}, {0, 16, 27}, {0, 17, 38}, {1, 11, 37}, {1, 12, 24}, {1, 13, 12}, {1, 14, 0}, {1, 15, 13}, {1, 16, 26}, {1, 17, 38}, {2, 11, 38}, {2, 12, 26}, {2, 13, 16}, {2, 14, 13}, {2, 15, 19}, {2, 16, 29}, {3, 12, 33}, {3, 13, 26}, {3, 14, 25}, {3, 15, 29}, {3, 16, 37}, {4, 13, 38}, {4, 14, 38},
+  {0, 13, 29}, {0, 14, 19}, {0, 15, 13}, {0, 16, 17}, {0, 17, 26}, {1, 12, 37}, {1, 13, 25}, {1, 14, 13}, {1, 15, 0}, {1, 16, 13}, {1, 17, 25}, {2, 12, 38}, {2, 13, 26}, {2, 14, 17}, {2, 15, 13}, {2, 16, 19}, {2, 17, 29}, {3, 13, 33}, {3, 14, 26}, {3, 15, 25}, {3, 16, 29}, {3, 17, 37}, {4, 14, 38}, {4, 15, 38},
+  {0, 14, 29}, {0, 15, 19}, {0, 16, 13}, {0, 17, 16}, {1, 13, 38}, {1, 14, 26}, {1, 15, 13}, {1, 16, 0}, {1, 17, 12}, {2, 13, 38}, {2, 14, 27}, {2, 15, 17}, {2, 16, 13}, {2, 17, 19}, {3, 14, 33}, {3, 15, 26}, {3, 16, 25}, {3, 17, 29}, {4, 15, 38}, {4, 16, 38},
+  {0, 15, 29}, {0, 16, 19}, {0, 17, 13}, {1, 14, 38}, {1, 15, 25}, {1, 16, 12}, {1, 17, 0}, {2, 14, 38}, {2, 15, 27}, {2, 16, 17}, {2, 17, 13}, {3, 15, 33}, {3, 16, 26}, {3, 17, 25}, {4, 16, 38}, {4, 17, 38},
+  {0, 0, 26}, {0, 1, 27}, {0, 2, 34}, {1, 0, 13}, {1, 1, 17}, {1, 2, 26}, {1, 3, 38}, {2, 0, 0}, {2, 1, 13}, {2, 2, 25}, {2, 3, 37}, {3, 0, 12}, {3, 1, 18}, {3, 2, 29}, {3, 3, 40}, {4, 0, 25}, {4, 1, 29}, {4, 2, 37}, {5, 0, 38},
+  {0, 0, 30}, {0, 1, 26}, {0, 2, 27}, {0, 3, 34}, {1, 0, 19}, {1, 1, 13}, {1, 2, 16}, {1, 3, 26}, {1, 4, 38}, {2, 0, 13}, {2, 1, 0}, {2, 2, 12}, {2, 3, 24}, {2, 4, 37}, {3, 0, 16}, {3, 1, 12}, {3, 2, 18}, {3, 3, 28}, {3, 4, 39}, {4, 0, 26}, {4, 1, 25}, {4, 2, 29}, {4, 3, 37}, {5, 0, 38}, {5, 1, 38},
+  {0, 0, 38}, {0, 1, 30}, {0, 2, 26}, {0, 3, 27}, {0, 4, 34}, {1, 0, 29}, {1, 1, 19}, {1, 2, 13}, {1, 3, 17}, {1, 4, 27}, {1, 5, 38}, {2, 0, 25}, {2, 1, 12}, {2, 2, 0}, {2, 3, 12}, {2, 4, 25}, {2, 5, 38}, {3, 0, 26}, {3, 1, 16}, {3, 2, 12}, {3, 3, 18}, {3, 4, 28}, {3, 5, 40}, {4, 0, 33}, {4, 1, 26}, {4, 2, 25}, {4, 3, 29}, {4, 4, 37}, {5, 1, 38}, {5, 2, 38},
+  {0, 1, 38}, {0, 2, 30}, {0, 3, 26}, {0, 4, 27}, {0, 5, 34}, {1, 0, 40}, {1, 1, 29}, {1, 2, 19}, {1, 3, 13}, {1, 4, 17}, {1, 5, 27}, {1, 6, 38}, {2, 0, 37}, {2, 1, 24}, {2, 2, 12}, {2, 3, 0}, {2, 4, 13}, {2, 5, 26}, {2, 6, 38}, {3, 0, 37}, {3, 1, 25}, {3, 2, 15}, {3, 3, 12}, {3, 4, 18}, {3, 5, 29}, {4, 1, 33}, {4, 2, 26}, {4, 3, 25}, {4, 4, 29}, {4, 5, 37}, {5, 2, 38}, {5, 3, 38},
+  {0, 2, 38}, {0, 3, 30}, {0, 4, 26}, {0, 5, 27}, {0, 6, 34}, {1, 2, 29}, {1, 3, 19}, {1, 4, 13}, {1, 5, 17}, {1, 6, 26}, {1, 7, 38}, {2, 1, 37}, {2, 2, 25}, {2, 3, 13}, {2, 4, 0}, {2, 5, 13}, {2, 6, 25}, {2, 7, 37}, {3, 1, 37}, {3, 2, 25}, {3, 3, 16}, {3, 4, 12}, {3, 5, 18}, {3, 6, 29}, {3, 7, 40}, {4, 2, 33}, {4, 3, 26}, {4, 4, 25}, {4, 5, 29}, {4, 6, 37}, {5, 3, 38}, {5, 4, 38},
+  {0, 3, 38}, {0, 4, 30}, {0, 5, 26}, {0, 6, 27}, {0, 7, 34}, {1, 3, 29}, {1, 4, 19}, {1, 5, 13}, {1, 6, 16}, {1, 7, 26}, {1, 8, 38}, {2, 2, 38}, {2, 3, 26}, {2, 4, 13}, {2, 5, 0}, {2, 6, 12}, {2, 7, 24}, {2, 8, 37}, {3, 2, 37}, {3, 3, 26}, {3, 4, 16}, {3, 5, 12}, {3, 6, 18}, {3, 7, 28}, {3, 8, 39}, {4, 3, 33}, {4, 4, 26}, {4, 5, 25}, {4, 6, 29}, {4, 7, 37}, {5, 4, 38}, {5, 5, 38},
+  {0, 4, 38}, {0, 5, 30}, {0, 6, 26}, {0, 7, 27}, {0, 8, 34}, {1, 4, 29}, {1, 5, 19}, {1, 6, 13}, {1, 7, 17}, {1, 8, 27}, {1, 9, 38}, {2, 3, 38}, {2, 4, 25}, {2, 5, 12}, {2, 6, 0}, {2, 7, 12}, {2, 8, 25}, {2, 9, 38}, {3, 3, 37}, {3, 4, 26}, {3, 5, 16}, {3, 6, 12}, {3, 7, 18}, {3, 8, 28}, {3, 9, 40}, {4, 4, 33}, {4, 5, 26}, {4, 6, 25}, {4, 7, 29}, {4, 8, 37}, {5, 5, 38}, {5, 6, 38},
+  {0, 5, 38}, {0, 6, 30}, {0, 7, 26}, {0, 8, 27}, {0, 9, 34}, {1, 4, 40}, {1, 5, 29}, {1, 6, 19}, {1, 7, 13}, {1, 8, 17}, {1, 9, 27}, {1, 10, 38}, {2, 4, 37}, {2, 5, 24}, {2, 6, 12}, {2, 7, 0}, {2, 8, 13}, {2, 9, 26}, {2, 10, 38}, {3, 4, 37}, {3, 5, 25}, {3, 6, 15}, {3, 7, 12}, {3, 8, 18}, {3, 9, 29}, {4, 5, 33}, {4, 6, 26}, {4, 7, 25}, {4, 8, 29}, {4, 9, 37}, {5, 6, 38}, {5, 7, 38},
+  {0, 6, 38}, {0, 7, 30}, {0, 8, 26}, {0, 9, 27}, {0, 10, 34}, {1, 6, 29}, {1, 7, 19}, {1, 8, 13}, {1, 9, 17}, {1, 10, 26}, {1, 11, 38}, {2, 5, 37}, {2, 6, 25}, {2, 7, 13}, {2, 8, 0}, {2, 9, 13}, {2, 10, 25}, {2, 11, 37}, {3, 5, 37}, {3, 6, 25}, {3, 7, 16}, {3, 8, 12}, {3, 9, 18}, {3, 10, 29}, {3, 11, 40}, {4, 6, 33}, {4, 7, 26}, {4, 8, 25}, {4, 9, 29}, {4, 10, 37}, {5, 7, 38}, {5, 8, 38},
+  {0, 7, 38}, {0, 8, 30}, {0, 9, 26}, {0, 10, 27}, {0, 11, 34}, {1, 7, 29}, {1, 8, 19}, {1, 9, 13}, {1, 10, 16}, {1, 11, 26}, {1, 12, 38}, {2, 6, 38}, {2, 7, 26}, {2, 8, 13}, {2, 9, 0}, {2, 10, 12}, {2, 11, 24}, {2, 12, 37}, {3, 6, 37}, {3, 7, 26}, {3, 8, 16}, {3, 9, 12}, {3, 10, 18}, {3, 11, 28}, {3, 12, 39}, {4, 7, 33}, {4, 8, 26}, {4, 9, 25}, {4, 10, 29}, {4, 11, 37}, {5, 8, 38}, {5, 9, 38},
+  {0, 8, 38}, {0, 9, 30}, {0, 10, 26}, {0, 11, 27}, {0, 12, 34}, {1, 8, 29}, {1, 9, 19}, {1, 10, 13}, {1, 11, 17}, {1, 12, 27}, {1, 13, 38}, {2, 7, 38}, {2, 8, 25}, {2, 9, 12}, {2, 10, 0}, {2, 11, 12}, {2, 12, 25}, {2, 13, 38}, {3, 7, 37}, {3, 8, 26}, {3, 9, 16}, {3, 10, 12}, {3, 11, 18}, {3, 12, 28}, {3, 13, 40}, {4, 8, 33}, {4, 9, 26}, {4, 10, 25}, {4, 11, 29}, {4, 12, 37}, {5, 9, 38}, {5, 10, 38},
+  {0, 9, 38}, {0, 10, 30}, {0, 11, 26}, {0, 12, 27}, {0, 13, 34}, {1, 8, 40}, {1, 9, 29}, {1, 10, 19}, {1, 11, 13}, {1, 12, 17}, {1, 13, 27}, {1, 14, 38}, {2, 8, 37}, {2, 9, 24}, {2, 10, 12}, {2, 11, 0}, {2, 12, 13}, {2, 13, 26}, {2, 14, 38}, {3, 8, 37}, {3, 9, 25}, {3, 10, 15}, {3, 11, 12}, {3, 12, 18}, {3, 13, 29}, {4, 9, 33}, {4, 10, 26}, {4, 11, 25}, {4, 12, 29}, {4, 13, 37}, {5, 10, 38}, {5, 11, 38},
+  {0, 10, 38}, {0, 11, 30}, {0, 12, 26}, {0, 13, 27}, {0, 14, 34}, {1, 10, 29}, {1, 11, 19}, {1, 12, 13}, {1, 13, 17}, {1, 14, 26}, {1, 15, 38}, {2, 9, 37}, {2, 10, 25}, {2, 11, 13}, {2, 12, 0}, {2, 13, 13}, {2, 14, 25}, {2, 15, 37}, {3, 9, 37}, {3, 10, 25}, {3, 11, 16}, {3, 12, 12}, {3, 13, 18}, {3, 14, 29}, {3, 15, 40}, {4, 10, 33}, {4, 11, 26}, {4, 12, 25}, {4, 13, 29}, {4, 14, 37}, {5, 11, 38}, {5, 12, 38},
+  {0, 11, 38}, {0, 12, 30}, {0, 13, 26}, {0, 14, 27}, {0, 15, 34}, {1, 11, 29}, {1, 12, 19}, {1, 13, 13}, {1, 14, 16}, {1, 15, 26}, {1, 16, 38}, {2, 10, 38}, {2, 11, 26}, {2, 12, 13}, {2, 13, 0}, {2, 14, 12}, {2, 15, 24}, {2, 16, 37}, {3, 10, 37}, {3, 11, 26}, {3, 12, 16}, {3, 13, 12}, {3, 14, 18}, {3, 15, 28}, {3, 16, 39}, {4, 11, 33}, {4, 12, 26}, {4, 13, 25}, {4, 14, 29}, {4, 15, 37}, {5, 12, 38}, {5, 13, 38},
+  {0, 12, 38}, {0, 13, 30}, {0, 14, 26}, {0, 15, 27}, {0, 16, 34}, {1, 12, 29}, {1, 13, 19}, {1, 14, 13}, {1, 15, 17}, {1, 16, 27}, {1, 17, 38}, {2, 11, 38}, {2, 12, 25}, {2, 13, 12}, {2, 14, 0}, {2, 15, 12}, {2, 16, 25}, {2, 17, 38}, {3, 11, 37}, {3, 12, 26}, {3, 13, 16}, {3, 14, 12}, {3, 15, 18}, {3, 16, 28}, {3, 17, 40}, {4, 12, 33}, {4, 13, 26}, {4, 14, 25}, {4, 15, 29}, {4, 16, 37}, {5, 13, 38}, {5, 14, 38},
+  {0, 13, 38}, {0, 14, 30}, {0, 15, 26}, {0, 16, 27}, {0, 17, 34}, {1, 12, 40}, {1, 13, 29}, {1, 14, 19}, {1, 15, 13}, {1, 16, 17}, {1, 17, 27}, {2, 12, 37}, {2, 13, 24}, {2, 14, 12}, {2, 15, 0}, {2, 16, 13}, {2, 17, 26}, {3, 12, 37}, {3, 13, 25}, {3, 14, 15}, {3, 15, 12}, {3, 16, 18}, {3, 17, 29}, {4, 13, 33}, {4, 14, 26}, {4, 15, 25}, {4, 16, 29}, {4, 17, 37}, {5, 14, 38}, {5, 15, 38},
+  {0, 14, 38}, {0, 15, 30}, {0, 16, 26}, {0, 17, 27}, {1, 14, 29}, {1, 15, 19}, {1, 16, 13}, {1, 17, 17}, {2, 13, 37}, {2, 14, 25}, {2, 15, 13}, {2, 16, 0}, {2, 17, 13}, {3, 13, 37}, {3, 14, 25}, {3, 15, 16}, {3, 16, 12}, {3, 17, 18}, {4, 14, 33}, {4, 15, 26}, {4, 16, 25}, {4, 17, 29}, {5, 15, 38}, {5, 16, 38},
+  {0, 15, 38}, {0, 16, 30}, {0, 17, 26}, {1, 15, 29}, {1, 16, 19}, {1, 17, 13}, {2, 14, 38}, {2, 15, 26}, {2, 16, 13}, {2, 17, 0}, {3, 14, 37}, {3, 15, 26}, {3, 16, 16}, {3, 17, 12}, {4, 15, 33}, {4, 16, 26}, {4, 17, 25}, {5, 16, 38}, {5, 17, 38},
+  {0, 0, 38}, {0, 1, 38}, {1, 0, 25}, {1, 1, 26}, {1, 2, 33}, {2, 0, 12}, {2, 1, 16}, {2, 2, 26}, {2, 3, 37}, {3, 0, 0}, {3, 1, 13}, {3, 2, 26}, {3, 3, 38}, {4, 0, 13}, {4, 1, 19}, {4, 2, 29}, {5, 0, 26}, {5, 1, 30}, {5, 2, 38},
+  {0, 1, 38}, {0, 2, 38}, {1, 0, 29}, {1, 1, 25}, {1, 2, 26}, {1, 3, 33}, {2, 0, 18}, {2, 1, 12}, {2, 2, 16}, {2, 3, 25}, {2, 4, 37}, {3, 0, 13}, {3, 1, 0}, {3, 2, 13}, {3, 3, 25}, {3, 4, 37}, {4, 0, 17}, {4, 1, 13}, {4, 2, 19}, {4, 3, 29}, {5, 0, 27}, {5, 1, 26}, {5, 2, 30}, {5, 3, 38},
+  {0, 2, 38}, {0, 3, 38}, {1, 0, 37}, {1, 1, 29}, {1, 2, 25}, {1, 3, 26}, {1, 4, 33}, {2, 0, 29}, {2, 1, 18}, {2, 2, 12}, {2, 3, 15}, {2, 4, 25}, {2, 5, 37}, {3, 0, 26}, {3, 1, 13}, {3, 2, 0}, {3, 3, 12}, {3, 4, 24}, {3, 5, 37}, {4, 0, 27}, {4, 1, 17}, {4, 2, 13}, {4, 3, 19}, {4, 4, 29}, {4, 5, 40}, {5, 0, 34}, {5, 1, 27}, {5, 2, 26}, {5, 3, 30}, {5, 4, 38},
+  {0, 3, 38}, {0, 4, 38}, {1, 1, 37}, {1, 2, 29}, {1, 3, 25}, {1, 4, 26}, {1, 5, 33}, {2, 0, 40}, {2, 1, 28}, {2, 2, 18}, {2, 3, 12}, {2, 4, 16}, {2, 5, 26}, {2, 6, 37}, {3, 0, 38}, {3, 1, 25}, {3, 2, 12}, {3, 3, 0}, {3, 4, 12}, {3, 5, 25}, {3, 6, 38}, {4, 0, 38}, {4, 1, 27}, {4, 2, 17}, {4, 3, 13}, {4, 4, 19}, {4, 5, 29}, {5, 1, 34}, {5, 2, 27}, {5, 3, 26}, {5, 4, 30}, {5, 5, 38},
+  {0, 4, 38}, {0, 5, 38}, {1, 2, 37}, {1, 3, 29}, {1, 4, 25}, {1, 5, 26}, {1, 6, 33}, {2, 1, 39}, {2, 2, 28}, {2, 3, 18}, {2, 4, 12}, {2, 5, 16}, {2, 6, 26}, {2, 7, 37}, {3, 1, 37}, {3, 2, 24}, {3, 3, 12}, {3, 4, 0}, {3, 5, 13}, {3, 6, 26}, {3, 7, 38}, {4, 1, 38}, {4, 2, 26}, {4, 3, 16}, {4, 4, 13}, {4, 5, 19}, {4, 6, 29}, {5, 2, 34}, {5, 3, 27}, {5, 4, 26}, {5, 5, 30}, {5, 6, 38},
+  {0, 5, 38}, {0, 6, 38}, {1, 3, 37}, {1, 4, 29}, {1, 5, 25}, {1, 6, 26}, {1, 7, 33}, {2, 2, 40}, {2, 3, 29}, {2, 4, 18}, {2, 5, 12}, {2, 6, 16}, {2, 7, 25}, {2, 8, 37}, {3, 2, 37}, {3, 3, 25}, {3, 4, 13}, {3, 5, 0}, {3, 6, 13}, {3, 7, 25}, {3, 8, 37}, {4, 2, 38}, {4, 3, 26}, {4, 4, 17}, {4, 5, 13}, {4, 6, 19}, {4, 7, 29}, {5, 3, 34}, {5, 4, 27}, {5, 5, 26}, {5, 6, 30}, {5, 7, 38},
+  {0, 6, 38}, {0, 7, 38}, {1, 4, 37}, {1, 5, 29}, {1, 6, 25}, {1, 7, 26}, {1, 8, 33}, {2, 4, 29}, {2, 5, 18}, {2, 6, 12}, {2, 7, 15}, {2, 8, 25}, {2, 9, 37}, {3, 3, 38}, {3, 4, 26}, {3, 5, 13}, {3, 6, 0}, {3, 7, 12}, {3, 8, 24}, {3, 9, 37}, {4, 3, 38}, {4, 4, 27}, {4, 5, 17}, {4, 6, 13}, {4, 7, 19}, {4, 8, 29}, {4, 9, 40}, {5, 4, 34}, {5, 5, 27}, {5, 6, 26}, {5, 7, 30}, {5, 8, 38},
+  {0, 7, 38}, {0, 8, 38}, {1, 5, 37}, {1, 6, 29}, {1, 7, 25}, {1, 8, 26}, {1, 9, 33}, {2, 4, 40}, {2, 5, 28}, {2, 6, 18}, {2, 7, 12}, {2, 8, 16}, {2, 9, 26}, {2, 10, 37}, {3, 4, 38}, {3, 5, 25}, {3, 6, 12}, {3, 7, 0}, {3, 8, 12}, {3, 9, 25}, {3, 10, 38}, {4, 4, 38}, {4, 5, 27}, {4, 6, 17}, {4, 7, 13}, {4, 8, 19}, {4, 9, 29}, {5, 5, 34}, {5, 6, 27}, {5, 7, 26}, {5, 8, 30}, {5, 9, 38},
+  {0, 8, 38}, {0, 9, 38}, {1, 6, 37}, {1, 7, 29}, {1, 8, 25}, {1, 9, 26}, {1, 10, 33}, {2, 5, 39}, {2, 6, 28}, {2, 7, 18}, {2, 8, 12}, {2, 9, 16}, {2, 10, 26}, {2, 11, 37}, {3, 5, 37}, {3, 6, 24}, {3, 7, 12}, {3, 8, 0}, {3, 9, 13}, {3, 10, 26}, {3, 11, 38}, {4, 5, 38}, {4, 6, 26}, {4, 7, 16}, {4, 8, 13}, {4, 9, 19}, {4, 10, 29}, {5, 6, 34}, {5, 7, 27}, {5, 8, 26}, {5, 9, 30}, {5, 10, 38},
+  {0, 9, 38}, {0, 10, 38}, {1, 7, 37}, {1, 8, 29}, {1, 9, 25}, {1, 10, 26}, {1, 11, 33}, {2, 6, 40}, {2, 7, 29}, {2, 8, 18}, {2, 9, 12}, {2, 10, 16}, {2, 11, 25}, {2, 12, 37}, {3, 6, 37}, {3, 7, 25}, {3, 8, 13}, {3, 9, 0}, {3, 10, 13}, {3, 11, 25}, {3, 12, 37}, {4, 6, 38}, {4, 7, 26}, {4, 8, 17}, {4, 9, 13}, {4, 10, 19}, {4, 11, 29}, {5, 7, 34}, {5, 8, 27}, {5, 9, 26}, {5, 10, 30}, {5, 11, 38},
+  {0, 10, 38}, {0, 11, 38}, {1, 8, 37}, {1, 9, 29}, {1, 10, 25}, {1, 11, 26}, {1, 12, 33}, {2, 8, 29}, {2, 9, 18}, {2, 10, 12}, {2, 11, 15}, {2, 12, 25}, {2, 13, 37}, {3, 7, 38}, {3, 8, 26}, {3, 9, 13}, {3, 10, 0}, {3, 11, 12}, {3, 12, 24}, {3, 13, 37}, {4, 7, 38}, {4, 8, 27}, {4, 9, 17}, {4, 10, 13}, {4, 11, 19}, {4, 12, 29}, {4, 13, 40}, {5, 8, 34}, {5, 9, 27}, {5, 10, 26}, {5, 11, 30}, {5, 12, 38},
+  {0, 11, 38}, {0, 12, 38}, {1, 9, 37}, {1, 10, 29}, {1, 11, 25}, {1, 12, 26}, {1, 13, 33}, {2, 8, 40}, {2, 9, 28}, {2, 10, 18}, {2, 11, 12}, {2, 12, 16}, {2, 13, 26}, {2, 14, 37}, {3, 8, 38}, {3, 9, 25}, {3, 10, 12}, {3, 11, 0}, {3, 12, 12}, {3, 13, 25}, {3, 14, 38}, {4, 8, 38}, {4, 9, 27}, {4, 10, 17}, {4, 11, 13}, {4, 12, 19}, {4, 13, 29}, {5, 9, 34}, {5, 10, 27}, {5, 11, 26}, {5, 12, 30}, {5, 13, 38},
+  {0, 12, 38}, {0, 13, 38}, {1, 10, 37}, {1, 11, 29}, {1, 12, 25}, {1, 13, 26}, {1, 14, 33}, {2, 9, 39}, {2, 10, 28}, {2, 11, 18}, {2, 12, 12}, {2, 13, 16}, {2, 14, 26}, {2, 15, 37}, {3, 9, 37}, {3, 10, 24}, {3, 11, 12}, {3, 12, 0}, {3, 13, 13}, {3, 14, 26}, {3, 15, 38}, {4, 9, 38}, {4, 10, 26}, {4, 11, 16}, {4, 12, 13}, {4, 13, 19}, {4, 14, 29}, {5, 10, 34}, {5, 11, 27}, {5, 12, 26}, {5, 13, 30}, {5, 14, 38},
+  {0, 13, 38}, {0, 14, 38}, {1, 11, 37}, {1, 12, 29}, {1, 13, 25}, {1, 14, 26}, {1, 15, 33}, {2, 10, 40}, {2, 11, 29}, {2, 12, 18}, {2, 13, 12}, {2, 14, 16}, {2, 15, 25}, {2, 16, 37}, {3, 10, 37}, {3, 11, 25}, {3, 12, 13}, {3, 13, 0}, {3, 14, 13}, {3, 15, 25}, {3, 16, 37}, {4, 10, 38}, {4, 11, 26}, {4, 12, 17}, {4, 13, 13}, {4, 14, 19}, {4, 15, 29}, {5, 11, 34}, {5, 12, 27}, {5, 13, 26}, {5, 14, 30}, {5, 15, 38},
+  {0, 14, 38}, {0, 15, 38}, {1, 12, 37}, {1, 13, 29}, {1, 14, 25}, {1, 15, 26}, {1, 16, 33}, {2, 12, 29}, {2, 13, 18}, {2, 14, 12}, {2, 15, 15}, {2, 16, 25}, {2, 17, 37}, {3, 11, 38}, {3, 12, 26}, {3, 13, 13}, {3, 14, 0}, {3, 15, 12}, {3, 16, 24}, {3, 17, 37}, {4, 11, 38}, {4, 12, 27}, {4, 13, 17}, {4, 14, 13}, {4, 15, 19}, {4, 16, 29}, {4, 17, 40}, {5, 12, 34}, {5, 13, 27}, {5, 14, 26}, {5, 15, 30}, {5, 16, 38},
+  {0, 15, 38}, {0, 16, 38}, {1, 13, 37}, {1, 14, 29}, {1, 15, 25}, {1, 16, 26}, {1, 17, 33}, {2, 12, 40}, {2, 13, 28}, {2, 14, 18}, {2, 15, 12}, {2, 16, 16}, {2, 17, 26}, {3, 12, 38}, {3, 13, 25}, {3, 14, 12}, {3, 15, 0}, {3, 16, 12}, {3, 17, 25}, {4, 12, 38}, {4, 13, 27}, {4, 14, 17}, {4, 15, 13}, {4, 16, 19}, {4, 17, 29}, {5, 13, 34}, {5, 14, 27}, {5, 15, 26}, {5, 16, 30}, {5, 17, 38},
+  {0, 16, 38}, {0, 17, 38}, {1, 14, 37}, {1, 15, 29}, {1, 16, 25}, {1, 17, 26}, {2, 13, 39}, {2, 14, 28}, {2, 15, 18}, {2, 16, 12}, {2, 17, 16}, {3, 13, 37}, {3, 14, 24}, {3, 15, 12}, {3, 16, 0}, {3, 17, 13}, {4, 13, 38}, {4, 14, 26}, {4, 15, 16}, {4, 16, 13}, {4, 17, 19}, {5, 14, 34}, {5, 15, 27}, {5, 16, 26}, {5, 17, 30},
+  {0, 17, 38}, {1, 15, 37}, {1, 16, 29}, {1, 17, 25}, {2, 14, 40}, {2, 15, 29}, {2, 16, 18}, {2, 17, 12}, {3, 14, 37}, {3, 15, 25}, {3, 16, 13}, {3, 17, 0}, {4, 14, 38}, {4, 15, 26}, {4, 16, 17}, {4, 17, 13}, {5, 15, 34}, {5, 16, 27}, {5, 17, 26},
+  {1, 0, 38}, {1, 1, 38}, {2, 0, 25}, {2, 1, 26}, {2, 2, 33}, {3, 0, 13}, {3, 1, 17}, {3, 2, 27}, {3, 3, 38}, {4, 0, 0}, {4, 1, 12}, {4, 2, 25}, {4, 3, 38}, {5, 0, 13}, {5, 1, 19}, {5, 2, 29},
+  {1, 1, 38}, {1, 2, 38}, {2, 0, 29}, {2, 1, 25}, {2, 2, 26}, {2, 3, 33}, {3, 0, 19}, {3, 1, 13}, {3, 2, 17}, {3, 3, 27}, {3, 4, 38}, {4, 0, 12}, {4, 1, 0}, {4, 2, 13}, {4, 3, 26}, {4, 4, 38}, {5, 0, 16}, {5, 1, 13}, {5, 2, 19}, {5, 3, 29},
+  {1, 2, 38}, {1, 3, 38}, {2, 0, 37}, {2, 1, 29}, {2, 2, 25}, {2, 3, 26}, {2, 4, 33}, {3, 0, 29}, {3, 1, 19}, {3, 2, 13}, {3, 3, 17}, {3, 4, 26}, {3, 5, 38}, {4, 0, 25}, {4, 1, 13}, {4, 2, 0}, {4, 3, 13}, {4, 4, 25}, {4, 5, 37}, {5, 0, 26}, {5, 1, 17}, {5, 2, 13}, {5, 3, 19}, {5, 4, 29},
+  {1, 3, 38}, {1, 4, 38}, {2, 1, 37}, {2, 2, 29}, {2, 3, 25}, {2, 4, 26}, {2, 5, 33}, {3, 1, 29}, {3, 2, 19}, {3, 3, 13}, {3, 4, 16}, {3, 5, 26}, {3, 6, 38}, {4, 0, 38}, {4, 1, 26}, {4, 2, 13}, {4, 3, 0}, {4, 4, 12}, {4, 5, 24}, {4, 6, 37}, {5, 0, 38}, {5, 1, 27}, {5, 2, 17}, {5, 3, 13}, {5, 4, 19}, {5, 5, 29}, {5, 6, 40},
+  {1, 4, 38}, {1, 5, 38}, {2, 2, 37}, {2, 3, 29}, {2, 4, 25}, {2, 5, 26}, {2, 6, 33}, {3, 2, 29}, {3, 3, 19}, {3, 4, 13}, {3, 5, 17}, {3, 6, 27}, {3, 7, 38}, {4, 1, 38}, {4, 2, 25}, {4, 3, 12}, {4, 4, 0}, {4, 5, 12}, {4, 6, 25}, {4, 7, 38}, {5, 1, 38}, {5, 2, 27}, {5, 3, 17}, {5, 4, 13}, {5, 5, 19}, {5, 6, 29},
+  {1, 5, 38}, {1, 6, 38}, {2, 3, 37}, {2, 4, 29}, {2, 5, 25}, {2, 6, 26}, {2, 7, 33}, {3, 2, 40}, {3, 3, 29}, {3, 4, 19}, {3, 5, 13}, {3, 6, 17}, {3, 7, 27}, {3, 8, 38}, {4, 2, 37}, {4, 3, 24}, {4, 4, 12}, {4, 5, 0}, {4, 6, 13}, {4, 7, 26}, {4, 8, 38}, {5, 2, 38}, {5, 3, 26}, {5, 4, 16}, {5, 5, 13}, {5, 6, 19}, {5, 7, 29},
+  {1, 6, 38}, {1, 7, 38}, {2, 4, 37}, {2, 5, 29}, {2, 6, 25}, {2, 7, 26}, {2, 8, 33}, {3, 4, 29}, {3, 5, 19}, {3, 6, 13}, {3, 7, 17}, {3, 8, 26}, {3, 9, 38}, {4, 3, 37}, {4, 4, 25}, {4, 5, 13}, {4, 6, 0}, {4, 7, 13}, {4, 8, 25}, {4, 9, 37}, {5, 3, 38}, {5, 4, 26}, {5, 5, 17}, {5, 6, 13}, {5, 7, 19}, {5, 8, 29},
+  {1, 7, 38}, {1, 8, 38}, {2, 5, 37}, {2, 6, 29}, {2, 7, 25}, {2, 8, 26}, {2, 9, 33}, {3, 5, 29}, {3, 6, 19}, {3, 7, 13}, {3, 8, 16}, {3, 9, 26}, {3, 10, 38}, {4, 4, 38}, {4, 5, 26}, {4, 6, 13}, {4, 7, 0}, {4, 8, 12}, {4, 9, 24}, {4, 10, 37}, {5, 4, 38}, {5, 5, 27}, {5, 6, 17}, {5, 7, 13}, {5, 8, 19}, {5, 9, 29}, {5, 10, 40},
+  {1, 8, 38}, {1, 9, 38}, {2, 6, 37}, {2, 7, 29}, {2, 8, 25}, {2, 9, 26}, {2, 10, 33}, {3, 6, 29}, {3, 7, 19}, {3, 8, 13}, {3, 9, 17}, {3, 10, 27}, {3, 11, 38}, {4, 5, 38}, {4, 6, 25}, {4, 7, 12}, {4, 8, 0}, {4, 9, 12}, {4, 10, 25}, {4, 11, 38}, {5, 5, 38}, {5, 6, 27}, {5, 7, 17}, {5, 8, 13}, {5, 9, 19}, {5, 10, 29},
+  {1, 9, 38}, {1, 10, 38}, {2, 7, 37}, {2, 8, 29}, {2, 9, 25}, {2, 10, 26}, {2, 11, 33}, {3, 6, 40}, {3, 7, 29}, {3, 8, 19}, {3, 9, 13}, {3, 10, 17}, {3, 11, 27}, {3, 12, 38}, {4, 6, 37}, {4, 7, 24}, {4, 8, 12}, {4, 9, 0}, {4, 10, 13}, {4, 11, 26}, {4, 12, 38}, {5, 6, 38}, {5, 7, 26}, {5, 8, 16}, {5, 9, 13}, {5, 10, 19}, {5, 11, 29},
+  {1, 10, 38}, {1, 11, 38}, {2, 8, 37}, {2, 9, 29}, {2, 10, 25}, {2, 11, 26}, {2, 12, 33}, {3, 8, 29}, {3, 9, 19}, {3, 10, 13}, {3, 11, 17}, {3, 12, 26}, {3, 13, 38}, {4, 7, 37}, {4, 8, 25}, {4, 9, 13}, {4, 10, 0}, {4, 11, 13}, {4, 12, 25}, {4, 13, 37}, {5, 7, 38}, {5, 8, 26}, {5, 9, 17}, {5, 10, 13}, {5, 11, 19}, {5, 12, 29},
+  {1, 11, 38}, {1, 12, 38}, {2, 9, 37}, {2, 10, 29}, {2, 11, 25}, {2, 12, 26}, {2, 13, 33}, {3, 9, 29}, {3, 10, 19}, {3, 11, 13}, {3, 12, 16}, {3, 13, 26}, {3, 14, 38}, {4, 8, 38}, {4, 9, 26}, {4, 10, 13}, {4, 11, 0}, {4, 12, 12}, {4, 13, 24}, {4, 14, 37}, {5, 8, 38}, {5, 9, 27}, {5, 10, 17}, {5, 11, 13}, {5, 12, 19}, {5, 13, 29}, {5, 14, 40},
+  {1, 12, 38}, {1, 13, 38}, {2, 10, 37}, {2, 11, 29}, {2, 12, 25}, {2, 13, 26}, {2, 14, 33}, {3, 10, 29}, {3, 11, 19}, {3, 12, 13}, {3, 13, 17}, {3, 14, 27}, {3, 15, 38}, {4, 9, 38}, {4, 10, 25}, {4, 11, 12}, {4, 12, 0}, {4, 13, 12}, {4, 14, 25}, {4, 15, 38}, {5, 9, 38}, {5, 10, 27}, {5, 11, 17}, {5, 12, 13}, {5, 13, 19}, {5, 14, 29},
+  {1, 13, 38}, {1, 14, 38}, {2, 11, 37}, {2, 12, 29}, {2, 13, 25}, {2, 14, 26}, {2, 15, 33}, {3, 10, 40}, {3, 11, 29}, {3, 12, 19}, {3, 13, 13}, {3, 14, 17}, {3, 15, 27}, {3, 16, 38}, {4, 10, 37}, {4, 11, 24}, {4, 12, 12}, {4, 13, 0}, {4, 14, 13}, {4, 15, 26}, {4, 16, 38}, {5, 10, 38}, {5, 11, 26}, {5, 12, 16}, {5, 13, 13}, {5, 14, 19}, {5, 15, 29},
+  {1, 14, 38}, {1, 15, 38}, {2, 12, 37}, {2, 13, 29}, {2, 14, 25}, {2, 15, 26}, {2, 16, 33}, {3, 12, 29}, {3, 13, 19}, {3, 14, 13}, {3, 15, 17}, {3, 16, 26}, {3, 17, 38}, {4, 11, 37}, {4, 12, 25}, {4, 13, 13}, {4, 14, 0}, {4, 15, 13}, {4, 16, 25}, {4, 17, 37}, {5, 11, 38}, {5, 12, 26}, {5, 13, 17}, {5, 14, 13}, {5, 15, 19}, {5, 16, 29},
+  {1, 15, 38}, {1, 16, 38}, {2, 13, 37}, {2, 14, 29}, {2, 15, 25}, {2, 16, 26}, {2, 17, 33}, {3, 13, 29}, {3, 14, 19}, {3, 15, 13}, {3, 16, 16}, {3, 17, 26}, {4, 12, 38}, {4, 13, 26}, {4, 14, 13}, {4, 15, 0}, {4, 16, 12}, {4, 17, 24}, {5, 12, 38}, {5, 13, 27}, {5, 14, 17}, {5, 15, 13}, {5, 16, 19}, {5, 17, 29},
+  {1, 16, 38}, {1, 17, 38}, {2, 14, 37}, {2, 15, 29}, {2, 16, 25}, {2, 17, 26}, {3, 14, 29}, {3, 15, 19}, {3, 16, 13}, {3, 17, 17}, {4, 13, 38}, {4, 14, 25}, {4, 15, 12}, {4, 16, 0}, {4, 17, 12}, {5, 13, 38}, {5, 14, 27}, {5, 15, 17}, {5, 16, 13}, {5, 17, 19},
+  {1, 17, 38}, {2, 15, 37}, {2, 16, 29}, {2, 17, 25}, {3, 14, 40}, {3, 15, 29}, {3, 16, 19}, {3, 17, 13}, {4, 14, 37}, {4, 15, 24}, {4, 16, 12}, {4, 17, 0}, {5, 14, 38}, {5, 15, 26}, {5, 16, 16}, {5, 17, 13},
+  {2, 0, 38}, {2, 1, 38}, {3, 0, 26}, {3, 1, 27}, {3, 2, 34}, {4, 0, 13}, {4, 1, 16}, {4, 2, 26}, {4, 3, 38}, {5, 0, 0}, {5, 1, 12}, {5, 2, 24}, {5, 3, 37},
+  {2, 1, 38}, {2, 2, 38}, {3, 0, 30}, {3, 1, 26}, {3, 2, 27}, {3, 3, 34}, {4, 0, 19}, {4, 1, 13}, {4, 2, 17}, {4, 3, 27}, {4, 4, 38}, {5, 0, 12}, {5, 1, 0}, {5, 2, 12}, {5, 3, 25}, {5, 4, 38},
+  {2, 2, 38}, {2, 3, 38}, {3, 0, 38}, {3, 1, 30}, {3, 2, 26}, {3, 3, 27}, {3, 4, 34}, {4, 0, 29}, {4, 1, 19}, {4, 2, 13}, {4, 3, 17}, {4, 4, 27}, {4, 5, 38}, {5, 0, 24}, {5, 1, 12}, {5, 2, 0}, {5, 3, 13}, {5, 4, 26}, {5, 5, 38},
+  {2, 3, 38}, {2, 4, 38}, {3, 1, 38}, {3, 2, 30}, {3, 3, 26}, {3, 4, 27}, {3, 5, 34}, {4, 1, 29}, {4, 2, 19}, {4, 3, 13}, {4, 4, 17}, {4, 5, 26}, {4, 6, 38}, {5, 0, 37}, {5, 1, 25}, {5, 2, 13}, {5, 3, 0}, {5, 4, 13}, {5, 5, 25}, {5, 6, 37},
+  {2, 4, 38}, {2, 5, 38}, {3, 2, 38}, {3, 3, 30}, {3, 4, 26}, {3, 5, 27}, {3, 6, 34}, {4, 2, 29}, {4, 3, 19}, {4, 4, 13}, {4, 5, 16}, {4, 6, 26}, {4, 7, 38}, {5, 1, 38}, {5, 2, 26}, {5, 3, 13}, {5, 4, 0}, {5, 5, 12}, {5, 6, 24}, {5, 7, 37},
+  {2, 5, 38}, {2, 6, 38}, {3, 3, 38}, {3, 4, 30}, {3, 5, 26}, {3, 6, 27}, {3, 7, 34}, {4, 3, 29}, {4, 4, 19}, {4, 5, 13}, {4, 6, 17}, {4, 7, 27}, {4, 8, 38}, {5, 2, 38}, {5, 3, 25}, {5, 4, 12}, {5, 5, 0}, {5, 6, 12}, {5, 7, 25}, {5, 8, 38},
+  {2, 6, 38}, {2, 7, 38}, {3, 4, 38}, {3, 5, 30}, {3, 6, 26}, {3, 7, 27}, {3, 8, 34}, {4, 3, 40}, {4, 4, 29}, {4, 5, 19}, {4, 6, 13}, {4, 7, 17}, {4, 8, 27}, {4, 9, 38}, {5, 3, 37}, {5, 4, 24}, {5, 5, 12}, {5, 6, 0}, {5, 7, 13}, {5, 8, 26}, {5, 9, 38},
+  {2, 7, 38}, {2, 8, 38}, {3, 5, 38}, {3, 6, 30}, {3, 7, 26}, {3, 8, 27}, {3, 9, 34}, {4, 5, 29}, {4, 6, 19}, {4, 7, 13}, {4, 8, 17}, {4, 9, 26}, {4, 10, 38}, {5, 4, 37}, {5, 5, 25}, {5, 6, 13}, {5, 7, 0}, {5, 8, 13}, {5, 9, 25}, {5, 10, 37},
+  {2, 8, 38}, {2, 9, 38}, {3, 6, 38}, {3, 7, 30}, {3, 8, 26}, {3, 9, 27}, {3, 10, 34}, {4, 6, 29}, {4, 7, 19}, {4, 8, 13}, {4, 9, 16}, {4, 10, 26}, {4, 11, 38}, {5, 5, 38}, {5, 6, 26}, {5, 7, 13}, {5, 8, 0}, {5, 9, 12}, {5, 10, 24}, {5, 11, 37},
+  {2, 9, 38}, {2, 10, 38}, {3, 7, 38}, {3, 8, 30}, {3, 9, 26}, {3, 10, 27}, {3, 11, 34}, {4, 7, 29}, {4, 8, 19}, {4, 9, 13}, {4, 10, 17}, {4, 11, 27}, {4, 12, 38}, {5, 6, 38}, {5, 7, 25}, {5, 8, 12}, {5, 9, 0}, {5, 10, 12}, {5, 11, 25}, {5, 12, 38},
+  {2, 10, 38}, {2, 11, 38}, {3, 8, 38}, {3, 9, 30}, {3, 10, 26}, {3, 11, 27}, {3, 12, 34}, {4, 7, 40}, {4, 8, 29}, {4, 9, 19}, {4, 10, 13}, {4, 11, 17}, {4, 12, 27}, {4, 13, 38}, {5, 7, 37}, {5, 8, 24}, {5, 9, 12}, {5, 10, 0}, {5, 11, 13}, {5, 12, 26}, {5, 13, 38},
+  {2, 11, 38}, {2, 12, 38}, {3, 9, 38}, {3, 10, 30}, {3, 11, 26}, {3, 12, 27}, {3, 13, 34}, {4, 9, 29}, {4, 10, 19}, {4, 11, 13}, {4, 12, 17}, {4, 13, 26}, {4, 14, 38}, {5, 8, 37}, {5, 9, 25}, {5, 10, 13}, {5, 11, 0}, {5, 12, 13}, {5, 13, 25}, {5, 14, 37},
+  {2, 12, 38}, {2, 13, 38}, {3, 10, 38}, {3, 11, 30}, {3, 12, 26}, {3, 13, 27}, {3, 14, 34}, {4, 10, 29}, {4, 11, 19}, {4, 12, 13}, {4, 13, 16}, {4, 14, 26}, {4, 15, 38}, {5, 9, 38}, {5, 10, 26}, {5, 11, 13}, {5, 12, 0}, {5, 13, 12}, {5, 14, 24}, {5, 15, 37},
+  {2, 13, 38}, {2, 14, 38}, {3, 11, 38}, {3, 12, 30}, {3, 13, 26}, {3, 14, 27}, {3, 15, 34}, {4, 11, 29}, {4, 12, 19}, {4, 13, 13}, {4, 14, 17}, {4, 15, 27}, {4, 16, 38}, {5, 10, 38}, {5, 11, 25}, {5, 12, 12}, {5, 13, 0}, {5, 14, 12}, {5, 15, 25}, {5, 16, 38},
+  {2, 14, 38}, {2, 15, 38}, {3, 12, 38}, {3, 13, 30}, {3, 14, 26}, {3, 15, 27}, {3, 16, 34}, {4, 11, 40}, {4, 12, 29}, {4, 13, 19}, {4, 14, 13}, {4, 15, 17}, {4, 16, 27}, {4, 17, 38}, {5, 11, 37}, {5, 12, 24}, {5, 13, 12}, {5, 14, 0}, {5, 15, 13}, {5, 16, 26}, {5, 17, 38},
+  {2, 15, 38}, {2, 16, 38}, {3, 13, 38}, {3, 14, 30}, {3, 15, 26}, {3, 16, 27}, {3, 17, 34}, {4, 13, 29}, {4, 14, 19}, {4, 15, 13}, {4, 16, 17}, {4, 17, 26}, {5, 12, 37}, {5, 13, 25}, {5, 14, 13}, {5, 15, 0}, {5, 16, 13}, {5, 17, 25},
+  {2, 16, 38}, {2, 17, 38}, {3, 14, 38}, {3, 15, 30}, {3, 16, 26}, {3, 17, 27}, {4, 14, 29}, {4, 15, 19}, {4, 16, 13}, {4, 17, 16}, {5, 13, 38}, {5, 14, 26}, {5, 15, 13}, {5, 16, 0}, {5, 17, 12},
+  {2, 17, 38}, {3, 15, 38}, {3, 16, 30}, {3, 17, 26}, {4, 15, 29}, {4, 16, 19}, {4, 17, 13}, {5, 14, 38}, {5, 15, 25}, {5, 16, 12}, {5, 17, 0},
+};
+#endif
+#endif
+#ifdef RGB_MATRIX_GEOMETRY_PAIRWISE
+__attribute__ ((weak)) const uint8_t PROGMEM g_rgb_matrix_pairwise_dist[] = {
+  12,
+  25, 13,
+  38, 26, 13,
+  50, 38, 25, 12,
+  62, 50, 37, 24, 12,
+  75, 63, 50, 37, 25, 13,
+  88, 76, 63, 50, 38, 26, 13,
+  100, 88, 75, 62, 50, 38, 25, 12,
+  112, 100, 87, 74, 62, 50, 37, 24, 12,
+  125, 113, 100, 87, 75, 63, 50, 37, 25, 13,
+  138, 126, 113, 100, 88, 76, 63, 50, 38, 26, 13,
+  150, 138, 125, 112, 100, 88, 75, 62, 50, 38, 25, 12,
+  162, 150, 137, 124, 112, 100, 87, 74, 62, 50, 37, 24, 12,
+  175, 163, 150, 137, 125, 113, 100, 87, 75, 63, 50, 37, 25, 13,
+  188, 176, 163, 150, 138, 126, 113, 100, 88, 76, 63, 50, 38, 26, 13,
+  200, 188, 175, 162, 150, 138, 125, 112, 100, 88, 75, 62, 50, 38, 25, 12,
+  212, 200, 187, 174, 162, 150, 137, 124, 112, 100, 87, 74, 62, 50, 37, 24, 12,
+  13, 16, 26, 38, 49, 61, 74, 86, 98, 110, 123, 136, 148, 160, 173, 186, 198, 210,
+  19, 13, 17, 27, 38, 49, 62, 75, 86, 98, 111, 124, 136, 148, 161, 174, 186, 198, 12,
+  29, 19, 13, 17, 27, 38, 50, 63, 75, 86, 99, 112, 124, 136, 149, 162, 174, 186, 24, 12,
+  41, 29, 19, 13, 17, 26, 38, 50, 62, 74, 86, 99, 111, 123, 136, 149, 161, 173, 37, 25, 13,
+  53, 42, 29, 19, 13, 16, 26, 38, 49, 61, 74, 86, 98, 110, 123, 136, 148, 160, 50, 38, 26, 13,
+  65, 53, 41, 29, 19, 13, 17, 27, 38, 49, 62, 75, 86, 98, 111, 124, 136, 148, 62, 50, 38, 25, 12,
+  77, 65, 52, 40, 29, 19, 13, 17, 27, 38, 50, 63, 75, 86, 99, 112, 124, 136, 74, 62, 50, 37, 24, 12,
+  89, 78, 65, 52, 41, 29, 19, 13, 17, 26, 38, 50, 62, 74, 86, 99, 111, 123, 87, 75, 63, 50, 37, 25, 13,
+  102, 90, 78, 65, 53, 42, 29, 19, 13, 16, 26, 38, 49, 61, 74, 86, 98, 110, 100, 88, 76, 63, 50, 38, 26, 13,
+  114, 102, 89, 77, 65, 53, 41, 29, 19, 13, 17, 27, 38, 49, 62, 75, 86, 98, 112, 100, 88, 75, 62, 50, 38, 25, 12,
+  126, 114, 101, 88, 77, 65, 52, 40, 29, 19, 13, 17, 27, 38, 50, 63, 75, 86, 124, 112, 100, 87, 74, 62, 50, 37, 24, 12,
+  139, 127, 114, 101, 89, 78, 65, 52, 41, 29, 19, 13, 17, 26, 38, 50, 62, 74, 137, 125, 113, 100, 87, 75, 63, 50, 37, 25, 13,
+  152, 140, 127, 114, 102, 90, 78, 65, 53, 42, 29, 19, 13, 16, 26, 38, 49, 61, 150, 138, 126, 113, 100, 88, 76, 63, 50, 38, 26, 13,
+  164, 152, 139, 126, 114, 102, 89, 77, 65, 53, 41, 29, 19, 13, 17, 27, 38, 49, 162, 150, 138, 125, 112, 100, 88, 75, 62, 50, 38, 25, 12,
+  176, 164, 151, 138, 126, 114, 101, 88, 77, 65, 52, 40, 29, 19, 13, 17, 27, 38, 174, 162, 150, 137, 124, 112, 100, 87, 74, 62, 50, 37, 24, 12,
+  189, 177, 164, 151, 139, 127, 114, 101, 89, 78, 65, 52, 41, 29, 19, 13, 17, 26, 187, 175, 163, 150, 137, 125, 113, 100, 87, 75, 63, 50, 37, 25, 13,
+  202, 190, 177, 164, 152, 140, 127, 114, 102, 90, 78, 65, 53, 42, 29, 19, 13, 16, 200, 188, 176, 163, 150, 138, 126, 113, 100, 88, 76, 63, 50, 38, 26, 13,
+  214, 202, 189, 176, 164, 152, 139, 126, 114, 102, 89, 77, 65, 53, 41, 29, 19, 13, 212, 200, 188, 175, 162, 150, 138, 125, 112, 100, 88, 75, 62, 50, 38, 25, 12,
+  26, 27, 34, 43, 53, 64, 76, 88, 100, 112, 124, 137, 149, 161, 173, 186, 198, 210, 13, 17, 26, 38, 50, 62, 74, 86, 99, 111, 123, 136, 149, 161, 173, 186, 199, 211,
+  30, 26, 27, 34, 42, 52, 64, 76, 87, 99, 112, 124, 136, 148, 161, 173, 185, 197, 19, 13, 16, 26, 38, 49, 61, 74, 86, 98, 110, 123, 136, 148, 160, 173, 186, 198, 13,
+  38, 30, 26, 27, 34, 42, 53, 65, 76, 87, 100, 113, 124, 136, 149, 162, 173, 185, 29, 19, 13, 17, 27, 38, 49, 62, 75, 86, 98, 111, 124, 136, 148, 161, 174, 186, 25, 12,
+  47, 38, 30, 26, 27, 34, 43, 54, 65, 76, 88, 101, 113, 124, 137, 150, 162, 173, 40, 29, 19, 13, 17, 27, 38, 50, 63, 75, 86, 99, 112, 124, 136, 149, 162, 174, 37, 24, 12,
+  59, 48, 38, 30, 26, 27, 34, 43, 53, 64, 76, 88, 100, 112, 124, 137, 149, 161, 52, 41, 29, 19, 13, 17, 26, 38, 50, 62, 74, 86, 99, 111, 123, 136, 149, 161, 50, 37, 25, 13,
+  70, 59, 48, 38, 30, 26, 27, 34, 42, 52, 64, 76, 87, 99, 112, 124, 136, 148, 65, 53, 42, 29, 19, 13, 16, 26, 38, 49, 61, 74, 86, 98, 110, 123, 136, 148, 63, 50, 38, 26, 13,
+  82, 70, 59, 47, 38, 30, 26, 27, 34, 42, 53, 65, 76, 87, 100, 113, 124, 136, 77, 65, 53, 41, 29, 19, 13, 17, 27, 38, 49, 62, 75, 86, 98, 111, 124, 136, 75, 62, 50, 38, 25, 12,
+  93, 82, 70, 58, 47, 38, 30, 26, 27, 34, 43, 54, 65, 76, 88, 101, 113, 124, 88, 77, 65, 52, 40, 29, 19, 13, 17, 27, 38, 50, 63, 75, 86, 99, 112, 124, 87, 74, 62, 50, 37, 24, 12,
+  106, 94, 82, 70, 59, 48, 38, 30, 26, 27, 34, 43, 53, 64, 76, 88, 100, 112, 101, 89, 78, 65, 52, 41, 29, 19, 13, 17, 26, 38, 50, 62, 74, 86, 99, 111, 100, 87, 75, 63, 50, 37, 25, 13,
+  118, 107, 94, 82, 70, 59, 48, 38, 30, 26, 27, 34, 42, 52, 64, 76, 87, 99, 114, 102, 90, 78, 65, 53, 42, 29, 19, 13, 16, 26, 38, 49, 61, 74, 86, 98, 113, 100, 88, 76, 63, 50, 38, 26, 13,
+  130, 118, 106, 93, 82, 70, 59, 47, 38, 30, 26, 27, 34, 42, 53, 65, 76, 87, 126, 114, 102, 89, 77, 65, 53, 41, 29, 19, 13, 17, 27, 38, 49, 62, 75, 86, 125, 112, 100, 88, 75, 62, 50, 38, 25, 12,
+  142, 130, 117, 105, 93, 82, 70, 58, 47, 38, 30, 26, 27, 34, 43, 54, 65, 76, 138, 126, 114, 101, 88, 77, 65, 52, 40, 29, 19, 13, 17, 27, 38, 50, 63, 75, 137, 124, 112, 100, 87, 74, 62, 50, 37, 24, 12,
+  155, 143, 130, 117, 106, 94, 82, 70, 59, 48, 38, 30, 26, 27, 34, 43, 53, 64, 151, 139, 127, 114, 101, 89, 78, 65, 52, 41, 29, 19, 13, 17, 26, 38, 50, 62, 150, 137, 125, 113, 100, 87, 75, 63, 50, 37, 25, 13,
+  168, 156, 143, 130, 118, 107, 94, 82, 70, 59, 48, 38, 30, 26, 27, 34, 42, 52, 164, 152, 140, 127, 114, 102, 90, 78, 65, 53, 42, 29, 19, 13, 16, 26, 38, 49, 163, 150, 138, 126, 113, 100, 88, 76, 63, 50, 38, 26, 13,
+  179, 168, 155, 142, 130, 118, 106, 93, 82, 70, 59, 47, 38, 30, 26, 27, 34, 42, 176, 164, 152, 139, 126, 114, 102, 89, 77, 65, 53, 41, 29, 19, 13, 17, 27, 38, 175, 162, 150, 138, 125, 112, 100, 88, 75, 62, 50, 38, 25, 12,
+  191, 179, 167, 154, 142, 130, 117, 105, 93, 82, 70, 58, 47, 38, 30, 26, 27, 34, 188, 176, 164, 151, 138, 126, 114, 101, 88, 77, 65, 52, 40, 29, 19, 13, 17, 27, 187, 174, 162, 150, 137, 124, 112, 100, 87, 74, 62, 50, 37, 24, 12,
+  204, 192, 179, 167, 155, 143, 130, 117, 106, 94, 82, 70, 59, 48, 38, 30, 26, 27, 201, 189, 177, 164, 151, 139, 127, 114, 101, 89, 78, 65, 52, 41, 29, 19, 13, 17, 200, 187, 175, 163, 150, 137, 125, 113, 100, 87, 75, 63, 50, 37, 25, 13,
+  217, 205, 192, 179, 168, 156, 143, 130, 118, 107, 94, 82, 70, 59, 48, 38, 30, 26, 214, 202, 190, 177, 164, 152, 140, 127, 114, 102, 90, 78, 65, 53, 42, 29, 19, 13, 213, 200, 188, 176, 163, 150, 138, 126, 113, 100, 88, 76, 63, 50, 38, 26, 13,
+  38, 38, 43, 50, 59, 69, 80, 92, 103, 114, 126, 139, 150, 162, 175, 187, 199, 211, 25, 26, 33, 43, 54, 65, 76, 88, 101, 112, 124, 137, 150, 161, 173, 186, 199, 211, 12, 16, 26, 37, 50, 63, 74, 86, 99, 112, 124, 136, 149, 162, 174, 186, 199, 212,
+  41, 38, 38, 43, 50, 58, 69, 80, 91, 102, 114, 126, 138, 149, 162, 175, 186, 198, 29, 25, 26, 33, 43, 53, 64, 76, 88, 100, 111, 124, 137, 149, 160, 173, 186, 198, 18, 12, 16, 25, 37, 50, 62, 73, 86, 99, 111, 123, 136, 149, 161, 173, 186, 199, 13,
+  48, 42, 38, 38, 42, 49, 58, 69, 79, 90, 102, 114, 125, 137, 149, 162, 174, 185, 37, 29, 25, 26, 33, 42, 52, 64, 76, 87, 99, 111, 124, 136, 148, 160, 173, 185, 29, 18, 12, 15, 25, 37, 49, 61, 73, 86, 98, 110, 123, 136, 148, 160, 173, 186, 26, 13,
+  56, 48, 41, 38, 38, 42, 50, 59, 69, 79, 91, 103, 114, 125, 138, 150, 162, 174, 47, 37, 29, 25, 26, 33, 42, 53, 65, 76, 87, 100, 112, 124, 136, 149, 161, 173, 40, 28, 18, 12, 16, 26, 37, 49, 62, 74, 86, 98, 111, 124, 136, 148, 161, 174, 38, 25, 12,
+  66, 56, 47, 41, 38, 38, 43, 50, 59, 69, 80, 92, 103, 114, 126, 139, 150, 162, 57, 47, 37, 29, 25, 26, 33, 43, 54, 65, 76, 88, 101, 112, 124, 137, 150, 161, 52, 39, 28, 18, 12, 16, 26, 37, 50, 63, 74, 86, 99, 112, 124, 136, 149, 162, 50, 37, 24, 12,
+  77, 66, 56, 47, 41, 38, 38, 43, 50, 58, 69, 80, 91, 102, 114, 126, 138, 149, 69, 58, 48, 37, 29, 25, 26, 33, 43, 53, 64, 76, 88, 100, 111, 124, 137, 149, 65, 52, 40, 29, 18, 12, 16, 25, 37, 50, 62, 73, 86, 99, 111, 123, 136, 149, 63, 50, 37, 25, 13,
+  88, 77, 66, 56, 48, 42, 38, 38, 42, 49, 58, 69, 79, 90, 102, 114, 125, 137, 81, 70, 59, 48, 37, 29, 25, 26, 33, 42, 52, 64, 76, 87, 99, 111, 124, 136, 77, 65, 53, 41, 29, 18, 12, 15, 25, 37, 49, 61, 73, 86, 98, 110, 123, 136, 76, 63, 50, 38, 26, 13,
+  99, 88, 77, 66, 56, 48, 41, 38, 38, 42, 50, 59, 69, 79, 91, 103, 114, 125, 93, 81, 70, 58, 47, 37, 29, 25, 26, 33, 42, 53, 65, 76, 87, 100, 112, 124, 89, 76, 65, 53, 40, 28, 18, 12, 16, 26, 37, 49, 62, 74, 86, 98, 111, 124, 88, 75, 62, 50, 38, 25, 12,
+  110, 99, 87, 76, 66, 56, 47, 41, 38, 38, 43, 50, 59, 69, 80, 92, 103, 114, 105, 93, 81, 69, 57, 47, 37, 29, 25, 26, 33, 43, 54, 65, 76, 88, 101, 112, 101, 88, 76, 65, 52, 39, 28, 18, 12, 16, 26, 37, 50, 63, 74, 86, 99, 112, 100, 87, 74, 62, 50, 37, 24, 12,
+  123, 111, 99, 87, 77, 66, 56, 47, 41, 38, 38, 43, 50, 58, 69, 80, 91, 102, 117, 105, 94, 81, 69, 58, 48, 37, 29, 25, 26, 33, 43, 53, 64, 76, 88, 100, 114, 101, 89, 77, 65, 52, 40, 29, 18, 12, 16, 25, 37, 50, 62, 73, 86, 99, 113, 100, 87, 75, 63, 50, 37, 25, 13,
+  135, 123, 111, 99, 88, 77, 66, 56, 48, 42, 38, 38, 42, 49, 58, 69, 79, 90, 130, 118, 106, 94, 81, 70, 59, 48, 37, 29, 25, 26, 33, 42, 52, 64, 76, 87, 127, 114, 102, 90, 77, 65, 53, 41, 29, 18, 12, 15, 25, 37, 49, 61, 73, 86, 126, 113, 100, 88, 76, 63, 50, 38, 26, 13,
+  146, 135, 123, 110, 99, 88, 77, 66, 56, 48, 41, 38, 38, 42, 50, 59, 69, 79, 142, 130, 118, 105, 93, 81, 70, 58, 47, 37, 29, 25, 26, 33, 42, 53, 65, 76, 139, 126, 114, 102, 89, 76, 65, 53, 40, 28, 18, 12, 16, 26, 37, 49, 62, 74, 138, 125, 112, 100, 88, 75, 62, 50, 38, 25, 12,
+  158, 146, 134, 122, 110, 99, 87, 76, 66, 56, 47, 41, 38, 38, 43, 50, 59, 69, 154, 142, 130, 117, 105, 93, 81, 69, 57, 47, 37, 29, 25, 26, 33, 43, 54, 65, 151, 138, 126, 114, 101, 88, 76, 65, 52, 39, 28, 18, 12, 16, 26, 37, 50, 63, 150, 137, 124, 112, 100, 87, 74, 62, 50, 37, 24, 12,
+  171, 159, 146, 134, 123, 111, 99, 87, 77, 66, 56, 47, 41, 38, 38, 43, 50, 58, 166, 155, 143, 130, 117, 105, 94, 81, 69, 58, 48, 37, 29, 25, 26, 33, 43, 53, 164, 151, 139, 127, 114, 101, 89, 77, 65, 52, 40, 29, 18, 12, 16, 25, 37, 50, 163, 150, 137, 125, 113, 100, 87, 75, 63, 50, 37, 25, 13,
+  183, 172, 159, 146, 135, 123, 111, 99, 88, 77, 66, 56, 48, 42, 38, 38, 42, 49, 179, 167, 156, 143, 130, 118, 106, 94, 81, 70, 59, 48, 37, 29, 25, 26, 33, 42, 177, 164, 152, 140, 127, 114, 102, 90, 77, 65, 53, 41, 29, 18, 12, 15, 25, 37, 176, 163, 150, 138, 126, 113, 100, 88, 76, 63, 50, 38, 26, 13,
+  195, 183, 171, 158, 146, 135, 123, 110, 99, 88, 77, 66, 56, 48, 41, 38, 38, 42, 191, 179, 167, 155, 142, 130, 118, 105, 93, 81, 70, 58, 47, 37, 29, 25, 26, 33, 189, 176, 164, 152, 139, 126, 114, 102, 89, 76, 65, 53, 40, 28, 18, 12, 16, 26, 188, 175, 162, 150, 138, 125, 112, 100, 88, 75, 62, 50, 38, 25, 12,
+  207, 195, 182, 170, 158, 146, 134, 122, 110, 99, 87, 76, 66, 56, 47, 41, 38, 38, 203, 191, 179, 166, 154, 142, 130, 117, 105, 93, 81, 69, 57, 47, 37, 29, 25, 26, 201, 188, 176, 164, 151, 138, 126, 114, 101, 88, 76, 65, 52, 39, 28, 18, 12, 16, 200, 187, 174, 162, 150, 137, 124, 112, 100, 87, 74, 62, 50, 37, 24, 12,
+  220, 208, 195, 182, 171, 159, 146, 134, 123, 111, 99, 87, 77, 66, 56, 47, 41, 38, 216, 204, 192, 179, 166, 155, 143, 130, 117, 105, 94, 81, 69, 58, 48, 37, 29, 25, 214, 201, 189, 177, 164, 151, 139, 127, 114, 101, 89, 77, 65, 52, 40, 29, 18, 12, 213, 200, 187, 175, 163, 150, 137, 125, 113, 100, 87, 75, 63, 50, 37, 25, 13,
+  51, 51, 54, 60, 67, 75, 85, 96, 106, 117, 129, 141, 152, 164, 176, 189, 200, 212, 38, 38, 42, 50, 59, 69, 79, 91, 103, 114, 125, 138, 150, 162, 174, 186, 199, 211, 25, 26, 33, 42, 53, 65, 76, 87, 100, 112, 124, 136, 149, 161, 173, 185, 198, 211, 13, 17, 27, 38, 49, 62, 75, 86, 98, 111, 124, 136, 148, 161, 174, 186, 198, 211,
+  54, 51, 51, 54, 60, 67, 76, 86, 96, 106, 118, 130, 141, 152, 165, 177, 189, 200, 41, 38, 38, 43, 50, 59, 69, 80, 92, 103, 114, 126, 139, 150, 162, 175, 187, 199, 29, 25, 26, 33, 43, 54, 65, 76, 88, 101, 112, 124, 137, 150, 161, 173, 186, 199, 19, 13, 17, 27, 38, 50, 63, 75, 86, 99, 112, 124, 136, 149, 162, 174, 186, 199, 12,
+  59, 54, 51, 51, 54, 59, 67, 76, 85, 95, 106, 118, 129, 140, 152, 165, 176, 188, 47, 41, 38, 38, 43, 50, 58, 69, 80, 91, 102, 114, 126, 138, 149, 162, 175, 186, 37, 29, 25, 26, 33, 43, 53, 64, 76, 88, 100, 111, 124, 137, 149, 160, 173, 186, 29, 19, 13, 17, 26, 38, 50, 62, 74, 86, 99, 111, 123, 136, 149, 161, 173, 186, 25, 13,
+  67, 60, 54, 51, 51, 54, 59, 67, 75, 85, 95, 106, 117, 128, 140, 152, 164, 175, 56, 48, 42, 38, 38, 42, 49, 58, 69, 79, 90, 102, 114, 125, 137, 149, 162, 174, 48, 37, 29, 25, 26, 33, 42, 52, 64, 76, 87, 99, 111, 124, 136, 148, 160, 173, 42, 29, 19, 13, 16, 26, 38, 49, 61, 74, 86, 98, 110, 123, 136, 148, 160, 173, 38, 26, 13,
+  75, 67, 59, 54, 51, 51, 54, 60, 67, 75, 85, 96, 106, 117, 129, 141, 152, 164, 66, 56, 48, 41, 38, 38, 42, 50, 59, 69, 79, 91, 103, 114, 125, 138, 150, 162, 58, 47, 37, 29, 25, 26, 33, 42, 53, 65, 76, 87, 100, 112, 124, 136, 149, 161, 53, 41, 29, 19, 13, 17, 27, 38, 49, 62, 75, 86, 98, 111, 124, 136, 148, 161, 50, 38, 25, 12,
+  85, 75, 66, 59, 54, 51, 51, 54, 60, 67, 76, 86, 96, 106, 118, 130, 141, 152, 76, 66, 56, 47, 41, 38, 38, 43, 50, 59, 69, 80, 92, 103, 114, 126, 139, 150, 69, 57, 47, 37, 29, 25, 26, 33, 43, 54, 65, 76, 88, 101, 112, 124, 137, 150, 65, 52, 40, 29, 19, 13, 17, 27, 38, 50, 63, 75, 86, 99, 112, 124, 136, 149, 62, 50, 37, 24, 12,
+  95, 85, 75, 66, 59, 54, 51, 51, 54, 59, 67, 76, 85, 95, 106, 118, 129, 140, 87, 77, 66, 56, 47, 41, 38, 38, 43, 50, 58, 69, 80, 91, 102, 114, 126, 138, 81, 69, 58, 48, 37, 29, 25, 26, 33, 43, 53, 64, 76, 88, 100, 111, 124, 137, 78, 65, 52, 41, 29, 19, 13, 17, 26, 38, 50, 62, 74, 86, 99, 111, 123, 136, 75, 63, 50, 37, 25, 13,
+  106, 96, 85, 75, 67, 60, 54, 51, 51, 54, 59, 67, 75, 85, 95, 106, 117, 128, 99, 88, 77, 66, 56, 48, 42, 38, 38, 42, 49, 58, 69, 79, 90, 102, 114, 125, 94, 81, 70, 59, 48, 37, 29, 25, 26, 33, 42, 52, 64, 76, 87, 99, 111, 124, 90, 78, 65, 53, 42, 29, 19, 13, 16, 26, 38, 49, 61, 74, 86, 98, 110, 123, 88, 76, 63, 50, 38, 26, 13,
+  117, 106, 95, 85, 75, 67, 59, 54, 51, 51, 54, 60, 67, 75, 85, 96, 106, 117, 110, 99, 88, 77, 66, 56, 48, 41, 38, 38, 42, 50, 59, 69, 79, 91, 103, 114, 105, 93, 81, 70, 58, 47, 37, 29, 25, 26, 33, 42, 53, 65, 76, 87, 100, 112, 102, 89, 77, 65, 53, 41, 29, 19, 13, 17, 27, 38, 49, 62, 75, 86, 98, 111, 100, 88, 75, 62, 50, 38, 25, 12,
+  128, 117, 106, 94, 85, 75, 66, 59, 54, 51, 51, 54, 60, 67, 76, 86, 96, 106, 122, 110, 99, 87, 76, 66, 56, 47, 41, 38, 38, 43, 50, 59, 69, 80, 92, 103, 117, 105, 93, 81, 69, 57, 47, 37, 29, 25, 26, 33, 43, 54, 65, 76, 88, 101, 114, 101, 88, 77, 65, 52, 40, 29, 19, 13, 17, 27, 38, 50, 63, 75, 86, 99, 112, 100, 87, 74, 62, 50, 37, 24, 12,
+  140, 129, 117, 106, 95, 85, 75, 66, 59, 54, 51, 51, 54, 59, 67, 76, 85, 95, 134, 123, 111, 99, 87, 77, 66, 56, 47, 41, 38, 38, 43, 50, 58, 69, 80, 91, 130, 117, 105, 94, 81, 69, 58, 48, 37, 29, 25, 26, 33, 43, 53, 64, 76, 88, 127, 114, 101, 89, 78, 65, 52, 41, 29, 19, 13, 17, 26, 38, 50, 62, 74, 86, 125, 113, 100, 87, 75, 63, 50, 37, 25, 13,
+  152, 141, 129, 117, 106, 96, 85, 75, 67, 60, 54, 51, 51, 54, 59, 67, 75, 85, 146, 135, 123, 111, 99, 88, 77, 66, 56, 48, 42, 38, 38, 42, 49, 58, 69, 79, 143, 130, 118, 106, 94, 81, 70, 59, 48, 37, 29, 25, 26, 33, 42, 52, 64, 76, 140, 127, 114, 102, 90, 78, 65, 53, 42, 29, 19, 13, 16, 26, 38, 49, 61, 74, 138, 126, 113, 100, 88, 76, 63, 50, 38, 26, 13,
+  164, 152, 140, 128, 117, 106, 95, 85, 75, 67, 59, 54, 51, 51, 54, 60, 67, 75, 158, 146, 135, 123, 110, 99, 88, 77, 66, 56, 48, 41, 38, 38, 42, 50, 59, 69, 155, 142, 130, 118, 105, 93, 81, 70, 58, 47, 37, 29, 25, 26, 33, 42, 53, 65, 152, 139, 126, 114, 102, 89, 77, 65, 53, 41, 29, 19, 13, 17, 27, 38, 49, 62, 150, 138, 125, 112, 100, 88, 75, 62, 50, 38, 25, 12,
+  175, 164, 151, 139, 128, 117, 106, 94, 85, 75, 66, 59, 54, 51, 51, 54, 60, 67, 170, 158, 146, 134, 122, 110, 99, 87, 76, 66, 56, 47, 41, 38, 38, 43, 50, 59, 166, 154, 142, 130, 117, 105, 93, 81, 69, 57, 47, 37, 29, 25, 26, 33, 43, 54, 164, 151, 138, 126, 114, 101, 88, 77, 65, 52, 40, 29, 19, 13, 17, 27, 38, 50, 162, 150, 137, 124, 112, 100, 87, 74, 62, 50, 37, 24, 12,
+  188, 176, 164, 151, 140, 129, 117, 106, 95, 85, 75, 66, 59, 54, 51, 51, 54, 59, 182, 171, 159, 146, 134, 123, 111, 99, 87, 77, 66, 56, 47, 41, 38, 38, 43, 50, 179, 166, 155, 143, 130, 117, 105, 94, 81, 69, 58, 48, 37, 29, 25, 26, 33, 43, 177, 164, 151, 139, 127, 114, 101, 89, 78, 65, 52, 41, 29, 19, 13, 17, 26, 38, 175, 163, 150, 137, 125, 113, 100, 87, 75, 63, 50, 37, 25, 13,
+  200, 189, 176, 164, 152, 141, 129, 117, 106, 96, 85, 75, 67, 60, 54, 51, 51, 54, 195, 183, 172, 159, 146, 135, 123, 111, 99, 88, 77, 66, 56, 48, 42, 38, 38, 42, 192, 179, 167, 156, 143, 130, 118, 106, 94, 81, 70, 59, 48, 37, 29, 25, 26, 33, 190, 177, 164, 152, 140, 127, 114, 102, 90, 78, 65, 53, 42, 29, 19, 13, 16, 26, 188, 176, 163, 150, 138, 126, 113, 100, 88, 76, 63, 50, 38, 26, 13,
+  212, 200, 188, 175, 164, 152, 140, 128, 117, 106, 95, 85, 75, 67, 59, 54, 51, 51, 207, 195, 183, 171, 158, 146, 135, 123, 110, 99, 88, 77, 66, 56, 48, 41, 38, 38, 204, 191, 179, 167, 155, 142, 130, 118, 105, 93, 81, 70, 58, 47, 37, 29, 25, 26, 202, 189, 176, 164, 152, 139, 126, 114, 102, 89, 77, 65, 53, 41, 29, 19, 13, 17, 200, 188, 175, 162, 150, 138, 125, 112, 100, 88, 75, 62, 50, 38, 25, 12,
+  223, 212, 199, 187, 175, 164, 151, 139, 128, 117, 106, 94, 85, 75, 66, 59, 54, 51, 219, 207, 195, 182, 170, 158, 146, 134, 122, 110, 99, 87, 76, 66, 56, 47, 41, 38, 216, 203, 191, 179, 166, 154, 142, 130, 117, 105, 93, 81, 69, 57, 47, 37, 29, 25, 214, 201, 188, 176, 164, 151, 138, 126, 114, 101, 88, 77, 65, 52, 40, 29, 19, 13, 212, 200, 187, 174, 162, 150, 137, 124, 112, 100, 87, 74, 62, 50, 37, 24, 12,
+  64, 64, 66, 70, 76, 83, 92, 102, 112, 122, 133, 144, 155, 166, 178, 191, 202, 213, 51, 51, 54, 59, 67, 75, 85, 95, 106, 117, 128, 140, 152, 164, 175, 188, 200, 212, 38, 38, 42, 49, 58, 69, 79, 90, 102, 114, 125, 137, 149, 162, 174, 185, 198, 211, 26, 27, 34, 42, 52, 64, 76, 87, 99, 112, 124, 136, 148, 161, 173, 185, 197, 210, 13, 16, 26, 38, 49, 61, 74, 86, 98, 110, 123, 136, 148, 160, 173, 186, 198, 210,
+  67, 64, 64, 66, 70, 76, 84, 93, 102, 112, 122, 134, 144, 155, 167, 179, 191, 202, 54, 51, 51, 54, 60, 67, 75, 85, 96, 106, 117, 129, 141, 152, 164, 176, 189, 200, 41, 38, 38, 42, 50, 59, 69, 79, 91, 103, 114, 125, 138, 150, 162, 174, 186, 199, 30, 26, 27, 34, 42, 53, 65, 76, 87, 100, 113, 124, 136, 149, 162, 173, 185, 198, 19, 13, 17, 27, 38, 49, 62, 75, 86, 98, 111, 124, 136, 148, 161, 174, 186, 198, 12,
+  71, 67, 64, 64, 66, 70, 77, 85, 93, 102, 112, 123, 134, 144, 156, 168, 179, 191, 59, 54, 51, 51, 54, 60, 67, 76, 86, 96, 106, 118, 130, 141, 152, 165, 177, 189, 47, 41, 38, 38, 43, 50, 59, 69, 80, 92, 103, 114, 126, 139, 150, 162, 175, 187, 38, 30, 26, 27, 34, 43, 54, 65, 76, 88, 101, 113, 124, 137, 150, 162, 173, 186, 29, 19, 13, 17, 27, 38, 50, 63, 75, 86, 99, 112, 124, 136, 149, 162, 174, 186, 24, 12,
+  78, 72, 67, 64, 64, 66, 70, 77, 84, 92, 102, 112, 122, 133, 144, 156, 167, 178, 66, 59, 54, 51, 51, 54, 59, 67, 76, 85, 95, 106, 118, 129, 140, 152, 165, 176, 56, 47, 41, 38, 38, 43, 50, 58, 69, 80, 91, 102, 114, 126, 138, 149, 162, 175, 48, 38, 30, 26, 27, 34, 43, 53, 64, 76, 88, 100, 112, 124, 137, 149, 161, 173, 41, 29, 19, 13, 17, 26, 38, 50, 62, 74, 86, 99, 111, 123, 136, 149, 161, 173, 37, 25, 13,
+  86, 78, 72, 67, 64, 64, 66, 70, 76, 83, 92, 102, 112, 122, 133, 144, 155, 166, 75, 67, 60, 54, 51, 51, 54, 59, 67, 75, 85, 95, 106, 117, 128, 140, 152, 164, 66, 56, 48, 42, 38, 38, 42, 49, 58, 69, 79, 90, 102, 114, 125, 137, 149, 162, 59, 48, 38, 30, 26, 27, 34, 42, 52, 64, 76, 87, 99, 112, 124, 136, 148, 161, 53, 42, 29, 19, 13, 16, 26, 38, 49, 61, 74, 86, 98, 110, 123, 136, 148, 160, 50, 38, 26, 13,
+  94, 86, 78, 71, 67, 64, 64, 66, 70, 76, 84, 93, 102, 112, 122, 134, 144, 155, 85, 75, 67, 59, 54, 51, 51, 54, 60, 67, 75, 85, 96, 106, 117, 129, 141, 152, 77, 66, 56, 48, 41, 38, 38, 42, 50, 59, 69, 79, 91, 103, 114, 125, 138, 150, 70, 59, 47, 38, 30, 26, 27, 34, 42, 53, 65, 76, 87, 100, 113, 124, 136, 149, 65, 53, 41, 29, 19, 13, 17, 27, 38, 49, 62, 75, 86, 98, 111, 124, 136, 148, 62, 50, 38, 25, 12,
+  104, 94, 85, 77, 71, 67, 64, 64, 66, 70, 77, 85, 93, 102, 112, 123, 134, 144, 94, 85, 75, 66, 59, 54, 51, 51, 54, 60, 67, 76, 86, 96, 106, 118, 130, 141, 87, 76, 66, 56, 47, 41, 38, 38, 43, 50, 59, 69, 80, 92, 103, 114, 126, 139, 82, 70, 58, 47, 38, 30, 26, 27, 34, 43, 54, 65, 76, 88, 101, 113, 124, 137, 77, 65, 52, 40, 29, 19, 13, 17, 27, 38, 50, 63, 75, 86, 99, 112, 124, 136, 74, 62, 50, 37, 24, 12,
+  114, 104, 94, 85, 78, 72, 67, 64, 64, 66, 70, 77, 84, 92, 102, 112, 122, 133, 106, 95, 85, 75, 66, 59, 54, 51, 51, 54, 59, 67, 76, 85, 95, 106, 118, 129, 99, 87, 77, 66, 56, 47, 41, 38, 38, 43, 50, 58, 69, 80, 91, 102, 114, 126, 94, 82, 70, 59, 48, 38, 30, 26, 27, 34, 43, 53, 64, 76, 88, 100, 112, 124, 89, 78, 65, 52, 41, 29, 19, 13, 17, 26, 38, 50, 62, 74, 86, 99, 111, 123, 87, 75, 63, 50, 37, 25, 13,
+  125, 115, 104, 94, 86, 78, 72, 67, 64, 64, 66, 70, 76, 83, 92, 102, 112, 122, 117, 106, 96, 85, 75, 67, 60, 54, 51, 51, 54, 59, 67, 75, 85, 95, 106, 117, 111, 99, 88, 77, 66, 56, 48, 42, 38, 38, 42, 49, 58, 69, 79, 90, 102, 114, 107, 94, 82, 70, 59, 48, 38, 30, 26, 27, 34, 42, 52, 64, 76, 87, 99, 112, 102, 90, 78, 65, 53, 42, 29, 19, 13, 16, 26, 38, 49, 61, 74, 86, 98, 110, 100, 88, 76, 63, 50, 38, 26, 13,
+  136, 125, 114, 104, 94, 86, 78, 71, 67, 64, 64, 66, 70, 76, 84, 93, 102, 112, 128, 117, 106, 95, 85, 75, 67, 59, 54, 51, 51, 54, 60, 67, 75, 85, 96, 106, 123, 110, 99, 88, 77, 66, 56, 48, 41, 38, 38, 42, 50, 59, 69, 79, 91, 103, 118, 106, 93, 82, 70, 59, 47, 38, 30, 26, 27, 34, 42, 53, 65, 76, 87, 100, 114, 102, 89, 77, 65, 53, 41, 29, 19, 13, 17, 27, 38, 49, 62, 75, 86, 98, 112, 100, 88, 75, 62, 50, 38, 25, 12,
+  146, 136, 124, 113, 104, 94, 85, 77, 71, 67, 64, 64, 66, 70, 77, 85, 93, 102, 139, 128, 117, 106, 94, 85, 75, 66, 59, 54, 51, 51, 54, 60, 67, 76, 86, 96, 134, 122, 110, 99, 87, 76, 66, 56, 47, 41, 38, 38, 43, 50, 59, 69, 80, 92, 130, 117, 105, 93, 82, 70, 58, 47, 38, 30, 26, 27, 34, 43, 54, 65, 76, 88, 126, 114, 101, 88, 77, 65, 52, 40, 29, 19, 13, 17, 27, 38, 50, 63, 75, 86, 124, 112, 100, 87, 74, 62, 50, 37, 24, 12,
+  158, 147, 136, 124, 114, 104, 94, 85, 78, 72, 67, 64, 64, 66, 70, 77, 84, 92, 151, 140, 129, 117, 106, 95, 85, 75, 66, 59, 54, 51, 51, 54, 59, 67, 76, 85, 146, 134, 123, 111, 99, 87, 77, 66, 56, 47, 41, 38, 38, 43, 50, 58, 69, 80, 143, 130, 117, 106, 94, 82, 70, 59, 48, 38, 30, 26, 27, 34, 43, 53, 64, 76, 139, 127, 114, 101, 89, 78, 65, 52, 41, 29, 19, 13, 17, 26, 38, 50, 62, 74, 137, 125, 113, 100, 87, 75, 63, 50, 37, 25, 13,
+  170, 159, 147, 136, 125, 115, 104, 94, 86, 78, 72, 67, 64, 64, 66, 70, 76, 83, 164, 152, 141, 129, 117, 106, 96, 85, 75, 67, 60, 54, 51, 51, 54, 59, 67, 75, 159, 146, 135, 123, 111, 99, 88, 77, 66, 56, 48, 42, 38, 38, 42, 49, 58, 69, 156, 143, 130, 118, 107, 94, 82, 70, 59, 48, 38, 30, 26, 27, 34, 42, 52, 64, 152, 140, 127, 114, 102, 90, 78, 65, 53, 42, 29, 19, 13, 16, 26, 38, 49, 61, 150, 138, 126, 113, 100, 88, 76, 63, 50, 38, 26, 13,
+  181, 170, 158, 146, 136, 125, 114, 104, 94, 86, 78, 71, 67, 64, 64, 66, 70, 76, 175, 164, 152, 140, 128, 117, 106, 95, 85, 75, 67, 59, 54, 51, 51, 54, 60, 67, 171, 158, 146, 135, 123, 110, 99, 88, 77, 66, 56, 48, 41, 38, 38, 42, 50, 59, 168, 155, 142, 130, 118, 106, 93, 82, 70, 59, 47, 38, 30, 26, 27, 34, 42, 53, 164, 152, 139, 126, 114, 102, 89, 77, 65, 53, 41, 29, 19, 13, 17, 27, 38, 49, 162, 150, 138, 125, 112, 100, 88, 75, 62, 50, 38, 25, 12,
+  192, 181, 169, 157, 146, 136, 124, 113, 104, 94, 85, 77, 71, 67, 64, 64, 66, 70, 187, 175, 164, 151, 139, 128, 117, 106, 94, 85, 75, 66, 59, 54, 51, 51, 54, 60, 182, 170, 158, 146, 134, 122, 110, 99, 87, 76, 66, 56, 47, 41, 38, 38, 43, 50, 179, 167, 154, 142, 130, 117, 105, 93, 82, 70, 58, 47, 38, 30, 26, 27, 34, 43, 176, 164, 151, 138, 126, 114, 101, 88, 77, 65, 52, 40, 29, 19, 13, 17, 27, 38, 174, 162, 150, 137, 124, 112, 100, 87, 74, 62, 50, 37, 24, 12,
+  205, 193, 181, 169, 158, 147, 136, 124, 114, 104, 94, 85, 78, 72, 67, 64, 64, 66, 199, 188, 176, 164, 151, 140, 129, 117, 106, 95, 85, 75, 66, 59, 54, 51, 51, 54, 195, 182, 171, 159, 146, 134, 123, 111, 99, 87, 77, 66, 56, 47, 41, 38, 38, 43, 192, 179, 167, 155, 143, 130, 117, 106, 94, 82, 70, 59, 48, 38, 30, 26, 27, 34, 189, 177, 164, 151, 139, 127, 114, 101, 89, 78, 65, 52, 41, 29, 19, 13, 17, 26, 187, 175, 163, 150, 137, 125, 113, 100, 87, 75, 63, 50, 37, 25, 13,
+  217, 206, 193, 181, 170, 159, 147, 136, 125, 115, 104, 94, 86, 78, 72, 67, 64, 64, 212, 200, 189, 176, 164, 152, 141, 129, 117, 106, 96, 85, 75, 67, 60, 54, 51, 51, 208, 195, 183, 172, 159, 146, 135, 123, 111, 99, 88, 77, 66, 56, 48, 42, 38, 38, 205, 192, 179, 168, 156, 143, 130, 118, 107, 94, 82, 70, 59, 48, 38, 30, 26, 27, 202, 190, 177, 164, 152, 140, 127, 114, 102, 90, 78, 65, 53, 42, 29, 19, 13, 16, 200, 188, 176, 163, 150, 138, 126, 113, 100, 88, 76, 63, 50, 38, 26, 13,
+  229, 217, 205, 192, 181, 170, 158, 146, 136, 125, 114, 104, 94, 86, 78, 71, 67, 64, 223, 212, 200, 188, 175, 164, 152, 140, 128, 117, 106, 95, 85, 75, 67, 59, 54, 51, 220, 207, 195, 183, 171, 158, 146, 135, 123, 110, 99, 88, 77, 66, 56, 48, 41, 38, 217, 204, 191, 179, 168, 155, 142, 130, 118, 106, 93, 82, 70, 59, 47, 38, 30, 26, 214, 202, 189, 176, 164, 152, 139, 126, 114, 102, 89, 77, 65, 53, 41, 29, 19, 13, 212, 200, 188, 175, 162, 150, 138, 125, 112, 100, 88, 75, 62, 50, 38, 25, 12,
+};
+#endif
+#endif
+
@@ -0,0 +1,8 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+RGB_MATRIX_ENABLE = yes
+RGB_MATRIX_DRIVER = custom
+ENABLE_RGB_MATRIX_TIMELINE = yes
+
+SRC += led_config.c
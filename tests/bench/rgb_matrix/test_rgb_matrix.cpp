@@ -0,0 +1,103 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_bench.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+
+static uint32_t flushes = 0;
+
+static void bench_init(void) {}
+
+static void bench_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {}
+
+static void bench_set_color_all(uint8_t r, uint8_t g, uint8_t b) {}
+
+static void bench_flush(void) {
+    flushes++;
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = bench_init,
+    .set_color     = bench_set_color,
+    .set_color_all = bench_set_color_all,
+    .flush         = bench_flush,
+};
+}
+
+/* Renders an effect of each runner, and each distance based effect, while
+ * replaying a typing trace, so the reactive effects have hits to draw. Compare
+ * with the rgb_matrix_geometry suite, which runs the same effects from the
+ * precomputed geometry tables. */
+class RgbMatrixRender : public BenchFixture {
+   protected:
+    void SetUp() override {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                add_key(KeymapKey(0, col, row, KC_NO));
+            }
+        }
+        rgb_matrix_enable_noeeprom();
+    }
+
+    void render(const std::string& name, uint8_t mode) {
+        TestDriver driver;
+        rgb_matrix_mode_noeeprom(mode);
+        flushes = 0;
+
+        auto trace  = load_trace(__FILE__, "../typing/prose.trace");
+        auto result = replay(name, trace, driver);
+        EXPECT_GT(flushes, trace.back().time / RGB_MATRIX_LED_FLUSH_LIMIT / 2);
+    }
+};
+
+TEST_F(RgbMatrixRender, CycleLeftRight) {
+    render("cycle_left_right", RGB_MATRIX_CYCLE_LEFT_RIGHT);
+}
+
+TEST_F(RgbMatrixRender, CycleOutIn) {
+    render("cycle_out_in", RGB_MATRIX_CYCLE_OUT_IN);
+}
+
+TEST_F(RgbMatrixRender, CyclePinwheel) {
+    render("cycle_pinwheel", RGB_MATRIX_CYCLE_PINWHEEL);
+}
+
+TEST_F(RgbMatrixRender, CycleSpiral) {
+    render("cycle_spiral", RGB_MATRIX_CYCLE_SPIRAL);
+}
+
+TEST_F(RgbMatrixRender, BandPinwheelSat) {
+    render("band_pinwheel_sat", RGB_MATRIX_BAND_PINWHEEL_SAT);
+}
+
+TEST_F(RgbMatrixRender, BandSpiralVal) {
+    render("band_spiral_val", RGB_MATRIX_BAND_SPIRAL_VAL);
+}
+
+TEST_F(RgbMatrixRender, RainbowPinwheels) {
+    render("rainbow_pinwheels", RGB_MATRIX_RAINBOW_PINWHEELS);
+}
+
+TEST_F(RgbMatrixRender, SolidReactiveMultiwide) {
+    render("solid_reactive_multiwide", RGB_MATRIX_SOLID_REACTIVE_MULTIWIDE);
+}
+
+TEST_F(RgbMatrixRender, SolidReactiveMultinexus) {
+    render("solid_reactive_multinexus", RGB_MATRIX_SOLID_REACTIVE_MULTINEXUS);
+}
+
+TEST_F(RgbMatrixRender, Multisplash) {
+    render("multisplash", RGB_MATRIX_MULTISPLASH);
+}
+
+TEST_F(RgbMatrixRender, Timeline) {
+    render("timeline", RGB_MATRIX_TIMELINE);
+}
+
+TEST_F(RgbMatrixRender, TypingHeatmap) {
+    render("typing_heatmap", RGB_MATRIX_TYPING_HEATMAP);
+}
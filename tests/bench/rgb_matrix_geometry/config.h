@@ -0,0 +1,12 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "../rgb_matrix/config.h"
+
+#define RGB_MATRIX_GEOMETRY_TABLES
+#define RGB_MATRIX_GEOMETRY_PAIRWISE
+
+// Set as a keymap might, the tables were generated for {112, 32} and keep their own center
+#define RGB_MATRIX_CENTER {100, 40}
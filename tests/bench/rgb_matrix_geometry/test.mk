@@ -0,0 +1,11 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+RGB_MATRIX_ENABLE = yes
+RGB_MATRIX_DRIVER = custom
+ENABLE_RGB_MATRIX_TIMELINE = yes
+
+# Same board and effects as the rgb_matrix suite, rendered from the geometry tables
+SRC += \
+	tests/bench/rgb_matrix/led_config.c \
+	tests/bench/rgb_matrix/test_rgb_matrix.cpp
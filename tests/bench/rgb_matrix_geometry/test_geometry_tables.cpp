@@ -0,0 +1,81 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <random>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "lib/lib8tion/lib8tion.h"
+
+extern const led_point_t k_rgb_matrix_center;
+
+void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col);
+}
+
+/* The typing heatmap as it was before the neighbour lists, sweeping the whole matrix on every press. */
+static void heatmap_full_sweep(uint8_t frame[MATRIX_ROWS][MATRIX_COLS], uint8_t row, uint8_t col) {
+    uint8_t led = g_led_config.matrix_co[row][col];
+    if (led == NO_LED) {
+        return;
+    }
+    for (uint8_t i_row = 0; i_row < MATRIX_ROWS; i_row++) {
+        for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
+            uint8_t i_led = g_led_config.matrix_co[i_row][i_col];
+            if (i_led == NO_LED) {
+                continue;
+            }
+            if (i_row == row && i_col == col) {
+                frame[row][col] = qadd8(frame[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+                continue;
+            }
+            int16_t dx       = g_led_config.point[led].x - g_led_config.point[i_led].x;
+            int16_t dy       = g_led_config.point[led].y - g_led_config.point[i_led].y;
+            uint8_t distance = sqrt16(dx * dx + dy * dy);
+            if (distance <= RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
+                uint8_t amount      = MIN(qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance), RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT);
+                frame[i_row][i_col] = qadd8(frame[i_row][i_col], amount);
+            }
+        }
+    }
+}
+
+/* The generated tables have to match what the effects would compute at runtime. */
+TEST(RgbMatrixGeometry, CenterTablesMatchLayout) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        int16_t dx = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy = g_led_config.point[i].y - k_rgb_matrix_center.y;
+        EXPECT_EQ(g_rgb_matrix_center_dist[i], sqrt16(dx * dx + dy * dy)) << "led " << +i;
+        EXPECT_EQ(g_rgb_matrix_center_angle[i], atan2_8(dy, dx)) << "led " << +i;
+    }
+}
+
+TEST(RgbMatrixGeometry, PairwiseTableMatchesLayout) {
+    for (uint8_t a = 0; a < RGB_MATRIX_LED_COUNT; a++) {
+        for (uint8_t b = 0; b < RGB_MATRIX_LED_COUNT; b++) {
+            int16_t dx = g_led_config.point[a].x - g_led_config.point[b].x;
+            int16_t dy = g_led_config.point[a].y - g_led_config.point[b].y;
+            EXPECT_EQ(rgb_matrix_led_distance(a, b), sqrt16(dx * dx + dy * dy)) << "leds " << +a << ", " << +b;
+        }
+    }
+}
+
+TEST(RgbMatrixGeometry, HeatmapMatchesFullSweep) {
+    uint8_t expected[MATRIX_ROWS][MATRIX_COLS] = {};
+    memset(g_rgb_frame_buffer, 0, sizeof(g_rgb_frame_buffer));
+
+    std::mt19937 random(42);
+    for (int press = 0; press < 2000; press++) {
+        // Start over now and then, before everything saturates
+        if (press % 8 == 0) {
+            memset(expected, 0, sizeof(expected));
+            memset(g_rgb_frame_buffer, 0, sizeof(g_rgb_frame_buffer));
+        }
+        uint8_t row = random() % MATRIX_ROWS;
+        uint8_t col = random() % MATRIX_COLS;
+        heatmap_full_sweep(expected, row, col);
+        process_rgb_matrix_typing_heatmap(row, col);
+        ASSERT_EQ(memcmp(expected, g_rgb_frame_buffer, sizeof(expected)), 0) << "press " << press << " at " << +row << ", " << +col;
+    }
+}
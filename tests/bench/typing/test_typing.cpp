@@ -0,0 +1,44 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_bench.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "profiling.h"
+}
+
+class Typing : public BenchFixture {
+   protected:
+    void SetUp() override {
+        // clang-format off
+        const uint16_t codes[3][10] = {
+            {KC_Q, KC_W, KC_E, KC_R, KC_T, KC_Y, KC_U, KC_I, KC_O, KC_P},
+            {SFT_T(KC_A), CTL_T(KC_S), ALT_T(KC_D), GUI_T(KC_F), KC_G, KC_H, RGUI_T(KC_J), RALT_T(KC_K), RCTL_T(KC_L), RSFT_T(KC_SCLN)},
+            {KC_Z, KC_X, KC_C, KC_V, KC_B, KC_N, KC_M, KC_COMM, KC_DOT, KC_QUOT},
+        };
+        // clang-format on
+        set_keymap({KeymapKey(0, 0, 3, CW_TOGG), KeymapKey(0, 1, 3, KC_BSPC), KeymapKey(0, 2, 3, KC_SPC)});
+        for (uint8_t row = 0; row < 3; row++) {
+            for (uint8_t col = 0; col < 10; col++) {
+                add_key(KeymapKey(0, col, row, codes[row][col]));
+            }
+        }
+    }
+};
+
+TEST_F(Typing, ProseWithHomeRowMods) {
+    TestDriver driver;
+    auto       trace  = load_trace(__FILE__, "prose.trace");
+    auto       result = replay("prose", trace, driver);
+
+    EXPECT_EQ(result.typed, "the quick brown fox jumps over the lazy dog. we all want to receive QMK firmware, well-known and loved. "
+                            "typing fast with home row mods should never misfire, so all these rolls must come out as plain letters. done.");
+    EXPECT_EQ(result.events, 434u);
+    EXPECT_GT(result.processing["action_tapping_process"], 0u);
+    EXPECT_GT(result.processing["process_combo"], 0u);
+    EXPECT_GT(result.processing["process_key_override"], 0u);
+    EXPECT_GT(result.processing["process_autocorrect"], 0u);
+    EXPECT_GT(result.processing["process_caps_word"], 0u);
+}
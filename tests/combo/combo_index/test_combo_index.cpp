@@ -0,0 +1,137 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <iostream>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.h"
+#include "test_common.hpp"
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "keymap_introspection.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+class ComboIndex : public TestFixture {
+   protected:
+    /**
+     * @brief Taps `key` `taps` times and returns the average wall time per
+     * key event in nanoseconds.
+     */
+    double measure_ns_per_event(KeymapKey key, unsigned taps) {
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i < taps; i++) {
+            tap_key(key);
+        }
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / (taps * 2);
+    }
+
+    void report(const char* name, double ns_per_event) {
+        RecordProperty(name, std::to_string(static_cast<uint64_t>(ns_per_event)));
+        std::cout << "[ BENCH    ] " << name << ": " << static_cast<uint64_t>(ns_per_event) << " ns/event (" << combo_count() << " combos)" << std::endl;
+    }
+};
+
+TEST_F(ComboIndex, combo_modtest_tapped) {
+    TestDriver driver;
+    KeymapKey  key_y(0, 0, 1, KC_Y);
+    KeymapKey  key_u(0, 0, 2, KC_U);
+    set_keymap({key_y, key_u});
+
+    EXPECT_REPORT(driver, (KC_SPACE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_y, key_u});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, combo_modtest_held_longer_than_tapping_term) {
+    TestDriver driver;
+    KeymapKey  key_y(0, 0, 1, KC_Y);
+    KeymapKey  key_u(0, 0, 2, KC_U);
+    set_keymap({key_y, key_u});
+
+    EXPECT_REPORT(driver, (KC_RIGHT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_y, key_u}, TAPPING_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, combo_osmshift_tapped) {
+    TestDriver driver;
+    KeymapKey  key_z(0, 0, 1, KC_Z);
+    KeymapKey  key_x(0, 0, 2, KC_X);
+    KeymapKey  key_i(0, 0, 3, KC_I);
+    set_keymap({key_z, key_x, key_i});
+
+    EXPECT_NO_REPORT(driver);
+    tap_combo({key_z, key_x});
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_I, KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_i);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, combo_sharing_a_key_is_tapped) {
+    TestDriver driver;
+    KeymapKey  key_y(0, 0, 1, KC_Y);
+    KeymapKey  key_f13(0, 0, 2, KC_F13);
+    set_keymap({key_y, key_f13});
+
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_y, key_f13});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, last_combo_is_tapped) {
+    TestDriver driver;
+    KeymapKey  key_f24(0, 0, 1, KC_F24);
+    KeymapKey  key_kp_7(0, 0, 2, KC_KP_7);
+    KeymapKey  key_int3(0, 0, 3, KC_INTERNATIONAL_3);
+    set_keymap({key_f24, key_kp_7, key_int3});
+
+    EXPECT_REPORT(driver, (KC_0));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_f24, key_kp_7, key_int3});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, partial_combo_keys_are_sent_in_order) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_f24(0, 0, 1, KC_F24);
+    KeymapKey  key_kp_7(0, 0, 2, KC_KP_7);
+    set_keymap({key_f24, key_kp_7});
+
+    EXPECT_REPORT(driver, (KC_F24));
+    EXPECT_REPORT(driver, (KC_F24, KC_KP_7));
+    EXPECT_REPORT(driver, (KC_KP_7));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_f24, key_kp_7});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, benchmark_event_cost) {
+    TestDriver driver;
+    KeymapKey  key_i(0, 0, 1, KC_I);
+    KeymapKey  key_y(0, 0, 2, KC_Y);
+    KeymapKey  key_f13(0, 0, 3, KC_F13);
+    set_keymap({key_i, key_y, key_f13});
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    report("non_combo_key", measure_ns_per_event(key_i, 2000));
+    report("shared_combo_key", measure_ns_per_event(key_y, 2000));
+    report("filler_combo_key", measure_ns_per_event(key_f13, 2000));
+    VERIFY_AND_CLEAR(driver);
+}
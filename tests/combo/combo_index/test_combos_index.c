@@ -0,0 +1,30 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+#define FILLER_COMBOS 300
+
+enum combos { modtest, osmshift, yshare, FILLER_START };
+
+uint16_t const modtest_combo[]  = {KC_Y, KC_U, COMBO_END};
+uint16_t const osmshift_combo[] = {KC_Z, KC_X, COMBO_END};
+uint16_t const yshare_combo[]   = {KC_Y, KC_F13, COMBO_END};
+
+// Distinct three key combos which don't overlap with the keys used by the tests
+#define FILLER_KEYS(n) {KC_F13 + ((n) % 12), KC_KP_1 + ((n) / 12 % 9), KC_INTERNATIONAL_1 + ((n) / 108), COMBO_END},
+#define FILLER_COMBO(n) [FILLER_START + (n)] = COMBO(filler_combos[n], KC_1 + ((n) % 10)),
+
+#define REPEAT10(m, n) m(n) m(n + 1) m(n + 2) m(n + 3) m(n + 4) m(n + 5) m(n + 6) m(n + 7) m(n + 8) m(n + 9)
+#define REPEAT100(m, n) REPEAT10(m, n) REPEAT10(m, n + 10) REPEAT10(m, n + 20) REPEAT10(m, n + 30) REPEAT10(m, n + 40) REPEAT10(m, n + 50) REPEAT10(m, n + 60) REPEAT10(m, n + 70) REPEAT10(m, n + 80) REPEAT10(m, n + 90)
+#define REPEAT300(m) REPEAT100(m, 0) REPEAT100(m, 100) REPEAT100(m, 200)
+
+uint16_t const filler_combos[FILLER_COMBOS][4] = {REPEAT300(FILLER_KEYS)};
+
+// clang-format off
+combo_t key_combos[] = {
+    [modtest]  = COMBO(modtest_combo, RSFT_T(KC_SPACE)),
+    [osmshift] = COMBO(osmshift_combo, OSM(MOD_LSFT)),
+    [yshare]   = COMBO(yshare_combo, KC_ESC),
+    REPEAT300(FILLER_COMBO)
+};
+// clang-format on
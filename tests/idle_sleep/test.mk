@@ -0,0 +1,8 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+IDLE_SLEEP_ENABLE = yes
+COMBO_ENABLE = yes
+DEFERRED_EXEC_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = test_combos.c
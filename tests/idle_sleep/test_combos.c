@@ -0,0 +1,8 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+uint16_t const zx_combo[] = {KC_Z, KC_X, COMBO_END};
+
+combo_t key_combos[] = {COMBO(zx_combo, KC_ESC)};
@@ -0,0 +1,174 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "deferred_exec.h"
+#include "idle_sleep.h"
+
+static bool     user_deadline_set = false;
+static uint32_t user_deadline     = 0;
+
+bool idle_sleep_next_deadline_user(uint32_t *deadline) {
+    *deadline = user_deadline;
+    return user_deadline_set;
+}
+
+static uint32_t noop_callback(uint32_t trigger_time, void *cb_arg) {
+    return 0;
+}
+}
+
+using testing::_;
+
+class IdleSleep : public TestFixture {
+   protected:
+    KeymapKey mod_tap = KeymapKey(0, 0, 0, LSFT_T(KC_A));
+    KeymapKey key_z   = KeymapKey(0, 1, 0, KC_Z);
+    KeymapKey key_x   = KeymapKey(0, 2, 0, KC_X);
+
+    void SetUp() override {
+        TestDriver driver;
+        user_deadline_set = false;
+        set_keymap({mod_tap, key_z, key_x});
+        // Combos treat a timer value of 0 as not running.
+        EXPECT_NO_REPORT(driver);
+        idle_for(10);
+        VERIFY_AND_CLEAR(driver);
+    }
+
+    uint32_t next_deadline() {
+        uint32_t deadline = 0;
+        EXPECT_TRUE(idle_sleep_next_deadline(&deadline));
+        return deadline;
+    }
+};
+
+TEST_F(IdleSleep, NoDeadlineWhenNothingIsPending) {
+    uint32_t deadline;
+    EXPECT_FALSE(idle_sleep_next_deadline(&deadline));
+    EXPECT_EQ(idle_sleep_duration(), IDLE_SLEEP_MAX_MS);
+}
+
+TEST_F(IdleSleep, TappingTermOfUndecidedKey) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    uint32_t pressed_at = timer_read32();
+    mod_tap.press();
+    run_one_scan_loop();
+    EXPECT_EQ(next_deadline(), pressed_at + TAPPING_TERM);
+    EXPECT_EQ(idle_sleep_duration(), TAPPING_TERM - 1);
+    VERIFY_AND_CLEAR(driver);
+
+    // Sleeping until the deadline lets the next pass settle the key as held.
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    idle_sleep_task();
+    EXPECT_EQ(timer_read32(), pressed_at + TAPPING_TERM);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    uint32_t deadline;
+    EXPECT_FALSE(idle_sleep_next_deadline(&deadline));
+
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(IdleSleep, TappingTermAfterTap) {
+    TestDriver driver;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(mod_tap);
+    uint32_t released_at = timer_read32() - 1;
+    VERIFY_AND_CLEAR(driver);
+
+    // A released tap still waits for a quick re-tap until the tapping term ends.
+    EXPECT_EQ(next_deadline(), released_at + TAPPING_TERM);
+
+    idle_sleep_task();
+    run_one_scan_loop();
+    uint32_t deadline;
+    EXPECT_FALSE(idle_sleep_next_deadline(&deadline));
+}
+
+TEST_F(IdleSleep, ComboTermOfBufferedKey) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    uint32_t pressed_at = timer_read32();
+    key_z.press();
+    run_one_scan_loop();
+    EXPECT_EQ(next_deadline(), pressed_at + COMBO_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_Z));
+    idle_sleep_task();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_z.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(IdleSleep, DeferredExecution) {
+    deferred_token token = defer_exec(300, noop_callback, NULL);
+    ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+
+    EXPECT_EQ(next_deadline(), timer_read32() + 300);
+    EXPECT_EQ(idle_sleep_duration(), 300);
+
+    cancel_deferred_exec(token);
+}
+
+TEST_F(IdleSleep, EarliestDeadlineWins) {
+    TestDriver     driver;
+    deferred_token token = defer_exec(30, noop_callback, NULL);
+
+    EXPECT_NO_REPORT(driver);
+    mod_tap.press();
+    run_one_scan_loop();
+    EXPECT_EQ(idle_sleep_duration(), 29);
+    VERIFY_AND_CLEAR(driver);
+
+    cancel_deferred_exec(token);
+    EXPECT_EQ(idle_sleep_duration(), TAPPING_TERM - 1);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_sleep_task();
+    run_one_scan_loop();
+    mod_tap.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(IdleSleep, PassedDeadlineDoesNotSleep) {
+    user_deadline_set = true;
+    user_deadline     = timer_read32() - 5;
+
+    EXPECT_EQ(next_deadline(), user_deadline);
+    EXPECT_EQ(idle_sleep_duration(), 0);
+
+    uint32_t now = timer_read32();
+    idle_sleep_task();
+    EXPECT_EQ(timer_read32(), now);
+}
+
+TEST_F(IdleSleep, DurationIsCapped) {
+    user_deadline_set = true;
+    user_deadline     = timer_read32() + IDLE_SLEEP_MAX_MS * 5;
+
+    EXPECT_EQ(next_deadline(), user_deadline);
+    EXPECT_EQ(idle_sleep_duration(), IDLE_SLEEP_MAX_MS);
+}
@@ -0,0 +1,12 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// Mimic a large board to make the cost of a matrix scan measurable
+#undef MATRIX_ROWS
+#define MATRIX_ROWS 16
+#undef MATRIX_COLS
+#define MATRIX_COLS 24
@@ -0,0 +1,103 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <iostream>
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+class MatrixScan : public TestFixture {
+   protected:
+    static constexpr unsigned benchmark_scans = 20000;
+
+    /**
+     * @brief Runs `scans` keyboard task loops, calling `between_scans` before
+     * each one, and returns the achieved scan rate.
+     */
+    template <typename F>
+    double measure_scans_per_second(unsigned scans, F between_scans) {
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i < scans; i++) {
+            between_scans(i);
+            run_one_scan_loop();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return scans / elapsed.count();
+    }
+
+    void report(const char* name, double scans_per_second) {
+        RecordProperty(name, std::to_string(static_cast<uint64_t>(scans_per_second)));
+        std::cout << "[ BENCH    ] " << name << ": " << static_cast<uint64_t>(scans_per_second) << " scans/s (" << MATRIX_ROWS << "x" << MATRIX_COLS << " matrix)" << std::endl;
+    }
+};
+
+TEST_F(MatrixScan, KeysInHighRowsAndColumnsAreReported) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_low  = KeymapKey(0, 0, 0, KC_A);
+    auto       key_mid  = KeymapKey(0, 17, 9, KC_B);
+    auto       key_high = KeymapKey(0, MATRIX_COLS - 1, MATRIX_ROWS - 1, KC_C);
+
+    set_keymap({key_low, key_mid, key_high});
+
+    /* Press all keys in the same scan, events are generated in matrix order. */
+    key_high.press();
+    key_mid.press();
+    key_low.press();
+    EXPECT_REPORT(driver, (key_low.report_code));
+    EXPECT_REPORT(driver, (key_low.report_code, key_mid.report_code));
+    EXPECT_REPORT(driver, (key_low.report_code, key_mid.report_code, key_high.report_code));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release all keys in the same scan. */
+    key_low.release();
+    key_mid.release();
+    key_high.release();
+    EXPECT_REPORT(driver, (key_mid.report_code, key_high.report_code));
+    EXPECT_REPORT(driver, (key_high.report_code));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixScan, BenchmarkIdleMatrix) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    report("idle", measure_scans_per_second(benchmark_scans, [](unsigned) {}));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixScan, BenchmarkBusyMatrix) {
+    TestDriver             driver;
+    std::vector<KeymapKey> keys;
+
+    /* One key per row, spread across the columns, rolled over continuously. */
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        keys.emplace_back(0, (row * 5) % MATRIX_COLS, row, KC_A + row);
+    }
+    for (auto& key : keys) {
+        add_key(key);
+    }
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    report("busy", measure_scans_per_second(benchmark_scans, [&](unsigned i) {
+               keys[i % keys.size()].press();
+               if (i >= 2) {
+                   keys[(i - 2) % keys.size()].release();
+               }
+           }));
+    for (auto& key : keys) {
+        if (matrix_is_on(key.position.row, key.position.col)) {
+            key.release();
+        }
+    }
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,8 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define PROFILE_USER_PROBES(X) X(TEST_SLEEP, "test_sleep")
@@ -0,0 +1,7 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+PROFILING_ENABLE = yes
+
+# Needed for profile_dump() output
+CONSOLE_ENABLE = yes
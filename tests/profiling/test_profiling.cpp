@@ -0,0 +1,128 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "profiling.h"
+}
+
+using testing::_;
+
+class Profiling : public TestFixture {
+   protected:
+    Profiling() {
+        profile_reset();
+    }
+
+    static uint32_t histogram_total(const profile_stats_t* stats) {
+        uint32_t total = 0;
+        for (uint8_t b = 0; b < PROFILE_HISTOGRAM_BUCKETS; b++) {
+            total += stats->histogram[b];
+        }
+        return total;
+    }
+};
+
+TEST_F(Profiling, ProbeNamesMatchTable) {
+    EXPECT_STREQ(profile_get_name(PROFILE_PROBE_MATRIX_TASK), "matrix_task");
+    EXPECT_STREQ(profile_get_name(PROFILE_PROBE_HOUSEKEEPING_TASK), "housekeeping_task");
+    EXPECT_STREQ(profile_get_name(PROFILE_PROBE_TEST_SLEEP), "test_sleep");
+    EXPECT_EQ(profile_get_name(PROFILE_PROBE_COUNT), nullptr);
+    EXPECT_EQ(profile_get_stats(PROFILE_PROBE_COUNT), nullptr);
+}
+
+TEST_F(Profiling, KeyboardTaskIsInstrumented) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    key.press();
+    idle_for(10);
+    key.release();
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    for (uint8_t probe : {PROFILE_PROBE_MATRIX_TASK, PROFILE_PROBE_QUANTUM_TASK, PROFILE_PROBE_HOUSEKEEPING_TASK}) {
+        const profile_stats_t* stats = profile_get_stats(probe);
+        EXPECT_EQ(stats->count, 20u) << profile_get_name(probe);
+        EXPECT_LE(stats->min, stats->max) << profile_get_name(probe);
+        EXPECT_EQ(histogram_total(stats), stats->count) << profile_get_name(probe);
+    }
+    EXPECT_EQ(profile_get_stats(PROFILE_PROBE_RGB_MATRIX_TASK)->count, 0u);
+    EXPECT_EQ(profile_get_stats(PROFILE_PROBE_POINTING_DEVICE_TASK)->count, 0u);
+
+    profile_reset();
+    EXPECT_EQ(profile_get_stats(PROFILE_PROBE_MATRIX_TASK)->count, 0u);
+}
+
+TEST_F(Profiling, UserProbeMeasuresHostTime) {
+    for (int i = 0; i < 3; i++) {
+        PROFILE_PROBE(TEST_SLEEP, std::this_thread::sleep_for(std::chrono::microseconds(2000)));
+    }
+
+    const profile_stats_t* stats = profile_get_stats(PROFILE_PROBE_TEST_SLEEP);
+    EXPECT_EQ(stats->count, 3u);
+    EXPECT_GE(profile_ticks_to_us(stats->min), 2000u);
+    EXPECT_GE(stats->max, stats->min);
+    EXPECT_EQ(histogram_total(stats), 3u);
+    // 2ms is past the 16 << 6 us lower bound of the last bucket.
+    EXPECT_EQ(stats->histogram[PROFILE_HISTOGRAM_BUCKETS - 1], 3u);
+}
+
+TEST_F(Profiling, HistogramBucketsDoubleFromBase) {
+    // The host clock counts nanoseconds.
+    const uint32_t base = 1000;
+    ASSERT_EQ(profile_ticks_to_us(base), 1u);
+
+    profile_record(PROFILE_PROBE_TEST_SLEEP, (PROFILE_HISTOGRAM_BASE_US - 1) * base);
+    profile_record(PROFILE_PROBE_TEST_SLEEP, PROFILE_HISTOGRAM_BASE_US * base);
+    profile_record(PROFILE_PROBE_TEST_SLEEP, (PROFILE_HISTOGRAM_BASE_US * 3) * base);
+    profile_record(PROFILE_PROBE_TEST_SLEEP, UINT32_MAX);
+
+    const profile_stats_t* stats = profile_get_stats(PROFILE_PROBE_TEST_SLEEP);
+    EXPECT_EQ(stats->histogram[0], 1u);
+    EXPECT_EQ(stats->histogram[1], 1u);
+    EXPECT_EQ(stats->histogram[2], 1u);
+    EXPECT_EQ(stats->histogram[PROFILE_HISTOGRAM_BUCKETS - 1], 1u);
+    EXPECT_EQ(stats->min, (PROFILE_HISTOGRAM_BASE_US - 1) * base);
+    EXPECT_EQ(stats->max, UINT32_MAX);
+}
+
+TEST_F(Profiling, RawHidReportsProbe) {
+    profile_record(PROFILE_PROBE_QUANTUM_TASK, 5000);
+    profile_record(PROFILE_PROBE_QUANTUM_TASK, 20000);
+
+    uint8_t data[32] = {PROFILE_RAW_HID_COMMAND, PROFILE_PROBE_QUANTUM_TASK};
+    ASSERT_TRUE(profile_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[0], PROFILE_RAW_HID_COMMAND);
+    EXPECT_EQ(data[1], PROFILE_PROBE_QUANTUM_TASK);
+    EXPECT_EQ(data[2], PROFILE_PROBE_COUNT);
+    EXPECT_EQ(data[3], PROFILE_HISTOGRAM_BUCKETS);
+    auto u32 = [&](uint8_t offset) { return data[offset] | data[offset + 1] << 8 | data[offset + 2] << 16 | (uint32_t)data[offset + 3] << 24; };
+    EXPECT_EQ(u32(4), 2u);   // count
+    EXPECT_EQ(u32(8), 5u);   // min
+    EXPECT_EQ(u32(12), 20u); // max
+    EXPECT_EQ(u32(16), 12u); // mean
+    EXPECT_EQ(data[20], 1u); // < 16us
+    EXPECT_EQ(data[22], 1u); // < 32us
+
+    uint8_t other[32] = {0x01, PROFILE_PROBE_QUANTUM_TASK};
+    EXPECT_FALSE(profile_raw_hid_receive(other, sizeof(other)));
+}
+
+TEST_F(Profiling, DumpPrintsRecordedProbes) {
+    profile_record(PROFILE_PROBE_MATRIX_TASK, 1000);
+    testing::internal::CaptureStdout();
+    profile_dump();
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(output.find("matrix_task: n=1 min=1us mean=1us max=1us hist=1,0"), std::string::npos) << output;
+    EXPECT_EQ(output.find("quantum_task"), std::string::npos) << output;
+}
@@ -0,0 +1,16 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix.h"
+
+// Four LEDs under the first keys of the top row, the last one a modifier.
+led_config_t g_led_config = {
+    {
+        {0, 1, 2, 3, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED},
+        {NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED},
+        {NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED},
+        {NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED},
+    },
+    {{0, 0}, {75, 0}, {150, 0}, {224, 0}},
+    {4, 4, 4, 1},
+};
@@ -0,0 +1,9 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+RGB_MATRIX_ENABLE = yes
+RGB_MATRIX_DRIVER = custom
+RGB_MATRIX_OUTPUT_LUT = yes
+CIE1931_CURVE = yes
+
+SRC += led_config.c
@@ -0,0 +1,68 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <set>
+#include <tuple>
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "rgb_matrix_output.h"
+
+static rgb_t                                         colors[RGB_MATRIX_LED_COUNT];
+static std::set<std::tuple<uint8_t, uint8_t, uint8_t>> expected;
+
+static void recording_init(void) {}
+
+static void recording_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    colors[index] = {.r = r, .g = g, .b = b};
+}
+
+static void recording_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        recording_set_color(i, r, g, b);
+    }
+}
+
+static void recording_flush(void) {}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = recording_init,
+    .set_color     = recording_set_color,
+    .set_color_all = recording_set_color_all,
+    .flush         = recording_flush,
+};
+
+// A brightness limit, the way keyboards write one
+rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
+    hsv.v /= 2;
+
+    // What should reach the driver: the output tables apply the lightness curve, once
+    rgb_t rgb = hsv_to_rgb_nocie(hsv);
+    rgb       = rgb_matrix_output_lookup(rgb.r, rgb.g, rgb.b);
+    expected.insert({rgb.r, rgb.g, rgb.b});
+
+    return hsv_to_rgb(hsv);
+}
+}
+
+class HsvOverride : public TestFixture {
+   protected:
+    void SetUp() override {
+        expected.clear();
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_CYCLE_ALL);
+        rgb_matrix_sethsv_noeeprom(0, 255, 255);
+    }
+};
+
+TEST_F(HsvOverride, BatchedEffectsUseTheOverride) {
+    TestDriver driver;
+    idle_for(100);
+
+    ASSERT_FALSE(expected.empty());
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        EXPECT_TRUE(expected.count({colors[i].r, colors[i].g, colors[i].b})) << "led " << (int)i << " " << (int)colors[i].r << " " << (int)colors[i].g << " " << (int)colors[i].b;
+    }
+}
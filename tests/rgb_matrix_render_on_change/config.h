@@ -0,0 +1,14 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define RGB_MATRIX_LED_COUNT 4
+#define RGB_MATRIX_RENDER_ON_CHANGE
+#define RGB_MATRIX_TIMEOUT 10000
+#define RGB_MATRIX_SLEEP
+
+#define ENABLE_RGB_MATRIX_ALPHAS_MODS
+#define ENABLE_RGB_MATRIX_CYCLE_ALL
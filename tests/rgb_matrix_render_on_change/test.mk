@@ -0,0 +1,7 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+RGB_MATRIX_ENABLE = yes
+RGB_MATRIX_DRIVER = custom
+
+SRC += led_config.c
@@ -0,0 +1,214 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "action_layer.h"
+#include "led.h"
+#include "rgb_matrix.h"
+
+static uint32_t flushes      = 0;
+static bool     driver_ready = true;
+
+static void counting_init(void) {}
+
+static void counting_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {}
+
+static void counting_set_color_all(uint8_t r, uint8_t g, uint8_t b) {}
+
+static void counting_flush(void) {
+    flushes++;
+}
+
+static bool counting_ready(void) {
+    return driver_ready;
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = counting_init,
+    .set_color     = counting_set_color,
+    .set_color_all = counting_set_color_all,
+    .flush         = counting_flush,
+    .ready         = counting_ready,
+};
+}
+
+using testing::_;
+
+class RenderOnChange : public TestFixture {
+   protected:
+    KeymapKey key_a     = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey key_shift = KeymapKey(0, 1, 0, KC_LEFT_SHIFT);
+
+    void SetUp() override {
+        driver_ready = true;
+        set_keymap({key_a, key_shift});
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+        rgb_matrix_sethsv_noeeprom(0, 255, 255);
+    }
+
+    // Lets the current frame finish, with key activity so the timeout does not blank it.
+    void settle(TestDriver& driver) {
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+        tap_key(key_a);
+        idle_for(100);
+        VERIFY_AND_CLEAR(driver);
+        flushes = 0;
+    }
+};
+
+TEST_F(RenderOnChange, StaticEffectIsRenderedOnce) {
+    TestDriver driver;
+    settle(driver);
+
+    idle_for(1000);
+    EXPECT_EQ(flushes, 0);
+
+    // Key presses are not an input of solid color.
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    idle_for(100);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(flushes, 0);
+}
+
+TEST_F(RenderOnChange, ConfigChangeRendersAgain) {
+    TestDriver driver;
+    settle(driver);
+
+    rgb_matrix_sethsv_noeeprom(85, 255, 255);
+    idle_for(100);
+    EXPECT_EQ(flushes, 1);
+
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_ALPHAS_MODS);
+    idle_for(100);
+    EXPECT_EQ(flushes, 2);
+}
+
+TEST_F(RenderOnChange, LayerChangeRendersAgain) {
+    TestDriver driver;
+    settle(driver);
+
+    layer_on(1);
+    idle_for(100);
+    EXPECT_EQ(flushes, 1);
+
+    layer_off(1);
+    idle_for(100);
+    EXPECT_EQ(flushes, 2);
+}
+
+TEST_F(RenderOnChange, HostLedChangeRendersAgain) {
+    TestDriver driver;
+    settle(driver);
+
+    driver.set_leds(((led_t){.caps_lock = true}).raw);
+    idle_for(100);
+    EXPECT_EQ(flushes, 1);
+
+    driver.set_leds(0);
+    idle_for(100);
+    EXPECT_EQ(flushes, 2);
+}
+
+TEST_F(RenderOnChange, ModifierChangeRendersAgain) {
+    TestDriver driver;
+    settle(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    key_shift.press();
+    idle_for(100);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(flushes, 1);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    idle_for(100);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(flushes, 2);
+}
+
+TEST_F(RenderOnChange, InvalidateRendersAgain) {
+    TestDriver driver;
+    settle(driver);
+
+    rgb_matrix_invalidate();
+    idle_for(100);
+    EXPECT_EQ(flushes, 1);
+}
+
+TEST_F(RenderOnChange, TimedEffectKeepsRendering) {
+    TestDriver driver;
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_CYCLE_ALL);
+    settle(driver);
+
+    uint32_t deadline;
+    idle_for(1000);
+    EXPECT_GT(flushes, 1000 / RGB_MATRIX_LED_FLUSH_LIMIT / 2);
+    EXPECT_TRUE(rgb_matrix_next_deadline(&deadline));
+}
+
+TEST_F(RenderOnChange, ParkedEffectWaitsForTimeout) {
+    TestDriver driver;
+    settle(driver);
+
+    uint32_t deadline;
+    ASSERT_TRUE(rgb_matrix_next_deadline(&deadline));
+    EXPECT_EQ(deadline, timer_read32() + RGB_MATRIX_TIMEOUT - last_input_activity_elapsed() + 1);
+
+    // Blanking the LEDs at the timeout is a change of its own.
+    idle_for(RGB_MATRIX_TIMEOUT);
+    EXPECT_EQ(flushes, 1);
+    EXPECT_FALSE(rgb_matrix_next_deadline(&deadline));
+    idle_for(1000);
+    EXPECT_EQ(flushes, 1);
+}
+
+TEST_F(RenderOnChange, SuspendRendersAgainOnResume) {
+    TestDriver driver;
+    settle(driver);
+
+    rgb_matrix_set_suspend_state(true);
+    idle_for(100);
+    uint32_t suspended = flushes;
+    EXPECT_GE(suspended, 1);
+    idle_for(1000);
+    EXPECT_EQ(flushes, suspended);
+
+    rgb_matrix_set_suspend_state(false);
+    idle_for(100);
+    EXPECT_EQ(flushes, suspended + 1);
+}
+
+TEST_F(RenderOnChange, FlushWaitsForTheDriver) {
+    TestDriver driver;
+    settle(driver);
+
+    driver_ready = false;
+    rgb_matrix_sethsv_noeeprom(85, 255, 255);
+    idle_for(100);
+    EXPECT_EQ(flushes, 0);
+
+    driver_ready = true;
+    idle_for(100);
+    EXPECT_EQ(flushes, 1);
+}
+
+TEST_F(RenderOnChange, SuspendBlanksWhileTheDriverIsBusy) {
+    TestDriver driver;
+    settle(driver);
+
+    driver_ready = false;
+    rgb_matrix_set_suspend_state(true);
+    EXPECT_EQ(flushes, 1);
+
+    driver_ready = true;
+    rgb_matrix_set_suspend_state(false);
+}
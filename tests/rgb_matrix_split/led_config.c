@@ -0,0 +1,16 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix.h"
+
+// Four LEDs on the first row of each half, the left half on row 0 and the right one on row 2.
+led_config_t g_led_config = {
+    {
+        {0, 1, 2, 3, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED},
+        {NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED},
+        {4, 5, 6, 7, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED},
+        {NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED},
+    },
+    {{0, 16}, {30, 32}, {60, 48}, {90, 32}, {134, 32}, {164, 48}, {194, 32}, {224, 16}},
+    {4, 4, 4, 4, 4, 4, 4, 4},
+};
@@ -0,0 +1,155 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <functional>
+#include <vector>
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+}
+
+/* This suite renders a few effects on a keyboard of 8 LEDs while playing key
+ * presses on both sides, and the split_halves suite renders them again as the
+ * two halves of a split keyboard with the same LEDs. Both compare the frames
+ * to the hashes below, taken from this suite, so a split keyboard has to draw
+ * exactly what the same keyboard draws when it is not split. */
+
+struct expected_frames_t {
+    uint8_t  mode;
+    size_t   count;
+    uint32_t hash;
+};
+
+static const expected_frames_t expected_frames[] = {
+    {RGB_MATRIX_CYCLE_LEFT_RIGHT, 25, 1093181529u},
+    {RGB_MATRIX_SOLID_REACTIVE_SIMPLE, 25, 779025449u},
+    {RGB_MATRIX_MULTISPLASH, 25, 4164009953u},
+    {RGB_MATRIX_TYPING_HEATMAP, 25, 3628126897u},
+};
+
+typedef std::array<rgb_t, RGB_MATRIX_LED_COUNT> frame_t;
+
+// The LEDs this side has drawn since the last flush, and the frames it flushed
+static frame_t              drawing;
+static std::vector<frame_t> flushed;
+static uint8_t              first_led = 0;
+static uint8_t              led_count = RGB_MATRIX_LED_COUNT;
+static unsigned             overruns  = 0;
+
+extern "C" {
+static void recording_init(void) {}
+
+static void recording_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    if (index < 0 || index >= led_count) {
+        overruns++;
+        return;
+    }
+    drawing[first_led + index] = {r, g, b};
+}
+
+static void recording_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (uint8_t i = 0; i < led_count; i++) {
+        recording_set_color(i, r, g, b);
+    }
+}
+
+static void recording_flush(void) {
+    flushed.push_back(drawing);
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = recording_init,
+    .set_color     = recording_set_color,
+    .set_color_all = recording_set_color_all,
+    .flush         = recording_flush,
+};
+}
+
+// FNV-1a over the first `count` frames
+static uint32_t hash_frames(const std::vector<frame_t>& frames, size_t count) {
+    uint32_t hash = 2166136261u;
+    for (size_t f = 0; f < count && f < frames.size(); f++) {
+        for (const rgb_t& led : frames[f]) {
+            for (uint8_t channel : {led.r, led.g, led.b}) {
+                hash = (hash ^ channel) * 16777619u;
+            }
+        }
+    }
+    return hash;
+}
+
+class RgbMatrixSplit : public TestFixture {
+   protected:
+    KeymapKey left_key  = KeymapKey(0, 1, 0, KC_NO);
+    KeymapKey right_key = KeymapKey(0, 2, 2, KC_NO);
+
+    void SetUp() override {
+        set_keymap({left_key, right_key});
+    }
+
+    const expected_frames_t& expected(uint8_t mode) {
+        for (const expected_frames_t& frames : expected_frames) {
+            if (frames.mode == mode) {
+                return frames;
+            }
+        }
+        ADD_FAILURE() << "no frames for mode " << +mode;
+        return expected_frames[0];
+    }
+
+    // Presses or releases a key, with `link` standing in for the split transport
+    void change(KeymapKey& key, bool pressed, const std::function<void(KeymapKey&, bool)>& link) {
+        if (pressed) {
+            key.press();
+        } else {
+            key.release();
+        }
+        link(key, pressed);
+        run_one_scan_loop();
+    }
+
+    // Starts rendering `mode` from a clean start, with nothing flushed yet
+    void start(uint8_t mode) {
+        // Warm up, the effects keep timers of their own
+        rgb_matrix_init();
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_mode_noeeprom(mode);
+        timer_clear();
+        idle_for(100);
+        rgb_matrix_disable_noeeprom();
+        idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 2);
+
+        timer_clear();
+        drawing = {};
+        flushed.clear();
+        overruns = 0;
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_mode_noeeprom(mode);
+    }
+
+    // Renders `mode` from a clean start, taps a key on each side and returns the frames flushed by this side
+    std::vector<frame_t> play(uint8_t mode, const std::function<void(KeymapKey&, bool)>& link) {
+        TestDriver driver;
+
+        start(mode);
+        idle_for(50);
+        change(left_key, true, link);
+        idle_for(60);
+        change(left_key, false, link);
+        idle_for(40);
+        change(right_key, true, link);
+        idle_for(60);
+        change(right_key, false, link);
+        idle_for(200);
+
+        EXPECT_EQ(overruns, 0u);
+        return flushed;
+    }
+};
@@ -0,0 +1,8 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "../config.h"
+
+#define RGB_MATRIX_SPLIT {4, 4}
@@ -0,0 +1,130 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "../rgb_matrix_split.hpp"
+
+static bool left_half = true;
+
+extern "C" {
+bool is_keyboard_left(void) {
+    return left_half;
+}
+
+bool is_keyboard_master(void) {
+    return left_half;
+}
+}
+
+/* Renders each half on its own, the left one as the master, and puts the
+ * frames back together. The slave only learns about key presses from the hits
+ * the master queues for it, including those of its own keys. */
+class RgbMatrixSplitHalves : public RgbMatrixSplit {
+   protected:
+    void TearDown() override {
+        left_half = true;
+        first_led = 0;
+        led_count = RGB_MATRIX_LED_COUNT;
+    }
+
+    void slave_half(void) {
+        const uint8_t split[2] = RGB_MATRIX_SPLIT;
+
+        left_half = false;
+        first_led = split[0];
+        led_count = split[1];
+    }
+
+    void render(uint8_t mode) {
+        const uint8_t split[2] = RGB_MATRIX_SPLIT;
+
+        left_half = true;
+        first_led = 0;
+        led_count = split[0];
+        std::vector<frame_t> left = play(mode, [](KeymapKey&, bool) {});
+
+        // The master queued the press and release of both keys
+        rgb_matrix_hits_t link;
+        rgb_matrix_get_split_hits(&link);
+        for (uint8_t i = 0; i < 4; i++) {
+            const rgb_matrix_hit_t& hit = link.hit[(uint8_t)(link.count - 4 + i) % RGB_MATRIX_SPLIT_HITS];
+            EXPECT_EQ(hit.row, i < 2 ? left_key.position.row : right_key.position.row);
+            EXPECT_EQ(hit.col, i < 2 ? left_key.position.col : right_key.position.col);
+            EXPECT_EQ(hit.pressed, i % 2 == 0);
+        }
+
+        // Delivers the same key events to the slave, as the transport would, after a first sync
+        slave_half();
+        rgb_matrix_set_split_hits(&link);
+        std::vector<frame_t> right = play(mode, [&link](KeymapKey& key, bool pressed) {
+            link.hit[link.count % RGB_MATRIX_SPLIT_HITS] = {.row = key.position.row, .col = key.position.col, .pressed = pressed};
+            link.count++;
+            rgb_matrix_set_split_hits(&link);
+        });
+
+        const expected_frames_t& frame = expected(mode);
+        ASSERT_GE(left.size(), frame.count);
+        ASSERT_GE(right.size(), frame.count);
+        std::vector<frame_t> frames(frame.count);
+        for (size_t f = 0; f < frame.count; f++) {
+            std::copy(left[f].begin(), left[f].begin() + split[0], frames[f].begin());
+            std::copy(right[f].begin() + split[0], right[f].end(), frames[f].begin() + split[0]);
+        }
+        EXPECT_EQ(hash_frames(frames, frame.count), frame.hash);
+    }
+};
+
+TEST_F(RgbMatrixSplitHalves, CycleLeftRight) {
+    render(RGB_MATRIX_CYCLE_LEFT_RIGHT);
+}
+
+TEST_F(RgbMatrixSplitHalves, SolidReactiveSimple) {
+    render(RGB_MATRIX_SOLID_REACTIVE_SIMPLE);
+}
+
+TEST_F(RgbMatrixSplitHalves, Multisplash) {
+    render(RGB_MATRIX_MULTISPLASH);
+}
+
+TEST_F(RgbMatrixSplitHalves, TypingHeatmap) {
+    render(RGB_MATRIX_TYPING_HEATMAP);
+}
+
+TEST_F(RgbMatrixSplitHalves, StaleHitsAreNotReplayed) {
+    TestDriver driver;
+
+    // What the master queued before the slave was reset
+    rgb_matrix_hits_t link = {.count = 3};
+    for (uint8_t i = 0; i < link.count; i++) {
+        link.hit[i] = {.row = right_key.position.row, .col = right_key.position.col, .pressed = i % 2 == 0};
+    }
+
+    slave_half();
+    start(RGB_MATRIX_MULTISPLASH);
+    idle_for(100);
+    uint32_t idle = hash_frames(flushed, flushed.size());
+
+    // The first key events after the reset are only counted
+    start(RGB_MATRIX_MULTISPLASH);
+    idle_for(50);
+    rgb_matrix_resync_split_hits();
+    rgb_matrix_set_split_hits(&link);
+    idle_for(50);
+    EXPECT_EQ(hash_frames(flushed, flushed.size()), idle);
+
+    // Those that follow light up the slave
+    start(RGB_MATRIX_MULTISPLASH);
+    idle_for(50);
+    link.hit[link.count % RGB_MATRIX_SPLIT_HITS] = {.row = right_key.position.row, .col = right_key.position.col, .pressed = true};
+    link.count++;
+    rgb_matrix_set_split_hits(&link);
+    idle_for(50);
+    EXPECT_NE(hash_frames(flushed, flushed.size()), idle);
+}
+
+TEST_F(RgbMatrixSplitHalves, SetColorAllOnlySetsThisHalf) {
+    left_half = false;
+    first_led = 4;
+    led_count = 4;
+    rgb_matrix_set_color_all(1, 2, 3);
+    EXPECT_EQ(overruns, 0u);
+}
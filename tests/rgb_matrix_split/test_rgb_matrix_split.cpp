@@ -0,0 +1,30 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix_split.hpp"
+
+class RgbMatrixNotSplit : public RgbMatrixSplit {
+   protected:
+    void render(uint8_t mode) {
+        std::vector<frame_t>     frames = play(mode, [](KeymapKey&, bool) {});
+        const expected_frames_t& frame  = expected(mode);
+        EXPECT_EQ(frames.size(), frame.count);
+        EXPECT_EQ(hash_frames(frames, frame.count), frame.hash);
+    }
+};
+
+TEST_F(RgbMatrixNotSplit, CycleLeftRight) {
+    render(RGB_MATRIX_CYCLE_LEFT_RIGHT);
+}
+
+TEST_F(RgbMatrixNotSplit, SolidReactiveSimple) {
+    render(RGB_MATRIX_SOLID_REACTIVE_SIMPLE);
+}
+
+TEST_F(RgbMatrixNotSplit, Multisplash) {
+    render(RGB_MATRIX_MULTISPLASH);
+}
+
+TEST_F(RgbMatrixNotSplit, TypingHeatmap) {
+    render(RGB_MATRIX_TYPING_HEATMAP);
+}
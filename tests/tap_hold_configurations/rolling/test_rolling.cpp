@@ -0,0 +1,139 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+
+class RollingTyping : public TestFixture {
+   protected:
+    // Home row mods on the left, plain keys on the right.
+    std::vector<KeymapKey> keys = {
+        KeymapKey(0, 0, 1, SFT_T(KC_A)), KeymapKey(0, 1, 1, CTL_T(KC_S)), KeymapKey(0, 2, 1, ALT_T(KC_D)), KeymapKey(0, 3, 1, GUI_T(KC_F)), KeymapKey(0, 4, 1, KC_G),
+        KeymapKey(0, 5, 1, KC_H),        KeymapKey(0, 6, 1, KC_J),        KeymapKey(0, 7, 1, KC_K),        KeymapKey(0, 8, 1, KC_L),        KeymapKey(0, 9, 1, KC_SCLN),
+    };
+
+    std::string       typed;
+    bool              saw_mods = false;
+    report_keyboard_t previous = {};
+
+    void set_rolling_keymap() {
+        set_keymap({keys[0]});
+        for (size_t i = 1; i < keys.size(); i++) {
+            add_key(keys[i]);
+        }
+    }
+
+    /**
+     * @brief Records every newly pressed key of each keyboard report as a
+     * character in `typed`, and whether a modifier was ever sent.
+     */
+    void record_reports(TestDriver& driver) {
+        EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly([this](report_keyboard_t& report) {
+            saw_mods |= report.mods != 0;
+            for (uint8_t k : report.keys) {
+                if (k != KC_NO && std::find(std::begin(previous.keys), std::end(previous.keys), k) == std::end(previous.keys)) {
+                    typed += k == KC_SCLN ? ';' : static_cast<char>('a' + k - KC_A);
+                }
+            }
+            previous = report;
+        });
+    }
+
+    /**
+     * @brief Types `sequence` (indices into `keys`) as a roll where `overlap`
+     * keys are held at once, one matrix event per millisecond.
+     */
+    std::string roll(const std::vector<uint8_t>& sequence, size_t overlap) {
+        std::string expected;
+        for (size_t i = 0; i < sequence.size() + overlap - 1; i++) {
+            if (i < sequence.size()) {
+                keys[sequence[i]].press();
+                expected += get_tap_keycode(keys[sequence[i]].code) == KC_SCLN ? ';' : static_cast<char>('a' + get_tap_keycode(keys[sequence[i]].code) - KC_A);
+                run_one_scan_loop();
+            }
+            if (i + 1 >= overlap) {
+                keys[sequence[i + 1 - overlap]].release();
+                run_one_scan_loop();
+            }
+        }
+        return expected;
+    }
+
+    /** @brief A pseudo random sequence without repeated neighbouring keys. */
+    std::vector<uint8_t> word_sequence(size_t length, size_t window) {
+        std::vector<uint8_t> sequence;
+        uint16_t             lfsr = 0xACE1;
+        while (sequence.size() < length) {
+            lfsr             = (lfsr >> 1) ^ (-(lfsr & 1u) & 0xB400u);
+            uint8_t next     = lfsr % keys.size();
+            bool    inflight = false;
+            for (size_t j = sequence.size() > window ? sequence.size() - window : 0; j < sequence.size(); j++) {
+                inflight |= sequence[j] == next;
+            }
+            if (!inflight) {
+                sequence.push_back(next);
+            }
+        }
+        return sequence;
+    }
+};
+
+TEST_F(RollingTyping, TwoKeyRollOverHomeRowModsIsTyped) {
+    TestDriver driver;
+    set_rolling_keymap();
+    record_reports(driver);
+
+    auto sequence = word_sequence(400, 2);
+    auto expected = roll(sequence, 2);
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(typed, expected);
+    EXPECT_FALSE(saw_mods);
+}
+
+TEST_F(RollingTyping, SixKeyRollNeedsDeepWaitingBuffer) {
+    TestDriver driver;
+    set_rolling_keymap();
+    record_reports(driver);
+
+    // Holding six keys at once queues more than the default eight events
+    // behind each unsettled home row mod.
+    auto sequence = word_sequence(200, 6);
+    auto expected = roll(sequence, 6);
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(typed, expected);
+    EXPECT_FALSE(saw_mods);
+}
+
+TEST_F(RollingTyping, BenchmarkRollingHomeRowMods) {
+    TestDriver driver;
+    set_rolling_keymap();
+    record_reports(driver);
+
+    auto sequence = word_sequence(2000, 4);
+    auto start    = std::chrono::steady_clock::now();
+    auto expected = roll(sequence, 4);
+    idle_for(TAPPING_TERM);
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(typed, expected);
+
+    double events_per_second = (sequence.size() * 2) / (elapsed.count() / 1e9);
+    RecordProperty("events_per_second", std::to_string(static_cast<uint64_t>(events_per_second)));
+    std::cout << "[ BENCH    ] 4 key rolls over home row mods: " << static_cast<uint64_t>(events_per_second) << " events/s" << std::endl;
+}
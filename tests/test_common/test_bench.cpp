@@ -0,0 +1,224 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_bench.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "keycode.h"
+#include "test_matrix.h"
+
+extern "C" {
+#include "keyboard.h"
+#include "profiling.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+
+namespace {
+
+std::vector<BenchResult> results;
+
+uint64_t cpu_now_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+char keycode_to_char(uint8_t keycode, bool shifted) {
+    static const char digits[] = "1234567890";
+    if (keycode >= KC_A && keycode <= KC_Z) {
+        return (shifted ? 'A' : 'a') + keycode - KC_A;
+    }
+    if (keycode >= KC_1 && keycode <= KC_0) {
+        return digits[keycode - KC_1];
+    }
+    switch (keycode) {
+        case KC_SPACE:
+            return ' ';
+        case KC_ENTER:
+            return '\n';
+        case KC_DOT:
+            return '.';
+        case KC_COMMA:
+            return ',';
+        case KC_MINUS:
+            return shifted ? '_' : '-';
+        case KC_QUOTE:
+            return '\'';
+    }
+    return 0;
+}
+
+std::string json_escape(const std::string& text) {
+    std::string escaped;
+    for (char c : text) {
+        switch (c) {
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            default:
+                escaped += c;
+        }
+    }
+    return escaped;
+}
+
+/* Writes the results of all replays to $QMK_BENCH_OUTPUT at exit. */
+class BenchEnvironment : public testing::Environment {
+   public:
+    void TearDown() override {
+        const char* path = std::getenv("QMK_BENCH_OUTPUT");
+        if (path == nullptr || results.empty()) {
+            return;
+        }
+
+        std::ofstream out(path);
+        const char*   suite = std::getenv("QMK_BENCH_SUITE");
+        out << "{\n  \"suite\": \"" << json_escape(suite ? suite : "") << "\",\n  \"benchmarks\": [";
+        for (size_t i = 0; i < results.size(); i++) {
+            const BenchResult& r = results[i];
+            out << (i ? ",\n" : "\n") << "    {\n";
+            out << "      \"name\": \"" << json_escape(r.name) << "\",\n";
+            out << "      \"events\": " << r.events << ",\n";
+            out << "      \"scans\": " << r.scans << ",\n";
+            out << "      \"reports\": " << r.reports << ",\n";
+            out << "      \"reports_per_event\": " << (r.events ? (double)r.reports / r.events : 0) << ",\n";
+            out << "      \"cpu_ns_total\": " << r.cpu_ns_total() << ",\n";
+            out << "      \"cpu_ns_per_event\": {\"mean\": " << (r.events ? r.cpu_ns_total() / r.events : 0) << ", \"p50\": " << r.cpu_ns_percentile(50) << ", \"p99\": " << r.cpu_ns_percentile(99) << ", \"max\": " << r.cpu_ns_percentile(100) << "},\n";
+            out << "      \"processing\": {";
+            bool first = true;
+            for (const auto& [probe, count] : r.processing) {
+                out << (first ? "" : ", ") << "\"" << probe << "\": " << count;
+                first = false;
+            }
+            out << "}\n    }";
+        }
+        out << "\n  ]\n}\n";
+        std::cout << "[ BENCH    ] Results written to " << path << std::endl;
+    }
+};
+
+testing::Environment* const bench_environment = testing::AddGlobalTestEnvironment(new BenchEnvironment);
+
+} // namespace
+
+uint64_t BenchResult::cpu_ns_total() const {
+    uint64_t total = 0;
+    for (uint64_t ns : event_cpu_ns) {
+        total += ns;
+    }
+    return total;
+}
+
+uint64_t BenchResult::cpu_ns_percentile(unsigned percent) const {
+    if (event_cpu_ns.empty()) {
+        return 0;
+    }
+    std::vector<uint64_t> sorted = event_cpu_ns;
+    std::sort(sorted.begin(), sorted.end());
+    return sorted[std::min(sorted.size() - 1, sorted.size() * percent / 100)];
+}
+
+std::vector<BenchEvent> BenchFixture::load_trace(const char* source, const std::string& file) {
+    std::string path = source;
+    path             = path.substr(0, path.find_last_of('/') + 1) + file;
+
+    std::ifstream           in(path);
+    std::vector<BenchEvent> trace;
+    std::string             line;
+    EXPECT_TRUE(in.is_open()) << "cannot open trace " << path;
+    while (std::getline(in, line)) {
+        line = line.substr(0, line.find('#'));
+        std::istringstream fields(line);
+        unsigned           time, row, col;
+        char               state;
+        if (fields >> time >> row >> col >> state) {
+            EXPECT_TRUE(row < MATRIX_ROWS && col < MATRIX_COLS && (state == 'd' || state == 'u')) << path << ": bad event '" << line << "'";
+            trace.push_back({time, (uint8_t)row, (uint8_t)col, state == 'd'});
+        }
+    }
+    return trace;
+}
+
+BenchResult BenchFixture::replay(const std::string& name, const std::vector<BenchEvent>& trace, TestDriver& driver, unsigned settle_ms) {
+    BenchResult       result;
+    report_keyboard_t previous = {};
+    result.name                = name;
+    result.events              = trace.size();
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly([&](report_keyboard_t& report) {
+        result.reports++;
+        bool shifted = report.mods & MOD_MASK_SHIFT;
+        for (uint8_t keycode : report.keys) {
+            if (keycode == KC_NO || std::find(std::begin(previous.keys), std::end(previous.keys), keycode) != std::end(previous.keys)) {
+                continue;
+            }
+            if (keycode == KC_BACKSPACE) {
+                if (!result.typed.empty()) result.typed.pop_back();
+            } else if (char c = keycode_to_char(keycode, shifted)) {
+                result.typed += c;
+            }
+        }
+        previous = report;
+    });
+    EXPECT_CALL(driver, send_nkro_mock(_)).WillRepeatedly([&](report_nkro_t&) { result.reports++; });
+    EXPECT_CALL(driver, send_mouse_mock(_)).WillRepeatedly([&](report_mouse_t&) { result.reports++; });
+    EXPECT_CALL(driver, send_extra_mock(_)).WillRepeatedly([&](report_extra_t&) { result.reports++; });
+
+#ifdef PROFILING_ENABLE
+    profile_reset();
+#endif
+
+    auto scan = [&]() {
+        keyboard_task();
+        housekeeping_task();
+        advance_time(1);
+        result.scans++;
+    };
+
+    uint32_t now = 0;
+    for (size_t i = 0; i < trace.size(); i++) {
+        const BenchEvent& event = trace[i];
+        if (event.pressed) {
+            press_key(event.col, event.row);
+        } else {
+            release_key(event.col, event.row);
+        }
+
+        // Attribute all scans until the next event to this one, at least one.
+        uint32_t until = i + 1 < trace.size() ? std::max(trace[i + 1].time, event.time + 1) : event.time + 1;
+        uint64_t start = cpu_now_ns();
+        for (now = std::max(now, event.time); now < until; now++) {
+            scan();
+        }
+        result.event_cpu_ns.push_back(cpu_now_ns() - start);
+    }
+    for (unsigned i = 0; i < settle_ms; i++) {
+        scan();
+    }
+
+#ifdef PROFILING_ENABLE
+    for (uint8_t probe = 0; probe < PROFILE_PROBE_COUNT; probe++) {
+        result.processing[profile_get_name(probe)] = profile_get_stats(probe)->count;
+    }
+#endif
+
+    testing::Mock::VerifyAndClearExpectations(&driver);
+    results.push_back(result);
+    std::cout << "[ BENCH    ] " << name << ": " << result.events << " events, " << (result.events ? result.cpu_ns_total() / result.events : 0) << " ns/event, " << result.reports << " reports" << std::endl;
+    return result;
+}
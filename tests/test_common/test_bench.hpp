@@ -0,0 +1,61 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+
+/**
+ * @brief A single matrix change of a typing trace.
+ */
+struct BenchEvent {
+    uint32_t time; // ms since the start of the trace
+    uint8_t  row;
+    uint8_t  col;
+    bool     pressed;
+};
+
+/**
+ * @brief Measurements of one trace replay.
+ */
+struct BenchResult {
+    std::string name;
+    size_t      events  = 0;
+    uint32_t    scans   = 0;
+    uint32_t    reports = 0;
+    // CPU time of all scans between an event and the next one, per event.
+    std::vector<uint64_t> event_cpu_ns;
+    // Sample count of each profiling probe, if PROFILING_ENABLE is set.
+    std::map<std::string, uint32_t> processing;
+    // Text reconstructed from the keyboard reports.
+    std::string typed;
+
+    uint64_t cpu_ns_total() const;
+    uint64_t cpu_ns_percentile(unsigned percent) const;
+};
+
+/**
+ * @brief Fixture replaying recorded typing traces through keyboard_task().
+ *
+ * Traces are text files with one matrix change per line, as
+ * `<time ms> <row> <col> <d|u>`, and `#` comments. Every replay is added to a
+ * JSON summary which is written to $QMK_BENCH_OUTPUT when the suite exits, see
+ * `make bench:<suite>`.
+ */
+class BenchFixture : public TestFixture {
+   public:
+    /**
+     * @brief Loads `file` from the directory of `source`, pass `__FILE__`.
+     */
+    static std::vector<BenchEvent> load_trace(const char* source, const std::string& file);
+
+    /**
+     * @brief Replays `trace`, then idles for `settle_ms` to flush pending state.
+     */
+    BenchResult replay(const std::string& name, const std::vector<BenchEvent>& trace, TestDriver& driver, unsigned settle_ms = 1000);
+};
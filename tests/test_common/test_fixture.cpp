@@ -59,6 +59,9 @@ void TestFixture::TearDownTestCase() {}
 TestFixture::TestFixture() {
     m_this = this;
     timer_clear();
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_CACHE_ENABLE)
+    layer_cache_invalidate();
+#endif
     keyrecord_t empty_keyrecord = {0};
     test_logger.info() << "tapping term is " << +GET_TAPPING_TERM(KC_TRANSPARENT, &empty_keyrecord) << "ms" << std::endl;
 }
@@ -104,6 +107,9 @@ void TestFixture::add_key(KeymapKey key) {
     }
 
     this->keymap.push_back(key);
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_CACHE_ENABLE)
+    layer_cache_invalidate();
+#endif
 }
 
 void TestFixture::tap_key(KeymapKey key, unsigned delay_ms) {
@@ -131,6 +137,9 @@ void TestFixture::tap_combo(const std::vector<KeymapKey>& chord_keys, unsigned d
 
 void TestFixture::set_keymap(std::initializer_list<KeymapKey> keys) {
     this->keymap.clear();
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_CACHE_ENABLE)
+    layer_cache_invalidate();
+#endif
     for (auto& key : keys) {
         add_key(key);
     }